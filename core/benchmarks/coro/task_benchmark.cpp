@@ -0,0 +1,46 @@
+#include <benchmark/benchmark.h>
+
+#include "coro/task.hpp"
+
+namespace benchmarks::coro {
+
+namespace {
+
+core::coro::task<int> get_value(int value) { co_return value; }
+
+}  // namespace
+
+// NOTE: creation, await and destruction of a child task per iteration
+void BM_coro_task_await(benchmark::State& state) {
+  core::coro::spawn([](benchmark::State& state) -> core::coro::task<> {
+    for (const auto _ : state) {
+      benchmark::DoNotOptimize(co_await get_value(1));
+    }
+  }(state));
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_coro_task_await);
+
+void BM_coro_frame_allocator(benchmark::State& state) {
+  const std::size_t size = state.range(0);
+  for (const auto _ : state) {
+    void* frame = core::coro::allocate_frame(size);
+    benchmark::DoNotOptimize(frame);
+    core::coro::deallocate_frame(frame, size);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_coro_frame_allocator)->RangeMultiplier(4)->Range(64, 4096);
+
+void BM_coro_frame_allocator_new(benchmark::State& state) {
+  const std::size_t size = state.range(0);
+  for (const auto _ : state) {
+    void* frame = ::operator new(size);
+    benchmark::DoNotOptimize(frame);
+    ::operator delete(frame, size);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_coro_frame_allocator_new)->RangeMultiplier(4)->Range(64, 4096);
+
+}  // namespace benchmarks::coro
@@ -0,0 +1,36 @@
+#include <benchmark/benchmark.h>
+
+#include "io/fd.hpp"
+#include "io/shared_fd.hpp"
+
+namespace benchmarks::io {
+
+// NOTE: every copy of io::fd is a dup() and a close() on destruction
+void BM_io_fd_copy(benchmark::State& state) {
+  const core::io::fd fd(core::io::fd::kStdin());
+  for (const auto _ : state) {
+    core::io::fd copy(fd);
+    benchmark::DoNotOptimize(copy);
+  }
+}
+BENCHMARK(BM_io_fd_copy);
+
+void BM_io_shared_fd_copy(benchmark::State& state) {
+  const core::io::shared_fd<> fd{core::io::fd(core::io::fd::kStdin())};
+  for (const auto _ : state) {
+    core::io::shared_fd<> copy(fd);
+    benchmark::DoNotOptimize(copy);
+  }
+}
+BENCHMARK(BM_io_shared_fd_copy)->Threads(1)->Threads(4);
+
+void BM_io_shared_fd_duplicate(benchmark::State& state) {
+  const core::io::shared_fd<> fd{core::io::fd(core::io::fd::kStdin())};
+  for (const auto _ : state) {
+    core::io::fd copy = fd.duplicate();
+    benchmark::DoNotOptimize(copy);
+  }
+}
+BENCHMARK(BM_io_shared_fd_duplicate);
+
+}  // namespace benchmarks::io
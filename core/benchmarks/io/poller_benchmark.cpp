@@ -0,0 +1,231 @@
+#include <benchmark/benchmark.h>
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include "io/poller.hpp"
+#include "net/inet/sockaddr.hpp"
+#include "net/inet/udp/socket.hpp"
+
+namespace benchmarks::io {
+
+namespace {
+
+// NOTE: raises the soft RLIMIT_NOFILE to fit the registered sockets plus some
+// headroom, returns false if the hard limit is too low
+bool reserve_descriptors(std::size_t registered) {
+  const ::rlim_t required = registered + 64;
+  ::rlimit rlimit;
+  if (::getrlimit(RLIMIT_NOFILE, &rlimit) == 0 && rlimit.rlim_cur < required) {
+    rlimit.rlim_cur = std::min(rlimit.rlim_max, required);
+    ::setrlimit(RLIMIT_NOFILE, &rlimit);
+  }
+  return ::getrlimit(RLIMIT_NOFILE, &rlimit) == 0 &&
+         rlimit.rlim_cur >= required;
+}
+
+}  // namespace
+
+void BM_io_poller_wakeup(benchmark::State& state,
+                         core::io::poller::backend backend) {
+  const std::size_t registered = state.range(0);
+  if (!reserve_descriptors(registered)) {
+    state.SkipWithError("RLIMIT_NOFILE is too low");
+    return;
+  }
+
+  const std::vector<std::byte> buffer{std::byte(1)};
+  core::net::inet::sockaddr sockaddr(core::net::inet::ip::kLoopback(),
+                                     core::net::inet::port(0));
+
+  core::net::inet::udp::socket server;
+  server.set_nonblock(true);
+  server.bind(sockaddr);
+  server.get_bind_sockaddr(sockaddr);
+
+  core::net::inet::udp::socket client;
+  client.set_nonblock(true);
+  client.connect(sockaddr);
+
+  core::net::inet::udp::socket idle;
+  const std::vector<core::net::inet::udp::socket> idles(registered - 1, idle);
+
+  std::vector<std::byte> received(buffer.size());
+  core::io::poller poller(
+      [&server, &received](core::io::poller&, const core::io::fd&,
+                           core::io::poller::events_t, void*) {
+        benchmark::DoNotOptimize(server.receive(received));
+      },
+      backend);
+  for (const auto& socket : idles) {
+    poller.insert_or_assign(socket, core::io::poller::event::kPollIn);
+  }
+  poller.insert_or_assign(server, core::io::poller::event::kPollIn);
+
+  for (const auto _ : state) {
+    client.send(buffer);
+    poller.poll();
+  }
+  state.counters["registered"] = static_cast<double>(registered);
+}
+BENCHMARK_CAPTURE(BM_io_poller_wakeup, poll, core::io::poller::backend::kPoll)
+    ->RangeMultiplier(10)
+    ->Range(10, 100000)
+    ->Unit(benchmark::TimeUnit::kMicrosecond);
+#ifdef __linux__
+BENCHMARK_CAPTURE(BM_io_poller_wakeup, epoll,
+                  core::io::poller::backend::kEpoll)
+    ->RangeMultiplier(10)
+    ->Range(10, 100000)
+    ->Unit(benchmark::TimeUnit::kMicrosecond);
+#endif
+
+void BM_io_poller_insert_or_assign_erase(benchmark::State& state,
+                                         core::io::poller::backend backend) {
+  const std::size_t registered = state.range(0);
+  if (!reserve_descriptors(registered)) {
+    state.SkipWithError("RLIMIT_NOFILE is too low");
+    return;
+  }
+
+  core::net::inet::udp::socket idle;
+  const std::vector<core::net::inet::udp::socket> idles(registered, idle);
+
+  core::io::poller poller(core::io::poller::callback_t{}, backend);
+  for (const auto _ : state) {
+    for (const auto& socket : idles) {
+      poller.insert_or_assign(socket, core::io::poller::event::kPollIn);
+    }
+    for (const auto& socket : idles) {
+      poller.erase(socket);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * registered);
+}
+BENCHMARK_CAPTURE(BM_io_poller_insert_or_assign_erase, poll,
+                  core::io::poller::backend::kPoll)
+    ->RangeMultiplier(10)
+    ->Range(10, 10000);
+#ifdef __linux__
+BENCHMARK_CAPTURE(BM_io_poller_insert_or_assign_erase, epoll,
+                  core::io::poller::backend::kEpoll)
+    ->RangeMultiplier(10)
+    ->Range(10, 10000);
+#endif
+
+// NOTE: latency between post() on one thread and the execution of the task on
+// the polling thread blocked in poll()
+void BM_io_poller_post_latency(benchmark::State& state,
+                               core::io::poller::backend backend) {
+  core::io::poller poller(core::io::poller::callback_t{}, backend);
+
+  std::atomic<bool> running = true;
+  std::thread thread([&poller, &running] {
+    while (running.load(std::memory_order::relaxed)) {
+      poller.poll();
+    }
+  });
+
+  std::atomic<std::size_t> executed = 0;
+  for (const auto _ : state) {
+    const std::size_t expected = executed.load(std::memory_order::relaxed) + 1;
+    poller.post([&executed] {
+      executed.fetch_add(1, std::memory_order::release);
+    });
+    while (executed.load(std::memory_order::acquire) != expected);
+  }
+
+  poller.post([&running] { running.store(false, std::memory_order::relaxed); });
+  thread.join();
+}
+BENCHMARK_CAPTURE(BM_io_poller_post_latency, poll,
+                  core::io::poller::backend::kPoll)
+    ->UseRealTime()
+    ->Unit(benchmark::TimeUnit::kMicrosecond);
+#ifdef __linux__
+BENCHMARK_CAPTURE(BM_io_poller_post_latency, epoll,
+                  core::io::poller::backend::kEpoll)
+    ->UseRealTime()
+    ->Unit(benchmark::TimeUnit::kMicrosecond);
+#endif
+
+// NOTE: latency between a send() on one thread and the dispatch of the
+// datagram on the polling thread. The argument is the busy poll budget in
+// microseconds, zero blocks in poll() right away
+void BM_io_poller_busy_poll_latency(benchmark::State& state,
+                                    core::io::poller::backend backend) {
+  const std::chrono::microseconds budget(state.range(0));
+  if (budget.count() > 0 && std::thread::hardware_concurrency() < 2) {
+    state.SkipWithError("busy polling requires a spare core");
+    return;
+  }
+
+  const std::vector<std::byte> buffer{std::byte(1)};
+  core::net::inet::sockaddr sockaddr(core::net::inet::ip::kLoopback(),
+                                     core::net::inet::port(0));
+
+  core::net::inet::udp::socket server;
+  server.set_nonblock(true);
+  server.bind(sockaddr);
+  server.get_bind_sockaddr(sockaddr);
+
+  core::net::inet::udp::socket client;
+  client.connect(sockaddr);
+
+  std::atomic<std::size_t> received = 0;
+  core::io::poller poller(
+      [&server, &received](core::io::poller&, const core::io::fd&,
+                           core::io::poller::events_t, void*) {
+        std::vector<std::byte> bytes(1);
+        while (server.receive(bytes) > 0) {
+          received.fetch_add(1, std::memory_order::release);
+        }
+      },
+      backend);
+  poller.insert_or_assign(server, core::io::poller::event::kPollIn);
+  poller.set_busy_poll({
+      .budget = budget,
+      .socket_budget = std::chrono::microseconds(0),
+  });
+
+  std::atomic<bool> running = true;
+  std::thread thread([&poller, &running] {
+    while (running.load(std::memory_order::relaxed)) {
+      poller.poll();
+    }
+  });
+
+  for (const auto _ : state) {
+    const std::size_t expected = received.load(std::memory_order::relaxed) + 1;
+    client.send(buffer);
+    while (received.load(std::memory_order::acquire) != expected);
+  }
+
+  poller.post([&running] { running.store(false, std::memory_order::relaxed); });
+  thread.join();
+
+  const auto counters = poller.get_busy_poll_counters();
+  state.counters["spin_hits"] = static_cast<double>(counters.spin_hits);
+  state.counters["sleeps"] = static_cast<double>(counters.sleeps);
+}
+BENCHMARK_CAPTURE(BM_io_poller_busy_poll_latency, poll,
+                  core::io::poller::backend::kPoll)
+    ->Arg(0)
+    ->Arg(50)
+    ->Arg(1000)
+    ->UseRealTime()
+    ->Unit(benchmark::TimeUnit::kMicrosecond);
+#ifdef __linux__
+BENCHMARK_CAPTURE(BM_io_poller_busy_poll_latency, epoll,
+                  core::io::poller::backend::kEpoll)
+    ->Arg(0)
+    ->Arg(50)
+    ->Arg(1000)
+    ->UseRealTime()
+    ->Unit(benchmark::TimeUnit::kMicrosecond);
+#endif
+
+}  // namespace benchmarks::io
@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+
+#include <map>
+#include <random>
+
+#include "io/timer_wheel.hpp"
+
+namespace benchmarks::io {
+
+namespace {
+
+using clock_t = core::io::timer_wheel::clock_t;
+
+constexpr std::chrono::milliseconds kMaxTimeout(60000);
+
+}  // namespace
+
+// NOTE: rescheduling of the per-connection timeouts i.e. cancel() and
+// schedule() of a random one of the live timers
+void BM_io_timer_wheel_reschedule(benchmark::State& state) {
+  const std::size_t timers = state.range(0);
+  const clock_t::time_point start = clock_t::now();
+
+  std::mt19937_64 random(timers);
+  std::uniform_int_distribution<std::int64_t> timeouts(1, kMaxTimeout.count());
+  std::uniform_int_distribution<std::size_t> indices(0, timers - 1);
+
+  core::io::timer_wheel timer_wheel(start);
+  std::vector<core::io::timer_wheel::timer_id_t> ids(timers);
+  for (auto& id : ids) {
+    id = timer_wheel.schedule(
+        start + std::chrono::milliseconds(timeouts(random)), [] {});
+  }
+
+  for (const auto _ : state) {
+    auto& id = ids[indices(random)];
+    benchmark::DoNotOptimize(timer_wheel.cancel(id));
+    id = timer_wheel.schedule(
+        start + std::chrono::milliseconds(timeouts(random)), [] {});
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_io_timer_wheel_reschedule)
+    ->RangeMultiplier(10)
+    ->Range(1000, 1000000);
+
+void BM_io_timer_wheel_reschedule_multimap(benchmark::State& state) {
+  const std::size_t timers = state.range(0);
+  const clock_t::time_point start = clock_t::now();
+
+  std::mt19937_64 random(timers);
+  std::uniform_int_distribution<std::int64_t> timeouts(1, kMaxTimeout.count());
+  std::uniform_int_distribution<std::size_t> indices(0, timers - 1);
+
+  using multimap_t =
+      std::multimap<clock_t::time_point, core::io::timer_wheel::callback_t>;
+  multimap_t multimap;
+  std::vector<multimap_t::iterator> ids(timers);
+  for (auto& id : ids) {
+    id = multimap.emplace(start + std::chrono::milliseconds(timeouts(random)),
+                          [] {});
+  }
+
+  for (const auto _ : state) {
+    auto& id = ids[indices(random)];
+    multimap.erase(id);
+    id = multimap.emplace(start + std::chrono::milliseconds(timeouts(random)),
+                          [] {});
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_io_timer_wheel_reschedule_multimap)
+    ->RangeMultiplier(10)
+    ->Range(1000, 1000000);
+
+// NOTE: firing of the timers scheduled one per millisecond
+void BM_io_timer_wheel_advance(benchmark::State& state) {
+  const std::size_t timers = state.range(0);
+  const clock_t::time_point start = clock_t::now();
+
+  std::size_t fired = 0;
+  for (const auto _ : state) {
+    state.PauseTiming();
+    core::io::timer_wheel timer_wheel(start);
+    for (std::size_t i = 1; i <= timers; ++i) {
+      timer_wheel.schedule(start + std::chrono::milliseconds(i),
+                           [&fired] { fired += 1; });
+    }
+    state.ResumeTiming();
+
+    timer_wheel.advance(start + std::chrono::milliseconds(timers));
+  }
+  benchmark::DoNotOptimize(fired);
+  state.SetItemsProcessed(state.iterations() * timers);
+}
+BENCHMARK(BM_io_timer_wheel_advance)->RangeMultiplier(10)->Range(1000, 100000);
+
+}  // namespace benchmarks::io
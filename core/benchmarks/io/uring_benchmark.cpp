@@ -0,0 +1,48 @@
+#include <benchmark/benchmark.h>
+
+#include <optional>
+
+#include "io/uring.hpp"
+#include "net/inet/sockaddr.hpp"
+#include "net/inet/udp/socket.hpp"
+
+namespace benchmarks::io {
+
+void BM_io_uring_send_receive(benchmark::State& state) {
+  const std::size_t batch = state.range(0);
+
+  const std::vector<std::byte> buffer{std::byte(1)};
+  core::net::inet::sockaddr sockaddr(core::net::inet::ip::kLoopback(),
+                                     core::net::inet::port(0));
+
+  core::net::inet::udp::socket server;
+  server.bind(sockaddr);
+  server.get_bind_sockaddr(sockaddr);
+
+  core::net::inet::udp::socket client;
+  client.connect(sockaddr);
+
+  std::optional<core::io::uring> uring;
+  try {
+    uring.emplace(batch * 2);
+  } catch (...) {
+    state.SkipWithError("unsupported io_uring");
+    return;
+  }
+
+  std::vector<std::vector<std::byte>> received(
+      batch, std::vector<std::byte>(buffer.size()));
+  for (const auto _ : state) {
+    for (std::size_t i = 0; i < batch; ++i) {
+      uring->send(client, buffer, core::io::uring::callback_t{});
+      uring->receive(server, received[i], core::io::uring::callback_t{});
+    }
+    while (uring->get_pending() > 0) {
+      uring->run();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * batch);
+}
+BENCHMARK(BM_io_uring_send_receive)->RangeMultiplier(4)->Range(1, 64);
+
+}  // namespace benchmarks::io
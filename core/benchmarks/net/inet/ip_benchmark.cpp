@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "net/inet/ip.hpp"
+
+namespace benchmarks::net::inet {
+
+void BM_net_inet_ip_parse(benchmark::State& state) {
+  const std::string string("192.168.100.200");
+  for (const auto _ : state) {
+    benchmark::DoNotOptimize(core::net::inet::ip::parse(string));
+  }
+}
+BENCHMARK(BM_net_inet_ip_parse);
+
+namespace {
+
+std::string make_lines(std::size_t size) {
+  std::mt19937 random(0);
+  std::string lines;
+  for (std::size_t i = 0; i < size; ++i) {
+    lines.append(
+        core::net::inet::ip(static_cast<std::uint32_t>(random())).to_string());
+    lines.push_back('\n');
+  }
+  return lines;
+}
+
+}  // namespace
+
+// NOTE: the scalar baseline for BM_net_inet_ip_parse_lines
+void BM_net_inet_ip_parse_each_line(benchmark::State& state) {
+  const std::size_t size = state.range(0);
+  const std::string lines = make_lines(size);
+
+  std::vector<core::net::inet::ip> ips;
+  ips.reserve(size);
+  for (const auto _ : state) {
+    ips.clear();
+    std::string_view rest(lines);
+    while (!rest.empty()) {
+      const std::size_t end = rest.find('\n');
+      ips.push_back(*core::net::inet::ip::parse(rest.substr(0, end)));
+      rest.remove_prefix(end + 1);
+    }
+    benchmark::DoNotOptimize(ips.data());
+  }
+  state.SetItemsProcessed(state.iterations() * size);
+  state.SetBytesProcessed(state.iterations() * lines.size());
+}
+BENCHMARK(BM_net_inet_ip_parse_each_line)->Arg(1024)->Arg(65536);
+
+void BM_net_inet_ip_parse_lines(benchmark::State& state) {
+  const std::size_t size = state.range(0);
+  const std::string lines = make_lines(size);
+
+  std::vector<core::net::inet::ip> ips;
+  ips.reserve(size);
+  for (const auto _ : state) {
+    ips.clear();
+    core::net::inet::ip::parse_lines(lines, ips);
+    benchmark::DoNotOptimize(ips.data());
+  }
+  state.SetItemsProcessed(state.iterations() * size);
+  state.SetBytesProcessed(state.iterations() * lines.size());
+}
+BENCHMARK(BM_net_inet_ip_parse_lines)->Arg(1024)->Arg(65536);
+
+void BM_net_inet_ip_format_to(benchmark::State& state) {
+  const core::net::inet::ip ip(0xC0A864C8);
+  char buffer[core::net::inet::ip::kMaxStringSize];
+  for (const auto _ : state) {
+    benchmark::DoNotOptimize(ip.format_to(buffer));
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(BM_net_inet_ip_format_to);
+
+}  // namespace benchmarks::net::inet
@@ -0,0 +1,151 @@
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "net/inet/lpm_table.hpp"
+
+namespace benchmarks::net::inet {
+
+namespace {
+
+// NOTE: a routing table like prefix length distribution, mostly /24 with a
+// tail of the shorter and a few of the host routes
+std::vector<std::pair<core::net::inet::cidr, std::uint32_t>> make_rules(
+    std::size_t size) {
+  std::mt19937 random(0);
+  std::discrete_distribution<std::size_t> lengths{
+      {0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,  2,  3,  5,  6, 15,
+       10, 15, 25, 35, 50, 90, 85, 600, 1,  1,  1,  1,  1,  1,  1,  5}};
+  std::vector<std::pair<core::net::inet::cidr, std::uint32_t>> rules;
+  rules.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    rules.emplace_back(
+        core::net::inet::cidr(
+            core::net::inet::ip(static_cast<std::uint32_t>(random())),
+            lengths(random)),
+        static_cast<std::uint32_t>(i));
+  }
+  return rules;
+}
+
+const core::net::inet::lpm_table& table() {
+  static const core::net::inet::lpm_table table = [] {
+    core::net::inet::lpm_table table;
+    table.insert(make_rules(500'000));
+    return table;
+  }();
+  return table;
+}
+
+std::vector<core::net::inet::ip> make_random_ips(std::size_t size) {
+  std::mt19937 random(1);
+  std::vector<core::net::inet::ip> ips;
+  ips.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    ips.emplace_back(static_cast<std::uint32_t>(random()));
+  }
+  return ips;
+}
+
+// NOTE: 90% of the lookups hit the addresses of 1024 hot flows as the
+// traffic of a router is dominated by few destinations
+std::vector<core::net::inet::ip> make_skewed_ips(std::size_t size) {
+  std::mt19937 random(2);
+  const std::vector<core::net::inet::ip> hot = make_random_ips(1024);
+  std::vector<core::net::inet::ip> ips;
+  ips.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    if (random() % 10 != 0) {
+      ips.push_back(hot[random() % hot.size()]);
+    } else {
+      ips.emplace_back(static_cast<std::uint32_t>(random()));
+    }
+  }
+  return ips;
+}
+
+constexpr std::size_t kStreamSize = 1 << 20;
+
+}  // namespace
+
+void BM_net_inet_lpm_table_build(benchmark::State& state) {
+  const std::vector<std::pair<core::net::inet::cidr, std::uint32_t>> rules =
+      make_rules(state.range(0));
+  for (const auto _ : state) {
+    core::net::inet::lpm_table table;
+    table.insert(rules);
+    benchmark::DoNotOptimize(table);
+  }
+  state.SetItemsProcessed(state.iterations() * rules.size());
+}
+BENCHMARK(BM_net_inet_lpm_table_build)
+    ->Arg(500'000)
+    ->Unit(benchmark::kMillisecond);
+
+void BM_net_inet_lpm_table_update(benchmark::State& state) {
+  std::vector<std::pair<core::net::inet::cidr, std::uint32_t>> rules =
+      make_rules(500'000);
+  core::net::inet::lpm_table table;
+  table.insert(rules);
+
+  std::size_t i = 0;
+  for (const auto _ : state) {
+    const auto& [cidr, value] = rules[i++ % rules.size()];
+    table.erase(cidr);
+    table.insert(cidr, value);
+  }
+}
+BENCHMARK(BM_net_inet_lpm_table_update);
+
+void BM_net_inet_lpm_table_lookup_random(benchmark::State& state) {
+  const std::vector<core::net::inet::ip> ips = make_random_ips(kStreamSize);
+  std::size_t i = 0;
+  for (const auto _ : state) {
+    benchmark::DoNotOptimize(table().lookup(ips[i++ % ips.size()]));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_net_inet_lpm_table_lookup_random);
+
+void BM_net_inet_lpm_table_lookup_skewed(benchmark::State& state) {
+  const std::vector<core::net::inet::ip> ips = make_skewed_ips(kStreamSize);
+  std::size_t i = 0;
+  for (const auto _ : state) {
+    benchmark::DoNotOptimize(table().lookup(ips[i++ % ips.size()]));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_net_inet_lpm_table_lookup_skewed);
+
+void BM_net_inet_lpm_table_lookup_batch_random(benchmark::State& state) {
+  const std::vector<core::net::inet::ip> ips = make_random_ips(kStreamSize);
+  std::vector<std::uint32_t> values(state.range(0));
+  std::size_t i = 0;
+  for (const auto _ : state) {
+    table().lookup(std::span(ips).subspan(i, values.size()), values, 0);
+    benchmark::DoNotOptimize(values.data());
+    i = (i + values.size()) % ips.size();
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+BENCHMARK(BM_net_inet_lpm_table_lookup_batch_random)->Arg(64)->Arg(1024);
+
+void BM_net_inet_lpm_table_lookup_batch_skewed(benchmark::State& state) {
+  const std::vector<core::net::inet::ip> ips = make_skewed_ips(kStreamSize);
+  std::vector<std::uint32_t> values(state.range(0));
+  std::size_t i = 0;
+  for (const auto _ : state) {
+    table().lookup(std::span(ips).subspan(i, values.size()), values, 0);
+    benchmark::DoNotOptimize(values.data());
+    i = (i + values.size()) % ips.size();
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+BENCHMARK(BM_net_inet_lpm_table_lookup_batch_skewed)->Arg(64)->Arg(1024);
+
+}  // namespace benchmarks::net::inet
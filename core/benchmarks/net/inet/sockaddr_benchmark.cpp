@@ -1,5 +1,10 @@
 #include <benchmark/benchmark.h>
 
+#include <format>
+#include <iterator>
+#include <string>
+#include <vector>
+
 #include "net/inet/sockaddr.hpp"
 
 namespace benchmarks::net::inet {
@@ -31,4 +36,48 @@ void BM_net_inet_sockaddr_to_string(benchmark::State& state) {
 }
 BENCHMARK(BM_net_inet_sockaddr_to_string);
 
+void BM_net_inet_sockaddr_copy(benchmark::State& state) {
+  const core::net::inet::sockaddr sockaddr(core::net::inet::ip("127.0.0.1"),
+                                           core::net::inet::port(0));
+  for (const auto _ : state) {
+    core::net::inet::sockaddr copy(sockaddr);
+    benchmark::DoNotOptimize(copy);
+  }
+}
+BENCHMARK(BM_net_inet_sockaddr_copy);
+
+void BM_net_inet_sockaddr_vector(benchmark::State& state) {
+  const std::size_t size = state.range(0);
+  const core::net::inet::sockaddr sockaddr(core::net::inet::ip("127.0.0.1"),
+                                           core::net::inet::port(0));
+  for (const auto _ : state) {
+    std::vector<core::net::inet::sockaddr> sockaddrs(size, sockaddr);
+    benchmark::DoNotOptimize(sockaddrs.data());
+  }
+}
+BENCHMARK(BM_net_inet_sockaddr_vector)->Arg(1024);
+
+void BM_net_inet_sockaddr_equality(benchmark::State& state) {
+  const core::net::inet::sockaddr sockaddr(core::net::inet::ip("127.0.0.1"),
+                                           core::net::inet::port(0));
+  const core::net::inet::sockaddr other(sockaddr);
+  for (const auto _ : state) {
+    benchmark::DoNotOptimize(sockaddr == other);
+  }
+}
+BENCHMARK(BM_net_inet_sockaddr_equality);
+
+void BM_net_inet_sockaddr_format(benchmark::State& state) {
+  const core::net::inet::sockaddr sockaddr(
+      core::net::inet::ip("192.168.100.200"), core::net::inet::port(65535));
+  std::string string;
+  string.reserve(core::net::sockets::base_sockaddr::kMaxStringSize);
+  for (const auto _ : state) {
+    string.clear();
+    std::format_to(std::back_inserter(string), "{}", sockaddr);
+    benchmark::DoNotOptimize(string.data());
+  }
+}
+BENCHMARK(BM_net_inet_sockaddr_format);
+
 }  // namespace benchmarks::net::inet
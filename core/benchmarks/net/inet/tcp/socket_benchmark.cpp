@@ -1,5 +1,9 @@
 #include <benchmark/benchmark.h>
 
+#include <array>
+#include <span>
+#include <vector>
+
 #include "net/inet/sockaddr.hpp"
 #include "net/inet/tcp/socket.hpp"
 
@@ -32,6 +36,67 @@ void BM_net_inet_tcp_nonblock_handshake(benchmark::State& state) {
 BENCHMARK(BM_net_inet_tcp_nonblock_handshake)
     ->Unit(benchmark::TimeUnit::kMicrosecond);
 
+// NOTE: accepts per second of a burst of concurrent connects. The connects
+// complete in the backlog before the timed part on loopback and the timed
+// part drains the backlog with accept() or accept_many()
+void BM_net_inet_tcp_accept_burst(benchmark::State& state, bool many) {
+  const std::size_t burst = state.range(0);
+
+  core::net::inet::sockaddr sockaddr(core::net::inet::ip::kLoopback(),
+                                     core::net::inet::port(0));
+
+  core::net::inet::tcp::socket server;
+  server.set_nonblock(true);
+  server.bind(sockaddr);
+  server.get_bind_sockaddr(sockaddr);
+  server.listen(burst);
+
+  std::vector<core::net::inet::tcp::socket> accepted(
+      burst, core::net::inet::tcp::socket(core::utils::uninitialized_t{}));
+  std::vector<core::net::inet::sockaddr> peers;
+  for (std::size_t i = 0; i < burst; ++i) {
+    peers.emplace_back(core::net::inet::ip::kNonRoutable(),
+                       core::net::inet::port(0));
+  }
+
+  for (const auto _ : state) {
+    state.PauseTiming();
+    std::vector<core::net::inet::tcp::socket> clients(burst);
+    for (auto& client : clients) {
+      client.set_nonblock(true);
+      client.connect(sockaddr);
+    }
+    state.ResumeTiming();
+
+    std::size_t count = 0;
+    while (count < burst) {
+      if (many) {
+        count += server.accept_many(std::span(accepted).subspan(count),
+                                    std::span(peers).subspan(count));
+      } else if (server.accept(accepted[count]) ==
+                 core::net::inet::tcp::socket::accept_status::kSuccess) {
+        accepted[count].get_connect_sockaddr(peers[count]);
+        count += 1;
+      }
+    }
+
+    state.PauseTiming();
+    for (auto& socket : accepted) {
+      socket.close();
+    }
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * burst);
+}
+BENCHMARK_CAPTURE(BM_net_inet_tcp_accept_burst, accept, false)
+    ->RangeMultiplier(4)
+    ->Range(16, 256)
+    ->Unit(benchmark::TimeUnit::kMicrosecond);
+BENCHMARK_CAPTURE(BM_net_inet_tcp_accept_burst, accept_many, true)
+    ->RangeMultiplier(4)
+    ->Range(16, 256)
+    ->Unit(benchmark::TimeUnit::kMicrosecond);
+
 void BM_net_inet_tcp_throughput(benchmark::State& state) {
   const std::size_t data_size = state.range(0);
   const std::size_t buffer_size = state.range(1);
@@ -75,6 +140,74 @@ BENCHMARK(BM_net_inet_tcp_throughput)
     ->Threads(2)
     ->Args({1048576, 512})
     ->Args({1048576, 128})
+    ->Args({16777216, 65536})
+    ->Args({16777216, 1048576})
+    ->Unit(benchmark::TimeUnit::kMicrosecond);
+
+// NOTE: same as above with MSG_ZEROCOPY sends. The completions are drained
+// only when the kernel runs out of the memory for the pinned pages since the
+// benchmark never modifies the buffer. On loopback the kernel falls back to
+// copying which is reported in the copied counter
+void BM_net_inet_tcp_throughput_zerocopy(benchmark::State& state) {
+  const std::size_t data_size = state.range(0);
+  const std::size_t buffer_size = state.range(1);
+
+  const core::net::inet::sockaddr sockaddr(core::net::inet::ip::kLoopback(),
+                                           core::net::inet::port(8002));
+
+  core::net::inet::tcp::socket socket;
+  socket.set_nonblock(true);
+  socket.set_reuseaddr(true);
+  socket.set_reuseport(true);
+
+  std::vector<std::byte> buffer(buffer_size);
+  if (state.thread_index() == 0) {
+    socket.bind(sockaddr);
+    socket.listen(1);
+
+    core::net::inet::tcp::socket peer(core::utils::uninitialized_t{});
+    while (socket.accept(peer) !=
+           core::net::inet::tcp::socket::accept_status::kSuccess);
+
+    for (const auto _ : state) {
+      std::size_t received = 0;
+      while (received < data_size) {
+        received += peer.receive(buffer);
+      }
+    }
+  } else {
+    try {
+      socket.set_zerocopy(true);
+    } catch (...) {
+      state.SkipWithError("SO_ZEROCOPY is not supported");
+    }
+    while (socket.connect(sockaddr) !=
+           core::net::inet::tcp::socket::connection_status::kSuccess);
+
+    std::size_t copied = 0;
+    std::array<core::net::inet::tcp::socket::zerocopy_completion, 64>
+        completions;
+    for (const auto _ : state) {
+      std::size_t sent = 0;
+      while (sent < data_size) {
+        const std::size_t bytes = socket.send_zerocopy(buffer);
+        if (bytes == 0) {
+          const std::size_t received =
+              socket.receive_zerocopy_completions(completions);
+          for (std::size_t i = 0; i < received; ++i) {
+            copied += completions[i].copied ? 1 : 0;
+          }
+        }
+        sent += bytes;
+      }
+    }
+    state.counters["copied"] = static_cast<double>(copied);
+  }
+}
+BENCHMARK(BM_net_inet_tcp_throughput_zerocopy)
+    ->Threads(2)
+    ->Args({16777216, 65536})
+    ->Args({16777216, 1048576})
     ->Unit(benchmark::TimeUnit::kMicrosecond);
 
 }  // namespace benchmarks::net::inet::tcp
@@ -1,7 +1,11 @@
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
+#include <span>
+
 #include "net/inet/sockaddr.hpp"
 #include "net/inet/udp/socket.hpp"
+#include "net/sockets/message_batch.hpp"
 
 namespace benchmarks::net::inet::udp {
 
@@ -57,4 +61,81 @@ BENCHMARK(BM_net_inet_udp_throughput)
     ->Args({1048576, 128})
     ->Unit(benchmark::TimeUnit::kMicrosecond);
 
+// NOTE: same as above with send_many()/receive_many() of the given number of
+// datagrams per syscall. The receiver gives up on the lost datagrams only once
+// the sender has finished the same iteration
+void BM_net_inet_udp_throughput_batch(benchmark::State& state) {
+  static std::atomic<std::size_t> sent_iterations;
+
+  const std::size_t data_size = state.range(0);
+  const std::size_t buffer_size = state.range(1);
+  const std::size_t batch_size = state.range(2);
+
+  const core::net::inet::sockaddr sockaddr(core::net::inet::ip::kLoopback(),
+                                           core::net::inet::port(8001));
+
+  core::net::inet::udp::socket socket;
+  socket.set_nonblock(true);
+  socket.set_reuseaddr(true);
+  socket.set_reuseport(true);
+
+  if (state.thread_index() == 0) {
+    sent_iterations = 0;
+    socket.bind(sockaddr);
+
+    std::vector<std::byte> buffer(batch_size * buffer_size);
+    core::net::sockets::message_batch batch(batch_size);
+    for (std::size_t i = 0; i < batch_size; ++i) {
+      batch.push(std::span(buffer).subspan(i * buffer_size, buffer_size));
+    }
+
+    std::size_t loss = 0;
+    std::size_t iterations = 0;
+    for (const auto _ : state) {
+      iterations += 1;
+      std::size_t received = 0;
+      while (received < data_size) {
+        const std::size_t messages = socket.receive_many(batch);
+        if (messages == 0 &&
+            sent_iterations.load(std::memory_order::acquire) >= iterations) {
+          break;
+        }
+        for (std::size_t i = 0; i < messages; ++i) {
+          received += batch.get_length(i);
+        }
+      }
+      loss += (data_size - std::min(received, data_size));
+    }
+    state.counters["loss"] = benchmark::Counter(
+        loss * state.threads(), benchmark::Counter::kAvgIterations);
+  } else {
+    while (socket.connect(sockaddr) !=
+           core::net::inet::udp::socket::connection_status::kSuccess);
+
+    const std::vector<std::byte> buffer(buffer_size);
+    core::net::sockets::message_batch batch(batch_size);
+    for (std::size_t i = 0; i < batch_size; ++i) {
+      batch.push(buffer);
+    }
+
+    for (const auto _ : state) {
+      std::size_t sent = 0;
+      while (sent < data_size) {
+        // NOTE: the tail of the batch is sent last to not overshoot data_size
+        const std::size_t messages =
+            std::min((data_size - sent + buffer_size - 1) / buffer_size,
+                     batch_size);
+        sent += socket.send_many(batch, batch_size - messages) * buffer_size;
+      }
+      sent_iterations.fetch_add(1, std::memory_order::release);
+    }
+  }
+}
+#ifdef __linux__
+BENCHMARK(BM_net_inet_udp_throughput_batch)
+    ->Threads(2)
+    ->ArgsProduct({{1048576}, {512}, {1, 2, 4, 8, 16, 32, 64}})
+    ->Unit(benchmark::TimeUnit::kMicrosecond);
+#endif
+
 }  // namespace benchmarks::net::inet::udp
@@ -0,0 +1,76 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <format>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "net/inet/ip.hpp"
+#include "net/inet6/ip.hpp"
+
+namespace benchmarks::net::inet6 {
+
+namespace {
+
+// NOTE: the peers of a dual-stack listener, half of them IPv4-mapped
+std::vector<core::net::inet6::ip> make_peers(std::size_t size) {
+  std::mt19937 random(0);
+  std::vector<core::net::inet6::ip> peers;
+  peers.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    const core::net::inet::ip ip(static_cast<std::uint32_t>(random()));
+    peers.push_back(i % 2 == 0 ? core::net::inet6::ip(ip)
+                               : *core::net::inet6::ip::parse(std::format(
+                                     "2001:db8::{:x}", random() & 0xffff)));
+  }
+  return peers;
+}
+
+}  // namespace
+
+// NOTE: the string round trip baseline for BM_net_inet6_ip_to_inet
+void BM_net_inet6_ip_to_inet_string(benchmark::State& state) {
+  const std::vector<core::net::inet6::ip> peers = make_peers(1024);
+  std::size_t i = 0;
+  for (const auto _ : state) {
+    const std::string string = peers[i++ % peers.size()].to_string();
+    benchmark::DoNotOptimize(
+        string.starts_with("::ffff:")
+            ? core::net::inet::ip::parse(std::string_view(string).substr(7))
+            : std::nullopt);
+  }
+}
+BENCHMARK(BM_net_inet6_ip_to_inet_string);
+
+void BM_net_inet6_ip_to_inet(benchmark::State& state) {
+  const std::vector<core::net::inet6::ip> peers = make_peers(1024);
+  std::size_t i = 0;
+  for (const auto _ : state) {
+    benchmark::DoNotOptimize(peers[i++ % peers.size()].to_inet());
+  }
+}
+BENCHMARK(BM_net_inet6_ip_to_inet);
+
+void BM_net_inet6_ip_from_inet(benchmark::State& state) {
+  std::uint32_t bytes = 0;
+  for (const auto _ : state) {
+    benchmark::DoNotOptimize(
+        core::net::inet6::ip(core::net::inet::ip(bytes++)));
+  }
+}
+BENCHMARK(BM_net_inet6_ip_from_inet);
+
+void BM_net_inet6_ip_classify(benchmark::State& state) {
+  const std::vector<core::net::inet6::ip> peers = make_peers(1024);
+  std::size_t i = 0;
+  for (const auto _ : state) {
+    const core::net::inet6::ip& ip = peers[i++ % peers.size()];
+    benchmark::DoNotOptimize(ip.is_loopback() || ip.is_link_local() ||
+                             ip.is_unique_local() || ip.is_mapped());
+  }
+}
+BENCHMARK(BM_net_inet6_ip_classify);
+
+}  // namespace benchmarks::net::inet6
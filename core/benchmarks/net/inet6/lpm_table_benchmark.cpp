@@ -0,0 +1,127 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "net/inet6/lpm_table.hpp"
+
+namespace benchmarks::net::inet6 {
+
+namespace {
+
+// NOTE: the global unicast prefixes are announced from 2000::/3 and are
+// mostly /32 to /48 long
+core::net::inet6::ip make_ip(std::mt19937& random) {
+  std::array<std::byte, 16> bytes;
+  for (std::byte& byte : bytes) {
+    byte = static_cast<std::byte>(random());
+  }
+  bytes[0] = (bytes[0] & std::byte(0x1F)) | std::byte(0x20);
+  return core::net::inet6::ip(std::span<const std::byte, 16>(bytes),
+                              core::net::inet6::ip::network_byte_order_t{});
+}
+
+std::vector<std::pair<core::net::inet6::cidr, std::uint32_t>> make_rules(
+    std::size_t size) {
+  std::mt19937 random(0);
+  std::discrete_distribution<std::size_t> lengths{
+      {29, 1, 1, 15, 2, 5, 3, 8, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 50}};
+  std::vector<std::pair<core::net::inet6::cidr, std::uint32_t>> rules;
+  rules.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    rules.emplace_back(
+        core::net::inet6::cidr(make_ip(random), 29 + lengths(random)),
+        static_cast<std::uint32_t>(i));
+  }
+  return rules;
+}
+
+const core::net::inet6::lpm_table& table() {
+  static const core::net::inet6::lpm_table table = [] {
+    core::net::inet6::lpm_table table;
+    table.insert(make_rules(200'000));
+    return table;
+  }();
+  return table;
+}
+
+std::vector<core::net::inet6::ip> make_random_ips(std::size_t size) {
+  std::mt19937 random(1);
+  std::vector<core::net::inet6::ip> ips;
+  ips.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    ips.push_back(make_ip(random));
+  }
+  return ips;
+}
+
+// NOTE: 90% of the lookups hit the addresses of 1024 hot flows
+std::vector<core::net::inet6::ip> make_skewed_ips(std::size_t size) {
+  std::mt19937 random(2);
+  const std::vector<core::net::inet6::ip> hot = make_random_ips(1024);
+  std::vector<core::net::inet6::ip> ips;
+  ips.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    ips.push_back(random() % 10 != 0 ? hot[random() % hot.size()]
+                                     : make_ip(random));
+  }
+  return ips;
+}
+
+constexpr std::size_t kStreamSize = 1 << 20;
+
+}  // namespace
+
+void BM_net_inet6_lpm_table_build(benchmark::State& state) {
+  const std::vector<std::pair<core::net::inet6::cidr, std::uint32_t>> rules =
+      make_rules(state.range(0));
+  for (const auto _ : state) {
+    core::net::inet6::lpm_table table;
+    table.insert(rules);
+    benchmark::DoNotOptimize(table);
+  }
+  state.SetItemsProcessed(state.iterations() * rules.size());
+}
+BENCHMARK(BM_net_inet6_lpm_table_build)
+    ->Arg(200'000)
+    ->Unit(benchmark::kMillisecond);
+
+void BM_net_inet6_lpm_table_lookup_random(benchmark::State& state) {
+  const std::vector<core::net::inet6::ip> ips = make_random_ips(kStreamSize);
+  std::size_t i = 0;
+  for (const auto _ : state) {
+    benchmark::DoNotOptimize(table().lookup(ips[i++ % ips.size()]));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_net_inet6_lpm_table_lookup_random);
+
+void BM_net_inet6_lpm_table_lookup_skewed(benchmark::State& state) {
+  const std::vector<core::net::inet6::ip> ips = make_skewed_ips(kStreamSize);
+  std::size_t i = 0;
+  for (const auto _ : state) {
+    benchmark::DoNotOptimize(table().lookup(ips[i++ % ips.size()]));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_net_inet6_lpm_table_lookup_skewed);
+
+void BM_net_inet6_lpm_table_lookup_batch_random(benchmark::State& state) {
+  const std::vector<core::net::inet6::ip> ips = make_random_ips(kStreamSize);
+  std::vector<std::uint32_t> values(state.range(0));
+  std::size_t i = 0;
+  for (const auto _ : state) {
+    table().lookup(std::span(ips).subspan(i, values.size()), values, 0);
+    benchmark::DoNotOptimize(values.data());
+    i = (i + values.size()) % ips.size();
+  }
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+BENCHMARK(BM_net_inet6_lpm_table_lookup_batch_random)->Arg(1024);
+
+}  // namespace benchmarks::net::inet6
@@ -1,5 +1,9 @@
 #include <benchmark/benchmark.h>
 
+#include <format>
+#include <iterator>
+#include <string>
+
 #include "net/inet6/sockaddr.hpp"
 
 namespace benchmarks::net::inet6 {
@@ -38,4 +42,40 @@ void BM_net_inet6_to_string(benchmark::State& state) {
 }
 BENCHMARK(BM_net_inet6_to_string);
 
+void BM_net_inet6_copy(benchmark::State& state) {
+  const core::net::inet6::sockaddr sockaddr(
+      core::net::inet6::ip("ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff"),
+      core::net::inet::port(0));
+  for (const auto _ : state) {
+    core::net::inet6::sockaddr copy(sockaddr);
+    benchmark::DoNotOptimize(copy);
+  }
+}
+BENCHMARK(BM_net_inet6_copy);
+
+void BM_net_inet6_equality(benchmark::State& state) {
+  const core::net::inet6::sockaddr sockaddr(
+      core::net::inet6::ip("ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff"),
+      core::net::inet::port(0));
+  const core::net::inet6::sockaddr other(sockaddr);
+  for (const auto _ : state) {
+    benchmark::DoNotOptimize(sockaddr == other);
+  }
+}
+BENCHMARK(BM_net_inet6_equality);
+
+void BM_net_inet6_format(benchmark::State& state) {
+  const core::net::inet6::sockaddr sockaddr(
+      core::net::inet6::ip("2001:db8:85a3::8a2e:370:7334"),
+      core::net::inet::port(65535));
+  std::string string;
+  string.reserve(core::net::sockets::base_sockaddr::kMaxStringSize);
+  for (const auto _ : state) {
+    string.clear();
+    std::format_to(std::back_inserter(string), "{}", sockaddr);
+    benchmark::DoNotOptimize(string.data());
+  }
+}
+BENCHMARK(BM_net_inet6_format);
+
 }  // namespace benchmarks::net::inet6
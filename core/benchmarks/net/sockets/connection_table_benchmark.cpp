@@ -0,0 +1,132 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "net/inet/four_tuple.hpp"
+#include "net/inet/sockaddr.hpp"
+#include "net/sockets/connection_table.hpp"
+
+namespace benchmarks::net::sockets {
+
+namespace {
+
+std::vector<core::net::inet::sockaddr> make_peers(std::size_t size) {
+  std::mt19937 random(0);
+  std::vector<core::net::inet::sockaddr> peers;
+  peers.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    peers.emplace_back(
+        core::net::inet::ip(static_cast<std::uint32_t>(random())),
+        core::net::inet::port(static_cast<std::uint16_t>(random())));
+  }
+  return peers;
+}
+
+const core::net::inet::sockaddr& local() {
+  static const core::net::inet::sockaddr local(
+      core::net::inet::ip::kLoopback(), core::net::inet::port(8080));
+  return local;
+}
+
+}  // namespace
+
+// NOTE: the lookup of a session by the address of a received datagram as done
+// with the string keys
+void BM_net_sockets_unordered_map_string_find(benchmark::State& state) {
+  const std::vector<core::net::inet::sockaddr> peers =
+      make_peers(state.range(0));
+  std::unordered_map<std::string, std::size_t> sessions;
+  for (std::size_t i = 0; i < peers.size(); ++i) {
+    sessions.emplace(local().to_string() + peers[i].to_string(), i);
+  }
+
+  std::size_t i = 0;
+  for (const auto _ : state) {
+    const auto& peer = peers[i++ % peers.size()];
+    benchmark::DoNotOptimize(
+        sessions.find(local().to_string() + peer.to_string()));
+  }
+}
+BENCHMARK(BM_net_sockets_unordered_map_string_find)->Arg(1024)->Arg(65536);
+
+void BM_net_sockets_connection_table_find(benchmark::State& state) {
+  const std::vector<core::net::inet::sockaddr> peers =
+      make_peers(state.range(0));
+  core::net::sockets::connection_table<core::net::inet::four_tuple,
+                                       std::size_t>
+      sessions(peers.size());
+  for (std::size_t i = 0; i < peers.size(); ++i) {
+    sessions.try_emplace(core::net::inet::four_tuple(local(), peers[i]), i);
+  }
+
+  std::size_t i = 0;
+  for (const auto _ : state) {
+    const auto& peer = peers[i++ % peers.size()];
+    benchmark::DoNotOptimize(
+        sessions.find(core::net::inet::four_tuple(local(), peer)));
+  }
+}
+BENCHMARK(BM_net_sockets_connection_table_find)->Arg(1024)->Arg(65536);
+
+void BM_net_sockets_unordered_map_four_tuple_churn(benchmark::State& state) {
+  const std::vector<core::net::inet::sockaddr> peers =
+      make_peers(state.range(0));
+  std::unordered_map<core::net::inet::four_tuple, std::size_t> sessions;
+  sessions.reserve(peers.size());
+
+  std::size_t i = 0;
+  for (const auto _ : state) {
+    const auto& peer = peers[i++ % peers.size()];
+    const core::net::inet::four_tuple tuple(local(), peer);
+    if (!sessions.try_emplace(tuple, i).second) {
+      sessions.erase(tuple);
+    }
+  }
+}
+BENCHMARK(BM_net_sockets_unordered_map_four_tuple_churn)
+    ->Arg(1024)
+    ->Arg(65536);
+
+void BM_net_sockets_connection_table_churn(benchmark::State& state) {
+  const std::vector<core::net::inet::sockaddr> peers =
+      make_peers(state.range(0));
+  core::net::sockets::connection_table<core::net::inet::four_tuple,
+                                       std::size_t>
+      sessions(peers.size());
+
+  std::size_t i = 0;
+  for (const auto _ : state) {
+    const auto& peer = peers[i++ % peers.size()];
+    const core::net::inet::four_tuple tuple(local(), peer);
+    if (!sessions.try_emplace(tuple, i).second) {
+      sessions.erase(tuple);
+    }
+  }
+}
+BENCHMARK(BM_net_sockets_connection_table_churn)->Arg(1024)->Arg(65536);
+
+void BM_net_sockets_connection_table_iterate(benchmark::State& state) {
+  const std::vector<core::net::inet::sockaddr> peers =
+      make_peers(state.range(0));
+  core::net::sockets::connection_table<core::net::inet::four_tuple,
+                                       std::size_t>
+      sessions(peers.size());
+  for (std::size_t i = 0; i < peers.size(); ++i) {
+    sessions.try_emplace(core::net::inet::four_tuple(local(), peers[i]), i);
+  }
+
+  for (const auto _ : state) {
+    std::size_t sum = 0;
+    for (const auto& [tuple, value] : sessions) {
+      sum += value;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * sessions.size());
+}
+BENCHMARK(BM_net_sockets_connection_table_iterate)->Arg(65536);
+
+}  // namespace benchmarks::net::sockets
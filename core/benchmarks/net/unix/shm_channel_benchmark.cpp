@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+
+#include <thread>
+
+#include "net/unix/shm_channel.hpp"
+
+namespace benchmarks::net::unix {
+
+namespace {
+
+std::pair<core::net::unix::stream::socket, core::net::unix::stream::socket>
+connect(const core::net::unix::sockaddr& sockaddr) {
+  core::net::unix::stream::socket listener;
+  listener.unlink_bind(sockaddr);
+  listener.listen(1);
+  core::net::unix::stream::socket client;
+  client.connect(sockaddr);
+  core::net::unix::stream::socket peer(core::utils::uninitialized_t{});
+  listener.accept(peer);
+  return {std::move(client), std::move(peer)};
+}
+
+}  // namespace
+
+void BM_net_unix_shm_channel_ping_pong(benchmark::State& state) {
+  const std::size_t message_size = state.range(0);
+
+  auto [client, peer] = connect(
+      core::net::unix::sockaddr("BM_net_unix_shm_channel_ping_pong"));
+  core::net::unix::shm_channel channel(std::move(client), 1 << 16);
+  core::net::unix::shm_channel echo(std::move(peer));
+
+  std::thread echo_thread([&echo, message_size] {
+    std::vector<std::byte> buffer(message_size);
+    try {
+      while (true) {
+        echo.send(std::span(buffer).first(echo.receive(buffer)));
+      }
+    } catch (...) {
+    }
+  });
+
+  std::vector<std::byte> buffer(message_size);
+  for (const auto _ : state) {
+    channel.send(buffer);
+    channel.receive(buffer);
+  }
+  state.SetBytesProcessed(state.iterations() * message_size);
+
+  // NOTE: the echo thread leaves once the peer goes away
+  { core::net::unix::shm_channel closed(std::move(channel)); }
+  echo_thread.join();
+}
+BENCHMARK(BM_net_unix_shm_channel_ping_pong)
+    ->Arg(64)
+    ->Arg(1024)
+    ->Unit(benchmark::TimeUnit::kMicrosecond);
+
+void BM_net_unix_shm_channel_throughput(benchmark::State& state) {
+  const std::size_t message_size = state.range(0);
+
+  auto [client, peer] = connect(
+      core::net::unix::sockaddr("BM_net_unix_shm_channel_throughput"));
+  core::net::unix::shm_channel channel(std::move(client), 1 << 20);
+  core::net::unix::shm_channel sink(std::move(peer));
+
+  std::thread sink_thread([&sink, message_size] {
+    std::vector<std::byte> buffer(message_size);
+    try {
+      while (true) {
+        sink.receive(buffer);
+      }
+    } catch (...) {
+    }
+  });
+
+  std::vector<std::byte> buffer(message_size);
+  for (const auto _ : state) {
+    channel.send(buffer);
+  }
+  state.SetBytesProcessed(state.iterations() * message_size);
+
+  { core::net::unix::shm_channel closed(std::move(channel)); }
+  sink_thread.join();
+}
+BENCHMARK(BM_net_unix_shm_channel_throughput)
+    ->Arg(64)
+    ->Arg(1024)
+    ->Unit(benchmark::TimeUnit::kMicrosecond);
+
+}  // namespace benchmarks::net::unix
@@ -21,4 +21,24 @@ void BM_net_unix_to_string(benchmark::State& state) {
 }
 BENCHMARK(BM_net_unix_to_string);
 
+void BM_net_unix_copy(benchmark::State& state) {
+  const core::net::unix::sockaddr sockaddr(
+      "BM_net_unix_from_string_unix_sockaddr");
+  for (const auto _ : state) {
+    core::net::unix::sockaddr copy(sockaddr);
+    benchmark::DoNotOptimize(copy);
+  }
+}
+BENCHMARK(BM_net_unix_copy);
+
+void BM_net_unix_equality(benchmark::State& state) {
+  const core::net::unix::sockaddr sockaddr(
+      "BM_net_unix_from_string_unix_sockaddr");
+  const core::net::unix::sockaddr other(sockaddr);
+  for (const auto _ : state) {
+    benchmark::DoNotOptimize(sockaddr == other);
+  }
+}
+BENCHMARK(BM_net_unix_equality);
+
 }  // namespace benchmarks::net::unix
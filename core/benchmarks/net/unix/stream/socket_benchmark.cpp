@@ -1,5 +1,7 @@
 #include <benchmark/benchmark.h>
 
+#include <thread>
+
 #include "net/unix/sockaddr.hpp"
 #include "net/unix/stream/socket.hpp"
 
@@ -75,4 +77,42 @@ BENCHMARK(BM_net_unix_stream_throughput)
     ->Args({1048576, 128})
     ->Unit(benchmark::TimeUnit::kMicrosecond);
 
+void BM_net_unix_stream_ping_pong(benchmark::State& state) {
+  const std::size_t message_size = state.range(0);
+
+  const core::net::unix::sockaddr sockaddr("BM_net_unix_stream_ping_pong");
+  core::net::unix::stream::socket listener;
+  listener.unlink_bind(sockaddr);
+  listener.listen(1);
+  core::net::unix::stream::socket socket;
+  socket.connect(sockaddr);
+  core::net::unix::stream::socket echo(core::utils::uninitialized_t{});
+  listener.accept(echo);
+
+  std::thread echo_thread([&echo, message_size] {
+    std::vector<std::byte> buffer(message_size);
+    std::size_t received;
+    while ((received = echo.receive(buffer)) != 0) {
+      echo.send(std::span(buffer).first(received));
+    }
+  });
+
+  std::vector<std::byte> buffer(message_size);
+  for (const auto _ : state) {
+    socket.send(buffer);
+    std::size_t received = 0;
+    while (received < message_size) {
+      received += socket.receive(std::span(buffer).subspan(received));
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * message_size);
+
+  socket.close();
+  echo_thread.join();
+}
+BENCHMARK(BM_net_unix_stream_ping_pong)
+    ->Arg(64)
+    ->Arg(1024)
+    ->Unit(benchmark::TimeUnit::kMicrosecond);
+
 }  // namespace benchmarks::net::unix::stream
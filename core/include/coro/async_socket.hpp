@@ -0,0 +1,167 @@
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <span>
+
+#include "io/poller.hpp"
+#include "net/sockets/base_socket.hpp"
+#include "utils/mixins.hpp"
+
+namespace core::coro {
+
+// NOTE: awaitable operations on a nonblocking socket driven by the poller. The
+// operations attempt the syscall first and only suspend the coroutine until
+// the poller reports the readiness, no memory is allocated per operation. At
+// most one operation per direction i.e. one of receive() and accept() and one
+// of send() and connect() may be pending at a time. The socket and the poller
+// must outlive the async_socket and the poller must dispatch the events of
+// the registrations made by async_socket to dispatch()
+class async_socket final : public utils::non_copyable {
+ public:
+  class operation;
+  class receive_operation;
+  class send_operation;
+  class accept_operation;
+  class connect_operation;
+
+ public:
+  async_socket(io::poller& poller, net::sockets::base_socket& socket) noexcept;
+  ~async_socket() noexcept;
+
+ public:
+  // NOTE: resumes the coroutines awaiting the socket registered with the data
+  // pointer. Suitable as the poller callback itself or to be called from it
+  static void dispatch(io::poller& poller, const io::fd& fd,
+                       io::poller::events_t events, void* data);
+
+ public:
+  // NOTE: completes with 0 only at the end of the stream
+  receive_operation async_receive(std::span<std::byte> bytes) noexcept;
+  // NOTE: completes as soon as at least a byte is sent
+  send_operation async_send(std::span<const std::byte> bytes) noexcept;
+  accept_operation async_accept(net::sockets::base_socket& socket) noexcept;
+  connect_operation async_connect(
+      const net::sockets::base_sockaddr& sockaddr) noexcept;
+
+ private:
+  void suspend(operation& awaiting);
+  void update(bool keep);
+
+ private:
+  io::poller& poller_;
+  net::sockets::base_socket& socket_;
+  operation* reader_ = nullptr;
+  operation* writer_ = nullptr;
+  io::poller::events_t registered_ = 0;
+};
+
+class async_socket::operation {
+ protected:
+  // NOTE: attempt() returns true once the operation is complete
+  using attempt_t = bool (*)(operation& operation);
+
+  operation(async_socket& socket, io::poller::events_t events,
+            attempt_t attempt) noexcept
+      : socket_(socket), attempt_(attempt), events_(events) {}
+
+ public:
+  bool await_ready() { return attempt_(*this); }
+  void await_suspend(std::coroutine_handle<> handle) {
+    handle_ = handle;
+    socket_.suspend(*this);
+  }
+
+ protected:
+  net::sockets::base_socket& get_socket() const noexcept {
+    return socket_.socket_;
+  }
+  void rethrow() const {
+    if (exception_) [[unlikely]] {
+      std::rethrow_exception(exception_);
+    }
+  }
+
+ private:
+  friend class async_socket;
+
+  async_socket& socket_;
+  attempt_t attempt_;
+  std::coroutine_handle<> handle_;
+  std::exception_ptr exception_;
+  io::poller::events_t events_;
+};
+
+class async_socket::receive_operation final : public async_socket::operation {
+ public:
+  receive_operation(async_socket& socket, std::span<std::byte> bytes) noexcept;
+
+ public:
+  std::size_t await_resume() const {
+    rethrow();
+    return received_;
+  }
+
+ private:
+  static bool attempt(operation& operation);
+
+ private:
+  std::span<std::byte> bytes_;
+  std::size_t received_ = 0;
+};
+
+class async_socket::send_operation final : public async_socket::operation {
+ public:
+  send_operation(async_socket& socket,
+                 std::span<const std::byte> bytes) noexcept;
+
+ public:
+  std::size_t await_resume() const {
+    rethrow();
+    return sent_;
+  }
+
+ private:
+  static bool attempt(operation& operation);
+
+ private:
+  std::span<const std::byte> bytes_;
+  std::size_t sent_ = 0;
+};
+
+class async_socket::accept_operation final : public async_socket::operation {
+ public:
+  accept_operation(async_socket& socket,
+                   net::sockets::base_socket& accepted) noexcept;
+
+ public:
+  void await_resume() const { rethrow(); }
+
+ private:
+  static bool attempt(operation& operation);
+
+ private:
+  net::sockets::base_socket& accepted_;
+};
+
+class async_socket::connect_operation final : public async_socket::operation {
+ public:
+  connect_operation(async_socket& socket,
+                    const net::sockets::base_sockaddr& sockaddr) noexcept;
+
+ public:
+  net::sockets::base_socket::connection_status await_resume() const {
+    rethrow();
+    return status_;
+  }
+
+ private:
+  static bool attempt(operation& operation);
+
+ private:
+  const net::sockets::base_sockaddr& sockaddr_;
+  net::sockets::base_socket::connection_status status_ =
+      net::sockets::base_socket::connection_status::kPending;
+};
+
+}  // namespace core::coro
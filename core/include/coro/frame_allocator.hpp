@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstddef>
+
+namespace core::coro {
+
+// NOTE: recycling allocator of the coroutine frames. Frames are rounded up to
+// the size classes of 64 bytes and kept in the thread local free lists after
+// deallocation so that a steady state of the coroutines creation does not
+// reach the global allocator. Frames larger than 4096 bytes are not recycled.
+// A frame might be deallocated on a thread other than the allocating one
+void* allocate_frame(std::size_t size);
+void deallocate_frame(void* frame, std::size_t size) noexcept;
+
+}  // namespace core::coro
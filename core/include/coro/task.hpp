@@ -0,0 +1,177 @@
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+#include "coro/frame_allocator.hpp"
+#include "utils/mixins.hpp"
+
+namespace core::coro {
+
+template <typename T>
+class task;
+
+namespace detail {
+
+class promise_base {
+ public:
+  // NOTE: the awaiting coroutine is resumed here only if the task completes
+  // after a suspension. A synchronously completed task leaves the resumption
+  // to the awaiter so that a loop awaiting such tasks does not grow the stack
+  // on the compilers not guaranteeing the tail call of the symmetric transfer
+  struct final_awaiter final {
+    constexpr bool await_ready() const noexcept { return false; }
+
+    template <typename Promise>
+    void await_suspend(std::coroutine_handle<Promise> handle) const noexcept {
+      promise_base& promise = handle.promise();
+      if (std::exchange(promise.suspended_, true)) {
+        promise.continuation_.resume();
+      }
+    }
+
+    constexpr void await_resume() const noexcept {}
+  };
+
+ public:
+  static void* operator new(std::size_t size) { return allocate_frame(size); }
+  static void operator delete(void* frame, std::size_t size) noexcept {
+    deallocate_frame(frame, size);
+  }
+
+ public:
+  std::suspend_always initial_suspend() const noexcept { return {}; }
+  final_awaiter final_suspend() const noexcept { return {}; }
+  void unhandled_exception() noexcept { exception_ = std::current_exception(); }
+
+ public:
+  // NOTE: starts the task and returns a boolean indicating whether the
+  // awaiting coroutine must be suspended until the task completes
+  bool start(std::coroutine_handle<> handle,
+             std::coroutine_handle<> continuation) noexcept {
+    continuation_ = continuation;
+    handle.resume();
+    return !std::exchange(suspended_, true);
+  }
+
+ protected:
+  void rethrow() const {
+    if (exception_) [[unlikely]] {
+      std::rethrow_exception(exception_);
+    }
+  }
+
+ private:
+  std::coroutine_handle<> continuation_;
+  std::exception_ptr exception_;
+  bool suspended_ = false;
+};
+
+template <typename T>
+class promise final : public promise_base {
+ public:
+  task<T> get_return_object() noexcept;
+
+  template <typename U = T>
+  void return_value(U&& value) {
+    value_.emplace(std::forward<U>(value));
+  }
+
+  T get_result() {
+    rethrow();
+    return std::move(*value_);
+  }
+
+ private:
+  std::optional<T> value_;
+};
+
+template <>
+class promise<void> final : public promise_base {
+ public:
+  task<void> get_return_object() noexcept;
+
+  void return_void() const noexcept {}
+
+  void get_result() const { rethrow(); }
+};
+
+}  // namespace detail
+
+// NOTE: lazily started coroutine producing a value of type T. The coroutine
+// starts when the task is awaited and resumes the awaiting coroutine on
+// completion. Exceptions are rethrown to the awaiting coroutine. Frames are
+// allocated with the recycling frame allocator
+template <typename T = void>
+class [[nodiscard]] task final : public utils::non_copyable {
+ public:
+  using promise_type = detail::promise<T>;
+  using handle_t = std::coroutine_handle<promise_type>;
+
+ public:
+  explicit task(handle_t handle) noexcept : handle_(handle) {}
+  task(task&& that) noexcept : handle_(std::exchange(that.handle_, {})) {}
+  task& operator=(task&& that) noexcept {
+    if (this != &that) {
+      if (handle_) {
+        handle_.destroy();
+      }
+      handle_ = std::exchange(that.handle_, {});
+    }
+    return *this;
+  }
+  ~task() noexcept {
+    if (handle_) {
+      handle_.destroy();
+    }
+  }
+
+ public:
+  bool done() const noexcept { return !handle_ || handle_.done(); }
+
+ public:
+  auto operator co_await() && noexcept {
+    struct awaiter final {
+      handle_t handle;
+
+      bool await_ready() const noexcept { return !handle || handle.done(); }
+
+      bool await_suspend(std::coroutine_handle<> continuation) const noexcept {
+        return handle.promise().start(handle, continuation);
+      }
+
+      T await_resume() const { return handle.promise().get_result(); }
+    };
+    return awaiter{handle_};
+  }
+
+ public:
+  // NOTE: gives up the ownership of the coroutine frame without starting it
+  handle_t release() noexcept { return std::exchange(handle_, {}); }
+
+ private:
+  handle_t handle_;
+};
+
+namespace detail {
+
+template <typename T>
+task<T> promise<T>::get_return_object() noexcept {
+  return task<T>(std::coroutine_handle<promise<T>>::from_promise(*this));
+}
+
+inline task<void> promise<void>::get_return_object() noexcept {
+  return task<void>(std::coroutine_handle<promise<void>>::from_promise(*this));
+}
+
+}  // namespace detail
+
+// NOTE: starts the task on the calling thread and runs it until the first
+// suspension. The frame is destroyed when the task completes. Exceptions
+// escaping the task are silently dropped, await the task from another one to
+// observe them
+void spawn(task<void> task);
+
+}  // namespace core::coro
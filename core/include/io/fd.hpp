@@ -1,14 +1,22 @@
 #pragma once
 
+#include <cstdint>
+#include <span>
+
+#include "io/iovec.hpp"
 #include "utils/static_pimpl.hpp"
 #include "utils/tags.hpp"
 
 namespace core::io {
 
 class poller;
+class splice_pipe;
+class uring;
 class fd {
  private:
   friend class poller;
+  friend class splice_pipe;
+  friend class uring;
 
  public:
   static const fd& kStdin() noexcept;
@@ -44,8 +52,37 @@ class fd {
   // in an exception
   void close();
 
+ public:
+  // NOTE: scatter/gather I/O with readv()/writev(). The number of transferred
+  // bytes is returned which may be less than the total length of the iovecs.
+  // 0 is returned if the descriptor is non-blocking and is not ready. At most
+  // IOV_MAX iovecs are transferred per call, see io::iovec_cursor for the
+  // continuation
+  std::size_t read(std::span<const io::iovec> iovecs) const;
+  std::size_t write(std::span<const io::const_iovec> iovecs) const;
+
+ public:
+  // NOTE: kernel side transfers from a regular file without a round trip
+  // through user space. send_file() writes up to count bytes of file at
+  // offset to this descriptor e.g. a socket (sendfile), copy_file_range()
+  // writes them to this regular file at out_offset (copy_file_range). The
+  // offsets are advanced and the number of transferred bytes is returned which
+  // is 0 if this descriptor is non-blocking and is not ready or at the end of
+  // the file. See io::splice_pipe for the transfers between sockets. Linux
+  // only, throws on the other platforms
+  std::size_t send_file(const io::fd& file, std::uint64_t& offset,
+                        std::size_t count) const;
+  std::size_t copy_file_range(const io::fd& file, std::uint64_t& offset,
+                              std::uint64_t& out_offset,
+                              std::size_t count) const;
+
  protected:
   int get_native_handle() const noexcept;
+  // NOTE: the handle of another descriptor e.g. one passed to a peer
+  static int get_native_handle(const fd& fd) noexcept;
+
+  // NOTE: gives up the ownership of the descriptor without closing it
+  int release() noexcept;
 
  private:
   struct impl;
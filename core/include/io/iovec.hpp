@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <span>
+
+namespace core::io {
+
+// NOTE: a buffer of the scatter/gather I/O. The layout matches struct iovec so
+// that a span of these is passed to the kernel as is. Unlike the POSIX
+// interface the constness of the bytes is kept: io::iovec refers to writable
+// bytes and is what the reads accept while io::const_iovec may refer to
+// constant bytes and is accepted only by the writes
+template <typename Byte>
+struct basic_iovec final {
+  constexpr basic_iovec() noexcept = default;
+  constexpr basic_iovec(std::span<Byte> bytes) noexcept
+      : base(bytes.data()), length(bytes.size()) {}
+
+  Byte* base = nullptr;
+  std::size_t length = 0;
+};
+
+using iovec = basic_iovec<std::byte>;
+using const_iovec = basic_iovec<const std::byte>;
+
+// NOTE: tracks the progress of a vectored transfer over its iovecs. After a
+// partial write (or read) advance() drops the fully transferred iovecs and
+// adjusts the first pending one in place so that get_pending() can be passed
+// to the next call as is
+template <typename Byte>
+class basic_iovec_cursor final {
+ public:
+  explicit basic_iovec_cursor(
+      std::span<io::basic_iovec<Byte>> iovecs) noexcept;
+
+ public:
+  void advance(std::size_t bytes) noexcept;
+
+ public:
+  std::span<const io::basic_iovec<Byte>> get_pending() const noexcept;
+  std::size_t get_pending_bytes() const noexcept;
+  bool is_done() const noexcept;
+
+ private:
+  std::span<io::basic_iovec<Byte>> iovecs_;
+};
+
+extern template class basic_iovec_cursor<std::byte>;
+extern template class basic_iovec_cursor<const std::byte>;
+
+using iovec_cursor = basic_iovec_cursor<std::byte>;
+using const_iovec_cursor = basic_iovec_cursor<const std::byte>;
+
+}  // namespace core::io
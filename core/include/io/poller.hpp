@@ -1,9 +1,12 @@
 #pragma once
 
+#include <chrono>
 #include <functional>
 #include <vector>
 
 #include "io/fd.hpp"
+#include "io/timer_wheel.hpp"
+#include "utils/histogram.hpp"
 #include "utils/mixins.hpp"
 #include "utils/static_pimpl.hpp"
 
@@ -21,35 +24,127 @@ class poller final : public utils::non_copyable {
     kPollErr = 1 << 3,
     kPollHup = 1 << 4,
     kPollNval = 1 << 5,
+    // NOTE: registration-only flag requesting edge-triggered notifications.
+    // Never reported back to the callback. Only supported by kEpoll backend
+    kPollEt = 1 << 6,
   };
   using events_t = std::uint8_t;
-  using callback_t = std::function<void(poller&, const io::fd&, events_t)>;
+  // NOTE: data is the pointer passed to insert_or_assign() on registration
+  using callback_t =
+      std::function<void(poller&, const io::fd&, events_t, void* data)>;
+  using task_t = std::function<void()>;
 
  public:
-  explicit poller(callback_t callback) noexcept;
+  // NOTE: kPoll scans every registered descriptor on each wakeup while kEpoll
+  // keeps the interest list in the kernel so that a wakeup costs O(ready)
+  enum class backend : std::uint8_t {
+    kPoll,
+    kEpoll,
+  };
+#ifdef __linux__
+  static constexpr poller::backend kDefaultBackend = poller::backend::kEpoll;
+#else
+  static constexpr poller::backend kDefaultBackend = poller::backend::kPoll;
+#endif
+
+ public:
+  explicit poller(callback_t callback,
+                  poller::backend backend = kDefaultBackend);
   poller(poller&&) noexcept;
   poller& operator=(poller&&) noexcept;
   ~poller() noexcept;
 
+ public:
+  poller::backend get_backend() const noexcept;
+
  public:
   // NOTE: returns a boolean indicating whether the fd was inserted. Returns
-  // false case of an update. Safe to call from the callback
-  bool insert_or_assign(const io::fd& fd, events_t events);
+  // false case of an update. Registrations are kept in a table indexed by the
+  // descriptor value so the cost does not depend on the number of the
+  // registered descriptors. Safe to call from the callback
+  bool insert_or_assign(const io::fd& fd, events_t events,
+                        void* data = nullptr);
 
   // NOTE: returns a boolean indicating whether the fd was erased. Safe to call
   // from the callback
   bool erase(const io::fd& fd);
 
+ public:
+  // NOTE: busy polling trades a dedicated core for the wakeup latency. With a
+  // non-zero budget the poll() methods spin with nonblocking polls and a pause
+  // backoff for up to the budget before blocking. A non-zero socket_budget is
+  // set as SO_BUSY_POLL on the registered sockets so that the kernel polls the
+  // device queue instead of waiting for the interrupt. Raising SO_BUSY_POLL
+  // above net.core.busy_read requires CAP_NET_ADMIN. Only supported on Linux
+  struct busy_poll final {
+    std::chrono::microseconds budget;
+    std::chrono::microseconds socket_budget;
+  };
+  // NOTE: spin_hits is the number of poll() calls that found the events while
+  // spinning and sleeps is the number of the ones that had to block after the
+  // budget is exhausted
+  struct busy_poll_counters final {
+    std::uint64_t spin_hits;
+    std::uint64_t sleeps;
+  };
+  void set_busy_poll(const poller::busy_poll& busy_poll);
+  poller::busy_poll_counters get_busy_poll_counters() const noexcept;
+
+ public:
+  // NOTE: the instrumentation is compiled in only with the
+  // CORE_IO_POLLER_INSTRUMENTATION definition (see the CMake option of the same
+  // name), otherwise the statistics stay empty and cost nothing. Durations are
+  // in nanoseconds. wait is the time spent in the polling syscalls including
+  // the busy polling, callback is the time of a single callback, events is the
+  // number of the ready descriptors per wakeup and iteration is the time of a
+  // poll() call except for the wait. slowest_data is the data pointer of the
+  // registration with the slowest callback so far
+  struct statistics final {
+    utils::histogram wait;
+    utils::histogram callback;
+    utils::histogram events;
+    utils::histogram iteration;
+    std::chrono::nanoseconds slowest_callback{0};
+    void* slowest_data = nullptr;
+  };
+#ifdef CORE_IO_POLLER_INSTRUMENTATION
+  static constexpr bool kInstrumented = true;
+#else
+  static constexpr bool kInstrumented = false;
+#endif
+
+  // NOTE: get_statistics() returns a snapshot. Neither of the methods is safe
+  // to call from other threads, post() a task to take a snapshot instead
+  poller::statistics get_statistics() const;
+  void reset_statistics() noexcept;
+
+ public:
+  // NOTE: the poll() methods wait for the descriptors no longer than until the
+  // nearest timer deadline and fire the expired timers after dispatching the
+  // descriptor events. Safe to call from the callbacks
+  timer_wheel::timer_id_t schedule(std::chrono::milliseconds timeout,
+                                   timer_wheel::callback_t callback);
+  bool cancel(timer_wheel::timer_id_t timer) noexcept;
+
+ public:
+  // NOTE: the only methods that are safe to call from other threads. Posted
+  // tasks are executed on the polling thread in the order of posting by the
+  // poll() methods which are woken up if blocked. post() spins while there are
+  // too many pending tasks and thus must not be called from the tasks
+  void post(task_t task);
+  bool try_post(task_t task);
+  void wakeup();
+
  public:
   // NOTE: poll() methods return the number of unhandled errors during the event
-  // handling. Any exceptions thrown in the callback function will be silently
-  // dropped and accounted in the return value
+  // and the timer handling. Any exceptions thrown in the callback functions
+  // will be silently dropped and accounted in the return value
   std::size_t try_poll(std::chrono::milliseconds timeout);
   std::size_t poll();
 
  private:
   struct impl;
-  utils::static_pimpl<impl, 88, 8> pimpl_;
+  utils::static_pimpl<impl, 1256, 8> pimpl_;
   callback_t callback_;
 };
 
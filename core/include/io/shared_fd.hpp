@@ -0,0 +1,104 @@
+#pragma once
+
+#include <atomic>
+#include <concepts>
+#include <cstdint>
+#include <utility>
+
+#include "io/fd.hpp"
+
+namespace core::io {
+
+// NOTE: shared ownership of a file descriptor or a socket. Copies share the
+// descriptor and the reference counter allocated next to it so that a copy is
+// an atomic increment instead of a dup() syscall and an extra slot in the
+// descriptor table. The descriptor is closed when the last copy is destroyed.
+// duplicate() explicitly creates a new descriptor for the code that needs one.
+// Similarly to std::shared_ptr the constness of the handle is not propagated
+// to the descriptor and the access to the descriptor is not synchronized
+template <typename T = io::fd>
+  requires std::derived_from<T, io::fd>
+class shared_fd final {
+ public:
+  using value_t = T;
+
+ public:
+  explicit shared_fd(T&& fd)
+      : control_(new control{.references = 1, .fd = std::move(fd)}) {}
+
+  shared_fd(const shared_fd& that) noexcept : control_(that.control_) {
+    acquire();
+  }
+
+  shared_fd& operator=(const shared_fd& that) noexcept {
+    if (control_ != that.control_) {
+      release();
+      control_ = that.control_;
+      acquire();
+    }
+    return *this;
+  }
+
+  shared_fd(shared_fd&& that) noexcept
+      : control_(std::exchange(that.control_, nullptr)) {}
+
+  shared_fd& operator=(shared_fd&& that) noexcept {
+    if (this != &that) {
+      release();
+      control_ = std::exchange(that.control_, nullptr);
+    }
+    return *this;
+  }
+
+  ~shared_fd() noexcept { release(); }
+
+ public:
+  // NOTE: handles are equal if they share the descriptor
+  bool operator==(const shared_fd& that) const noexcept {
+    return control_ == that.control_;
+  }
+  bool operator!=(const shared_fd& that) const noexcept {
+    return !operator==(that);
+  }
+
+ public:
+  // NOTE: a moved from handle is empty and must not be dereferenced
+  explicit operator bool() const noexcept { return control_ != nullptr; }
+  T& operator*() const noexcept { return control_->fd; }
+  T* operator->() const noexcept { return &control_->fd; }
+
+  std::uint32_t use_count() const noexcept {
+    return control_ != nullptr
+               ? control_->references.load(std::memory_order::relaxed)
+               : 0;
+  }
+
+ public:
+  // NOTE: returns a new descriptor referring to the same open file description
+  T duplicate() const { return T(control_->fd); }
+
+ private:
+  struct control final {
+    std::atomic<std::uint32_t> references;
+    T fd;
+  };
+
+  void acquire() noexcept {
+    if (control_ != nullptr) {
+      control_->references.fetch_add(1, std::memory_order::relaxed);
+    }
+  }
+
+  void release() noexcept {
+    if (control_ != nullptr &&
+        control_->references.fetch_sub(1, std::memory_order::acq_rel) == 1) {
+      delete control_;
+    }
+    control_ = nullptr;
+  }
+
+ private:
+  control* control_;
+};
+
+}  // namespace core::io
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <limits>
+#include <optional>
+
+#include "io/fd.hpp"
+#include "utils/mixins.hpp"
+#include "utils/static_pimpl.hpp"
+
+namespace core::io {
+
+// NOTE: an internal pipe pair to move bytes between descriptors that are not
+// pipes themselves e.g. between two sockets of a relay. fill() splices from
+// the source into the pipe and drain() splices from the pipe into the
+// destination so the bytes never reach user space. The bytes that the
+// destination could not accept stay in the pipe and are counted in
+// get_pending(). tee() duplicates the pending bytes into another splice_pipe
+// without consuming them to fan out a stream. All the operations are
+// non-blocking and return the number of bytes moved. drain() and tee() return
+// 0 if a side is not ready while fill() returns 0 at the end of the source and
+// nullopt if the source has nothing to splice yet. Linux only, the
+// constructor throws on the other platforms
+class splice_pipe final : public utils::non_copyable {
+ public:
+  static constexpr std::size_t kUnlimited =
+      std::numeric_limits<std::size_t>::max();
+
+ public:
+  splice_pipe();
+  splice_pipe(splice_pipe&&) noexcept;
+  splice_pipe& operator=(splice_pipe&&) noexcept;
+  ~splice_pipe() noexcept;
+
+ public:
+  std::optional<std::size_t> fill(const io::fd& in,
+                                  std::size_t count = kUnlimited);
+  std::size_t drain(const io::fd& out, std::size_t count = kUnlimited);
+  std::size_t tee(splice_pipe& that, std::size_t count = kUnlimited);
+
+  // NOTE: fill() followed by drain() of everything pending. transfer() returns
+  // the number of bytes drained into out, 0 once the source is at its end and
+  // nothing is pending, and nullopt if no bytes could be moved into out yet
+  std::optional<std::size_t> transfer(const io::fd& in, const io::fd& out,
+                                      std::size_t count = kUnlimited);
+
+ public:
+  std::size_t get_pending() const noexcept;
+
+  // NOTE: the capacity of the pipe bounds the number of bytes moved per call
+  std::size_t get_capacity() const;
+
+ private:
+  struct impl;
+  utils::static_pimpl<impl, 16, 8> pimpl_;
+};
+
+}  // namespace core::io
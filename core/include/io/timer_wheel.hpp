@@ -0,0 +1,58 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+
+#include "utils/mixins.hpp"
+#include "utils/static_pimpl.hpp"
+
+namespace core::io {
+
+// NOTE: hashed hierarchical timing wheel with the millisecond resolution.
+// Timers are kept in intrusive lists of 4 levels of 64 slots each so that
+// schedule() and cancel() are O(1) regardless of the number of the timers.
+// Deadlines further than 2^24 ms in the future are rehashed when reaching the
+// top level
+class timer_wheel final : public utils::non_copyable {
+ public:
+  using clock_t = std::chrono::steady_clock;
+  using callback_t = std::function<void()>;
+  using timer_id_t = std::uint64_t;
+
+ public:
+  explicit timer_wheel(clock_t::time_point now = clock_t::now());
+  timer_wheel(timer_wheel&&) noexcept;
+  timer_wheel& operator=(timer_wheel&&) noexcept;
+  ~timer_wheel() noexcept;
+
+ public:
+  std::size_t size() const noexcept;
+  bool empty() const noexcept;
+
+ public:
+  // NOTE: a timer never fires before its deadline but may fire up to one
+  // millisecond after it. Safe to call from the callback
+  timer_id_t schedule(clock_t::time_point deadline, callback_t callback);
+  timer_id_t schedule(std::chrono::milliseconds timeout, callback_t callback);
+
+  // NOTE: returns a boolean indicating whether the timer was cancelled. Returns
+  // false if the timer has already fired or was cancelled before. Safe to call
+  // from the callback
+  bool cancel(timer_id_t timer) noexcept;
+
+ public:
+  // NOTE: returns the timeout until the next timer might fire suitable for a
+  // poll() call or the negative blocking timeout if there are no timers
+  std::chrono::milliseconds get_timeout(clock_t::time_point now) const noexcept;
+
+  // NOTE: fires all the timers with the deadline before now. Returns the number
+  // of unhandled errors. Any exceptions thrown in the callback functions will
+  // be silently dropped and accounted in the return value
+  std::size_t advance(clock_t::time_point now);
+
+ private:
+  struct impl;
+  utils::static_pimpl<impl, 1112, 8> pimpl_;
+};
+
+}  // namespace core::io
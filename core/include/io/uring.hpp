@@ -0,0 +1,63 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <span>
+
+#include "io/fd.hpp"
+#include "net/sockets/base_sockaddr.hpp"
+#include "net/sockets/base_socket.hpp"
+#include "utils/mixins.hpp"
+#include "utils/static_pimpl.hpp"
+
+namespace core::io {
+
+// NOTE: uring is a completion-based counterpart of the poller on top of
+// io_uring. The operations are only queued by the methods below and are
+// submitted to the kernel by the next try_run() in a single io_uring_enter()
+// call together with waiting for the completions. The buffers, sockets and
+// sockaddrs passed to an operation must outlive its completion
+class uring final : public utils::non_copyable {
+ public:
+  // NOTE: the result is the return value of the equivalent syscall or a
+  // negated errno value in case of an error
+  using callback_t = std::function<void(uring&, std::int32_t result)>;
+
+ public:
+  // NOTE: the number of operations in flight is limited by the size of the
+  // completion queue which is twice the number of submission queue entries
+  explicit uring(std::uint32_t entries);
+  uring(uring&&) noexcept;
+  uring& operator=(uring&&) noexcept;
+  ~uring() noexcept;
+
+ public:
+  // NOTE: on success the accepted connection is assigned to accepted before
+  // the callback is called
+  void accept(const net::sockets::base_socket& socket,
+              net::sockets::base_socket& accepted, callback_t callback);
+  void connect(const net::sockets::base_socket& socket,
+               const net::sockets::base_sockaddr& sockaddr,
+               callback_t callback);
+  void send(const io::fd& fd, std::span<const std::byte> bytes,
+            callback_t callback);
+  void receive(const io::fd& fd, std::span<std::byte> bytes,
+               callback_t callback);
+  void close(io::fd&& fd, callback_t callback);
+
+ public:
+  std::size_t get_pending() const noexcept;
+
+ public:
+  // NOTE: run() methods return the number of unhandled errors during the
+  // completion handling. Any exceptions thrown in the callback functions will
+  // be silently dropped and accounted in the return value
+  std::size_t try_run(std::chrono::milliseconds timeout);
+  std::size_t run();
+
+ private:
+  struct impl;
+  utils::static_pimpl<impl, 144, 8> pimpl_;
+};
+
+}  // namespace core::io
@@ -0,0 +1,172 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "net/inet/ip.hpp"
+#include "utils/hash.hpp"
+
+namespace core::net::inet {
+
+// NOTE: an address prefix e.g. 10.0.0.0/8 or 2001:db8::/32. Works on the
+// bytes of the ip which are kept in the network byte order by both inet::ip
+// and inet6::ip. The host bits are cleared on construction, hence
+// 10.1.2.3/8 is the same prefix as 10.0.0.0/8
+template <typename Ip>
+class basic_cidr final {
+ private:
+  static_assert(std::is_trivially_copyable_v<Ip>);
+
+ public:
+  using ip_t = Ip;
+  using bytes_t = std::array<std::uint8_t, sizeof(ip_t)>;
+
+ public:
+  static constexpr std::size_t kMaxPrefixLength = sizeof(ip_t) * 8;
+  // NOTE: the longest ip followed by /128
+  static constexpr std::size_t kMaxStringSize = ip_t::kMaxStringSize + 4;
+
+ public:
+  constexpr basic_cidr(ip_t ip, std::size_t prefix_length)
+      : ip_(mask(ip, validate(prefix_length))),
+        prefix_length_(static_cast<std::uint8_t>(prefix_length)) {}
+  explicit basic_cidr(std::string_view string)
+      : basic_cidr(parse_or_throw(string)) {}
+
+ public:
+  // NOTE: accepts an ip, a slash and a decimal prefix length without leading
+  // zeros
+  static constexpr std::optional<basic_cidr> parse(
+      std::string_view string) noexcept {
+    const std::size_t slash = string.rfind('/');
+    if (slash == std::string_view::npos) {
+      return std::nullopt;
+    }
+    const std::optional<ip_t> ip = ip_t::parse(string.substr(0, slash));
+    const std::string_view digits = string.substr(slash + 1);
+    if (!ip || digits.empty() || digits.size() > 3 ||
+        (digits.size() > 1 && digits.front() == '0')) {
+      return std::nullopt;
+    }
+    std::size_t prefix_length = 0;
+    for (const char digit : digits) {
+      if (digit < '0' || digit > '9') {
+        return std::nullopt;
+      }
+      prefix_length =
+          prefix_length * 10 + static_cast<std::size_t>(digit - '0');
+    }
+    if (prefix_length > kMaxPrefixLength) {
+      return std::nullopt;
+    }
+    return basic_cidr(*ip, prefix_length);
+  }
+
+ public:
+  constexpr bool operator==(const basic_cidr&) const = default;
+  constexpr bool operator!=(const basic_cidr&) const = default;
+
+ public:
+  constexpr const ip_t& get_ip() const noexcept { return ip_; }
+  constexpr std::size_t get_prefix_length() const noexcept {
+    return prefix_length_;
+  }
+  constexpr bool contains(const ip_t& ip) const noexcept {
+    return mask(ip, prefix_length_) == ip_;
+  }
+
+ public:
+  // NOTE: writes at most kMaxStringSize characters and returns the iterator
+  // past the last one
+  template <std::output_iterator<char> Iterator>
+  constexpr Iterator format_to(Iterator out) const {
+    out = ip_.format_to(out);
+    *out++ = '/';
+    if (prefix_length_ >= 100) {
+      *out++ = static_cast<char>('0' + prefix_length_ / 100);
+    }
+    if (prefix_length_ >= 10) {
+      *out++ = static_cast<char>('0' + prefix_length_ / 10 % 10);
+    }
+    *out++ = static_cast<char>('0' + prefix_length_ % 10);
+    return out;
+  }
+  std::string to_string() const {
+    std::string string(kMaxStringSize, '\0');
+    string.resize(format_to(string.data()) - string.data());
+    return string;
+  }
+
+ private:
+  static constexpr std::size_t validate(std::size_t prefix_length) {
+    if (prefix_length > kMaxPrefixLength) [[unlikely]] {
+      throw std::invalid_argument(
+          std::format("invalid prefix length: {}", prefix_length));
+    }
+    return prefix_length;
+  }
+
+  static constexpr ip_t mask(const ip_t& ip,
+                             std::size_t prefix_length) noexcept {
+    bytes_t bytes = std::bit_cast<bytes_t>(ip);
+    for (std::size_t i = 0; i < bytes.size(); ++i) {
+      const std::size_t bits = i * 8;
+      if (prefix_length <= bits) {
+        bytes[i] = 0;
+      } else if (prefix_length < bits + 8) {
+        bytes[i] &=
+            static_cast<std::uint8_t>(0xff << (bits + 8 - prefix_length));
+      }
+    }
+    return std::bit_cast<ip_t>(bytes);
+  }
+
+  static basic_cidr parse_or_throw(std::string_view string) {
+    const std::optional<basic_cidr> cidr = parse(string);
+    if (!cidr) [[unlikely]] {
+      throw std::invalid_argument(std::format("invalid cidr: {}", string));
+    }
+    return *cidr;
+  }
+
+ private:
+  ip_t ip_;
+  std::uint8_t prefix_length_;
+};
+
+using cidr = basic_cidr<net::inet::ip>;
+
+}  // namespace core::net::inet
+
+template <typename Ip>
+struct std::formatter<core::net::inet::basic_cidr<Ip>> {
+  template <class FormatContext>
+  constexpr auto parse(FormatContext& ctx) const {
+    return ctx.begin();
+  }
+
+  template <class FormatContext>
+  constexpr auto format(const core::net::inet::basic_cidr<Ip>& cidr,
+                        FormatContext& ctx) const {
+    return cidr.format_to(ctx.out());
+  }
+};
+
+template <typename Ip>
+struct std::hash<core::net::inet::basic_cidr<Ip>> {
+  constexpr std::size_t operator()(
+      const core::net::inet::basic_cidr<Ip>& cidr) const noexcept {
+    return core::utils::combine(std::hash<Ip>{}(cidr.get_ip()),
+                                cidr.get_prefix_length());
+  }
+};
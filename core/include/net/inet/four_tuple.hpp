@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "net/inet/ip.hpp"
+#include "net/inet/port.hpp"
+#include "utils/hash.hpp"
+
+namespace core::net::inet {
+
+// NOTE: the addresses of both ends of a connection or of a datagram flow as
+// seen from the local side. The ips go first to keep the tuple packed
+template <typename Ip>
+struct basic_four_tuple final {
+  constexpr basic_four_tuple(Ip local_ip, net::inet::port local_port,
+                             Ip remote_ip,
+                             net::inet::port remote_port) noexcept
+      : local_ip(local_ip),
+        remote_ip(remote_ip),
+        local_port(local_port),
+        remote_port(remote_port) {}
+
+  template <typename Sockaddr>
+  basic_four_tuple(const Sockaddr& local, const Sockaddr& remote) noexcept
+      : basic_four_tuple(local.get_ip(), local.get_port(), remote.get_ip(),
+                         remote.get_port()) {}
+
+  constexpr bool operator==(const basic_four_tuple&) const = default;
+  constexpr bool operator!=(const basic_four_tuple&) const = default;
+
+  Ip local_ip;
+  Ip remote_ip;
+  net::inet::port local_port;
+  net::inet::port remote_port;
+};
+
+using four_tuple = basic_four_tuple<net::inet::ip>;
+
+}  // namespace core::net::inet
+
+template <typename Ip>
+struct std::hash<core::net::inet::basic_four_tuple<Ip>> {
+  std::size_t operator()(
+      const core::net::inet::basic_four_tuple<Ip>& tuple) const noexcept {
+    const std::uint64_t ips = core::utils::combine(
+        std::hash<Ip>{}(tuple.local_ip), std::hash<Ip>{}(tuple.remote_ip));
+    return core::utils::combine(
+        ips, static_cast<std::uint64_t>(tuple.local_port.get_bytes()) << 16 |
+                 tuple.remote_port.get_bytes());
+  }
+};
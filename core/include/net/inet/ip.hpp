@@ -1,7 +1,17 @@
 #pragma once
 
+#include <bit>
+#include <cstddef>
+#include <cstdint>
 #include <format>
+#include <functional>
+#include <iterator>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <vector>
+
+#include "utils/hash.hpp"
 
 namespace core::net::inet {
 
@@ -12,29 +22,143 @@ class ip final {
   static const ip& kAny() noexcept;
   static const ip& kBroadcast() noexcept;
 
+ public:
+  // NOTE: the length of the longest address, 255.255.255.255
+  static constexpr std::size_t kMaxStringSize = 15;
+
  public:
   struct network_byte_order_t final {};
 
  public:
-  explicit ip(std::uint32_t bytes) noexcept;
-  ip(std::uint32_t bytes, network_byte_order_t) noexcept;
+  constexpr explicit ip(std::uint32_t bytes) noexcept
+      : data_(to_network(bytes)) {}
+  constexpr ip(std::uint32_t bytes, network_byte_order_t) noexcept
+      : data_(bytes) {}
   explicit ip(std::string_view string);
 
+ public:
+  // NOTE: accepts exactly four decimal octets without leading zeros like
+  // inet_pton() does. The string does not have to be null terminated
+  static constexpr std::optional<ip> parse(std::string_view string) noexcept;
+  // NOTE: appends the addresses of a newline separated list to ips and throws
+  // on the first invalid line, empty lines are skipped. Parses with SSSE3
+  // when the CPU supports it
+  static void parse_lines(std::string_view lines, std::vector<ip>& ips);
+
  public:
   constexpr bool operator==(const ip&) const = default;
   constexpr bool operator!=(const ip&) const = default;
 
  public:
-  std::uint32_t get_bytes() const noexcept;
-  std::uint32_t get_bytes(network_byte_order_t) const noexcept;
+  constexpr std::uint32_t get_bytes() const noexcept {
+    return to_network(data_);
+  }
+  constexpr std::uint32_t get_bytes(network_byte_order_t) const noexcept {
+    return data_;
+  }
+
+ public:
+  // NOTE: the RFC 6890 special purpose ranges, each is a single compare of
+  // the masked address
+  constexpr bool is_any() const noexcept { return data_ == 0; }
+  constexpr bool is_broadcast() const noexcept { return data_ == 0xffffffff; }
+  // NOTE: 127.0.0.0/8
+  constexpr bool is_loopback() const noexcept {
+    return get_bytes() >> 24 == 127;
+  }
+  // NOTE: 10.0.0.0/8, 172.16.0.0/12 and 192.168.0.0/16
+  constexpr bool is_private() const noexcept {
+    const std::uint32_t bytes = get_bytes();
+    return (bytes >> 24 == 10) | (bytes >> 20 == 0xac1) |
+           (bytes >> 16 == 0xc0a8);
+  }
+  // NOTE: 169.254.0.0/16
+  constexpr bool is_link_local() const noexcept {
+    return get_bytes() >> 16 == 0xa9fe;
+  }
+  // NOTE: 224.0.0.0/4
+  constexpr bool is_multicast() const noexcept {
+    return get_bytes() >> 28 == 0xe;
+  }
 
  public:
+  // NOTE: writes at most kMaxStringSize characters and returns the iterator
+  // past the last one
+  template <std::output_iterator<char> Iterator>
+  constexpr Iterator format_to(Iterator out) const;
   std::string to_string() const;
 
+ private:
+  // NOTE: swaps the byte order on little endian hosts, hence converts both
+  // ways
+  static constexpr std::uint32_t to_network(std::uint32_t bytes) noexcept;
+
  private:
   std::uint32_t data_;
 };
 
+constexpr std::optional<ip> ip::parse(std::string_view string) noexcept {
+  constexpr std::size_t kOctets = 4;
+  constexpr std::size_t kMaxDigits = 3;
+  constexpr std::uint32_t kMaxOctet = 255;
+
+  std::uint32_t bytes = 0;
+  std::size_t i = 0;
+  for (std::size_t octet = 0; octet < kOctets; ++octet) {
+    if (octet != 0) {
+      if (i == string.size() || string[i] != '.') {
+        return std::nullopt;
+      }
+      i += 1;
+    }
+
+    const std::size_t begin = i;
+    std::uint32_t value = 0;
+    while (i < string.size() && i - begin < kMaxDigits && string[i] >= '0' &&
+           string[i] <= '9') {
+      value = value * 10 + static_cast<std::uint32_t>(string[i] - '0');
+      i += 1;
+    }
+    if (i == begin || value > kMaxOctet ||
+        (i - begin > 1 && string[begin] == '0')) {
+      return std::nullopt;
+    }
+    bytes = bytes << 8 | value;
+  }
+  if (i != string.size()) {
+    return std::nullopt;
+  }
+  return ip(bytes);
+}
+
+template <std::output_iterator<char> Iterator>
+constexpr Iterator ip::format_to(Iterator out) const {
+  const std::uint32_t bytes = get_bytes();
+  for (int shift = 24; shift >= 0; shift -= 8) {
+    const std::uint32_t octet = (bytes >> shift) & 0xff;
+    if (octet >= 100) {
+      *out++ = static_cast<char>('0' + octet / 100);
+    }
+    if (octet >= 10) {
+      *out++ = static_cast<char>('0' + octet / 10 % 10);
+    }
+    *out++ = static_cast<char>('0' + octet % 10);
+    if (shift != 0) {
+      *out++ = '.';
+    }
+  }
+  return out;
+}
+
+constexpr std::uint32_t ip::to_network(std::uint32_t bytes) noexcept {
+  if constexpr (std::endian::native == std::endian::big) {
+    return bytes;
+  } else {
+    return (bytes >> 24) | ((bytes >> 8) & 0xff00) | ((bytes << 8) & 0xff0000) |
+           (bytes << 24);
+  }
+}
+
 }  // namespace core::net::inet
 
 template <>
@@ -47,6 +171,15 @@ struct std::formatter<core::net::inet::ip> {
   template <class FormatContext>
   constexpr auto format(const core::net::inet::ip& ip,
                         FormatContext& ctx) const {
-    return std::format_to(ctx.out(), "{}", ip.to_string());
+    return ip.format_to(ctx.out());
+  }
+};
+
+template <>
+struct std::hash<core::net::inet::ip> {
+  constexpr std::size_t operator()(
+      const core::net::inet::ip& ip) const noexcept {
+    return core::utils::mix(
+        ip.get_bytes(core::net::inet::ip::network_byte_order_t{}));
   }
 };
@@ -0,0 +1,403 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "net/inet/cidr.hpp"
+#include "net/sockets/connection_table.hpp"
+
+namespace core::net::inet {
+
+// NOTE: longest prefix match table mapping the addresses to the value of the
+// most specific matching cidr, a multibit trie in the spirit of DIR-24-8. The
+// first 16 bits of the ip index a root array of 64K entries and every
+// following byte indexes a group of 256 entries. A prefix which shares its
+// path past an entry with no other rule is kept in a leaf holding the whole
+// cidr instead of a chain of groups which is only expanded once another rule
+// takes the same path. Hence the sparse long inet6 prefixes take a group per
+// level they share and an inet lookup takes at most 3 dependent memory
+// accesses and an inet6 one at most 15. Every entry keeps the prefix length
+// which set it so that the rules may be inserted and erased in any order
+// touching only the entries they cover. The groups are not released before
+// clear(). The values are meant to be indices e.g. of the routes or the
+// filtering rules
+template <typename Ip>
+class basic_lpm_table final {
+ public:
+  using ip_t = Ip;
+  using cidr_t = net::inet::basic_cidr<ip_t>;
+  using value_t = std::uint32_t;
+
+ public:
+  basic_lpm_table() : root_(kRootSize) {}
+
+ public:
+  // NOTE: replaces the value of an existing rule
+  void insert(const cidr_t& cidr, value_t value) {
+    const auto [rule, inserted] = rules_.try_emplace(cidr, value);
+    if (!inserted) {
+      rule->second = value;
+    }
+
+    const std::size_t prefix_length = cidr.get_prefix_length();
+    const bytes_t bytes = std::bit_cast<bytes_t>(cidr.get_ip());
+    std::size_t group = kRoot;
+    std::size_t level = 0;
+    for (; prefix_length > get_level_end(level); ++level) {
+      const std::size_t i = get_index(bytes, level);
+      const entry current = get_entry(group, i);
+      if (current.type == entry_type::kGroup) {
+        group = current.value;
+      } else if (current.type == entry_type::kLeaf &&
+                 leaves_[current.value].cidr != cidr) {
+        group = expand(group, i, level);
+      } else if (current.type == entry_type::kLeaf) {
+        leaves_[current.value].value = value;
+        return;
+      } else {
+        get_entry(group, i) = entry{
+            .value = make_leaf(leaf{
+                .cidr = cidr,
+                .value = value,
+                .fallback = current,
+                .bytes = bytes,
+                .mask = get_mask(prefix_length),
+            }),
+            .prefix_length = 0,
+            .type = entry_type::kLeaf,
+        };
+        return;
+      }
+    }
+    fill(group, level, bytes,
+         entry{
+             .value = value,
+             .prefix_length = static_cast<std::uint8_t>(prefix_length),
+             .type = entry_type::kValue,
+         });
+  }
+
+  // NOTE: inserts the rules from the shortest to the longest prefixes so
+  // that no entry is written twice, later duplicates win
+  void insert(std::span<const std::pair<cidr_t, value_t>> rules) {
+    std::vector<std::pair<cidr_t, value_t>> sorted(rules.begin(),
+                                                   rules.end());
+    std::stable_sort(sorted.begin(), sorted.end(),
+                     [](const auto& lhs, const auto& rhs) {
+                       return lhs.first.get_prefix_length() <
+                              rhs.first.get_prefix_length();
+                     });
+    rules_.reserve(rules_.size() + sorted.size());
+    for (const auto& [cidr, value] : sorted) {
+      insert(cidr, value);
+    }
+  }
+
+  // NOTE: the entries of the erased rule fall back to the longest rule
+  // covering it
+  bool erase(const cidr_t& cidr) {
+    if (!rules_.erase(cidr)) {
+      return false;
+    }
+
+    const std::size_t prefix_length = cidr.get_prefix_length();
+    const bytes_t bytes = std::bit_cast<bytes_t>(cidr.get_ip());
+    std::size_t group = kRoot;
+    std::size_t level = 0;
+    for (; prefix_length > get_level_end(level); ++level) {
+      entry& current = get_entry(group, get_index(bytes, level));
+      if (current.type == entry_type::kLeaf) {
+        // NOTE: no other rule shares the path of the leaf so that it is the
+        // erased one and its fallback is the longest rule covering it
+        const std::size_t index = current.value;
+        current = leaves_[index].fallback;
+        free_leaves_.push_back(static_cast<value_t>(index));
+        return true;
+      }
+      group = current.value;
+    }
+
+    entry fallback{};
+    for (std::size_t length = prefix_length; length-- > 0;) {
+      const auto rule = rules_.find(cidr_t(cidr.get_ip(), length));
+      if (rule != rules_.end()) {
+        fallback = entry{
+            .value = rule->second,
+            .prefix_length = static_cast<std::uint8_t>(length),
+            .type = entry_type::kValue,
+        };
+        break;
+      }
+    }
+
+    const std::size_t span = std::size_t(1)
+                             << (get_level_end(level) - prefix_length);
+    const std::size_t first = get_index(bytes, level) & ~(span - 1);
+    for (std::size_t i = first; i < first + span; ++i) {
+      reset(group, i, prefix_length, fallback);
+    }
+    return true;
+  }
+
+  void clear() noexcept {
+    std::fill(root_.begin(), root_.end(), entry{});
+    groups_.clear();
+    leaves_.clear();
+    free_leaves_.clear();
+    rules_.clear();
+  }
+
+ public:
+  std::optional<value_t> lookup(const ip_t& ip) const noexcept {
+    const bytes_t bytes = std::bit_cast<bytes_t>(ip);
+    entry current = root_[get_index(bytes, 0)];
+    for (std::size_t level = 1; current.type == entry_type::kGroup; ++level) {
+      current = groups_[current.value * kGroupSize + get_index(bytes, level)];
+    }
+    if (current.type == entry_type::kLeaf) {
+      const leaf& leaf = leaves_[current.value];
+      std::uint8_t difference = 0;
+      for (std::size_t i = 0; i < bytes.size(); ++i) {
+        difference |= (bytes[i] ^ leaf.bytes[i]) & leaf.mask[i];
+      }
+      if (difference == 0) {
+        return leaf.value;
+      }
+      current = leaf.fallback;
+    }
+    if (current.type == entry_type::kValue) {
+      return current.value;
+    }
+    return std::nullopt;
+  }
+
+  // NOTE: writes the value for each ip or miss if none matches. The root
+  // entries of a batch are prefetched before any of them is resolved so that
+  // the cache misses overlap
+  void lookup(std::span<const ip_t> ips, std::span<value_t> values,
+              value_t miss) const {
+    if (values.size() < ips.size()) [[unlikely]] {
+      throw std::invalid_argument(
+          std::format("{} values for {} ips", values.size(), ips.size()));
+    }
+
+    constexpr std::size_t kBatchSize = 16;
+    for (std::size_t begin = 0; begin < ips.size(); begin += kBatchSize) {
+      const std::size_t end = std::min(begin + kBatchSize, ips.size());
+      for (std::size_t i = begin; i < end; ++i) {
+        __builtin_prefetch(
+            &root_[get_index(std::bit_cast<bytes_t>(ips[i]), 0)]);
+      }
+      for (std::size_t i = begin; i < end; ++i) {
+        values[i] = lookup(ips[i]).value_or(miss);
+      }
+    }
+  }
+
+ public:
+  std::size_t size() const noexcept { return rules_.size(); }
+  bool empty() const noexcept { return rules_.empty(); }
+
+ private:
+  using bytes_t = std::array<std::uint8_t, sizeof(ip_t)>;
+
+  enum class entry_type : std::uint8_t {
+    kEmpty,
+    kValue,
+    kGroup,
+    kLeaf,
+  };
+
+  // NOTE: value is the index of the group for the kGroup entries and of the
+  // leaf for the kLeaf ones
+  struct entry final {
+    value_t value = 0;
+    std::uint8_t prefix_length = 0;
+    entry_type type = entry_type::kEmpty;
+  };
+
+  // NOTE: fallback is the entry the leaf replaced which is kept up to date by
+  // the shorter rules so that it matches the ips outside of the cidr. The
+  // bytes and the mask of the cidr are kept for a branchless match
+  struct leaf final {
+    cidr_t cidr;
+    value_t value;
+    entry fallback;
+    bytes_t bytes;
+    bytes_t mask;
+  };
+
+ private:
+  static constexpr std::size_t kRootBits = 16;
+  static constexpr std::size_t kRootSize = std::size_t(1) << kRootBits;
+  static constexpr std::size_t kStrideBits = 8;
+  static constexpr std::size_t kGroupSize = std::size_t(1) << kStrideBits;
+  static constexpr std::size_t kRoot = std::numeric_limits<std::size_t>::max();
+
+ private:
+  // NOTE: the number of the leading bits of the ip resolved by the level
+  static constexpr std::size_t get_level_end(std::size_t level) noexcept {
+    return kRootBits + level * kStrideBits;
+  }
+
+  static constexpr std::size_t get_index(const bytes_t& bytes,
+                                         std::size_t level) noexcept {
+    if (level == 0) {
+      return std::size_t(bytes[0]) << 8 | bytes[1];
+    }
+    return bytes[get_level_end(level - 1) / 8];
+  }
+
+  static constexpr bytes_t get_mask(std::size_t prefix_length) noexcept {
+    bytes_t mask{};
+    for (std::size_t i = 0; i < mask.size() && prefix_length > i * 8; ++i) {
+      const std::size_t bits = std::min<std::size_t>(prefix_length - i * 8, 8);
+      mask[i] = static_cast<std::uint8_t>(0xff00 >> bits);
+    }
+    return mask;
+  }
+
+  entry& get_entry(std::size_t group, std::size_t i) noexcept {
+    return group == kRoot ? root_[i] : groups_[group * kGroupSize + i];
+  }
+
+  // NOTE: returns the group under the entry, creating one which inherits the
+  // entry if there is none
+  std::size_t descend(std::size_t group, std::size_t i) {
+    if (get_entry(group, i).type == entry_type::kGroup) {
+      return get_entry(group, i).value;
+    }
+    if (groups_.size() / kGroupSize >= std::numeric_limits<value_t>::max())
+        [[unlikely]] {
+      throw std::length_error("lpm_table has too many groups");
+    }
+
+    const std::size_t child = groups_.size() / kGroupSize;
+    const entry inherited = get_entry(group, i);
+    groups_.resize(groups_.size() + kGroupSize, inherited);
+    get_entry(group, i) = entry{
+        .value = static_cast<value_t>(child),
+        .prefix_length = 0,
+        .type = entry_type::kGroup,
+    };
+    return child;
+  }
+
+  value_t make_leaf(const leaf& value) {
+    if (!free_leaves_.empty()) {
+      const value_t index = free_leaves_.back();
+      free_leaves_.pop_back();
+      leaves_[index] = value;
+      return index;
+    }
+    if (leaves_.size() >= std::numeric_limits<value_t>::max()) [[unlikely]] {
+      throw std::length_error("lpm_table has too many leaves");
+    }
+    leaves_.push_back(value);
+    return static_cast<value_t>(leaves_.size() - 1);
+  }
+
+  // NOTE: replaces the leaf under the entry of the level with a group which
+  // holds the rule of the leaf one level deeper and returns the group
+  std::size_t expand(std::size_t group, std::size_t i, std::size_t level) {
+    const value_t index = get_entry(group, i).value;
+    get_entry(group, i) = leaves_[index].fallback;
+    const std::size_t child = descend(group, i);
+
+    const leaf& expanded = leaves_[index];
+    const std::size_t prefix_length = expanded.cidr.get_prefix_length();
+    const bytes_t bytes = std::bit_cast<bytes_t>(expanded.cidr.get_ip());
+    if (prefix_length > get_level_end(level + 1)) {
+      get_entry(child, get_index(bytes, level + 1)) = entry{
+          .value = index,
+          .prefix_length = 0,
+          .type = entry_type::kLeaf,
+      };
+    } else {
+      fill(child, level + 1, bytes,
+           entry{
+               .value = expanded.value,
+               .prefix_length = static_cast<std::uint8_t>(prefix_length),
+               .type = entry_type::kValue,
+           });
+      free_leaves_.push_back(index);
+    }
+    return child;
+  }
+
+  // NOTE: assigns the entries of the group covered by the rule ending at the
+  // level
+  void fill(std::size_t group, std::size_t level, const bytes_t& bytes,
+            const entry& value) {
+    const std::size_t span = std::size_t(1)
+                             << (get_level_end(level) - value.prefix_length);
+    const std::size_t first = get_index(bytes, level) & ~(span - 1);
+    for (std::size_t i = first; i < first + span; ++i) {
+      assign(group, i, value);
+    }
+  }
+
+  // NOTE: a longer prefix which already covers the entry is kept
+  void assign(std::size_t group, std::size_t i, const entry& value) {
+    entry& current = get_entry(group, i);
+    if (current.type == entry_type::kGroup) {
+      const std::size_t child = current.value;
+      for (std::size_t j = 0; j < kGroupSize; ++j) {
+        assign(child, j, value);
+      }
+    } else if (current.type == entry_type::kLeaf) {
+      entry& fallback = leaves_[current.value].fallback;
+      if (fallback.type == entry_type::kEmpty ||
+          fallback.prefix_length <= value.prefix_length) {
+        fallback = value;
+      }
+    } else if (current.type == entry_type::kEmpty ||
+               current.prefix_length <= value.prefix_length) {
+      current = value;
+    }
+  }
+
+  void reset(std::size_t group, std::size_t i, std::size_t prefix_length,
+             const entry& fallback) {
+    entry& current = get_entry(group, i);
+    if (current.type == entry_type::kGroup) {
+      const std::size_t child = current.value;
+      for (std::size_t j = 0; j < kGroupSize; ++j) {
+        reset(child, j, prefix_length, fallback);
+      }
+    } else if (current.type == entry_type::kLeaf) {
+      reset(leaves_[current.value].fallback, prefix_length, fallback);
+    } else {
+      reset(current, prefix_length, fallback);
+    }
+  }
+
+  static void reset(entry& current, std::size_t prefix_length,
+                    const entry& fallback) noexcept {
+    if (current.type == entry_type::kValue &&
+        current.prefix_length == prefix_length) {
+      current = fallback;
+    }
+  }
+
+ private:
+  std::vector<entry> root_;
+  std::vector<entry> groups_;
+  std::vector<leaf> leaves_;
+  std::vector<value_t> free_leaves_;
+  net::sockets::connection_table<cidr_t, value_t> rules_;
+};
+
+using lpm_table = basic_lpm_table<net::inet::ip>;
+
+}  // namespace core::net::inet
@@ -1,11 +1,22 @@
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <format>
+#include <functional>
+#include <iterator>
+#include <string>
+
+#include "utils/hash.hpp"
 
 namespace core::net::inet {
 
 class port final {
+ public:
+  // NOTE: the length of the largest port, 65535
+  static constexpr std::size_t kMaxStringSize = 5;
+
  public:
   struct network_byte_order_t final {};
 
@@ -22,12 +33,31 @@ class port final {
   std::uint16_t get_bytes(network_byte_order_t) const noexcept;
 
  public:
+  // NOTE: writes at most kMaxStringSize digits and returns the iterator past
+  // the last one
+  template <std::output_iterator<char> Iterator>
+  constexpr Iterator format_to(Iterator out) const;
   std::string to_string() const noexcept;
 
  private:
   std::uint16_t port_;
 };
 
+template <std::output_iterator<char> Iterator>
+constexpr Iterator port::format_to(Iterator out) const {
+  std::array<char, kMaxStringSize> digits{};
+  std::size_t size = 0;
+  std::uint32_t value = port_;
+  do {
+    digits[size++] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while (value != 0);
+  while (size != 0) {
+    *out++ = digits[--size];
+  }
+  return out;
+}
+
 }  // namespace core::net::inet
 
 template <>
@@ -40,6 +70,13 @@ struct std::formatter<core::net::inet::port> {
   template <class FormatContext>
   constexpr auto format(const core::net::inet::port& port,
                         FormatContext& ctx) const {
-    return std::format_to(ctx.out(), "{}", port.to_string());
+    return port.format_to(ctx.out());
+  }
+};
+
+template <>
+struct std::hash<core::net::inet::port> {
+  std::size_t operator()(const core::net::inet::port& port) const noexcept {
+    return core::utils::mix(port.get_bytes());
   }
 };
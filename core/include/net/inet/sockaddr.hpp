@@ -6,7 +6,8 @@
 
 namespace core::net::inet {
 
-class sockaddr final : public net::sockets::base_sockaddr {
+class sockaddr final
+    : public net::sockets::basic_sockaddr<net::sockets::family::kInet> {
  public:
   sockaddr(net::inet::ip ip, net::inet::port port);
 
@@ -27,6 +28,12 @@ struct std::formatter<core::net::inet::sockaddr> {
   template <class FormatContext>
   constexpr auto format(const core::net::inet::sockaddr& sockaddr,
                         FormatContext& ctx) const {
-    return std::format_to(ctx.out(), "{}", sockaddr.to_string());
+    std::array<char, core::net::sockets::base_sockaddr::kMaxStringSize> buffer;
+    return std::copy(buffer.data(), sockaddr.format_to(buffer.data()),
+                     ctx.out());
   }
 };
+
+template <>
+struct std::hash<core::net::inet::sockaddr>
+    : std::hash<core::net::sockets::base_sockaddr> {};
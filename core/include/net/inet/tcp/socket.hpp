@@ -1,13 +1,15 @@
 #pragma once
 
-#include "net/sockets/base_socket.hpp"
+#include "net/tcp/base_socket.hpp"
 
 namespace core::net::inet::tcp {
 
-class socket final : public net::sockets::base_socket {
+class socket final : public net::tcp::base_socket {
  public:
   socket(utils::uninitialized_t) noexcept;
+  explicit socket(io::fd&& fd) noexcept;
   socket();
+  explicit socket(net::sockets::flags_t flags);
 };
 
 }  // namespace core::net::inet::tcp
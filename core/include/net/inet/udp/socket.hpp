@@ -1,13 +1,15 @@
 #pragma once
 
-#include "net/sockets/base_socket.hpp"
+#include "net/udp/base_socket.hpp"
 
 namespace core::net::inet::udp {
 
-class socket final : public net::sockets::base_socket {
+class socket final : public net::udp::base_socket {
  public:
   socket(utils::uninitialized_t) noexcept;
+  explicit socket(io::fd&& fd) noexcept;
   socket();
+  explicit socket(net::sockets::flags_t flags);
 };
 
 }  // namespace core::net::inet::udp
@@ -0,0 +1,10 @@
+#pragma once
+
+#include "net/inet/cidr.hpp"
+#include "net/inet6/ip.hpp"
+
+namespace core::net::inet6 {
+
+using cidr = net::inet::basic_cidr<net::inet6::ip>;
+
+}  // namespace core::net::inet6
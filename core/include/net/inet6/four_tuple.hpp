@@ -0,0 +1,10 @@
+#pragma once
+
+#include "net/inet/four_tuple.hpp"
+#include "net/inet6/ip.hpp"
+
+namespace core::net::inet6 {
+
+using four_tuple = net::inet::basic_four_tuple<net::inet6::ip>;
+
+}  // namespace core::net::inet6
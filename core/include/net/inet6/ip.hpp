@@ -1,8 +1,20 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
 #include <format>
+#include <functional>
+#include <iterator>
+#include <optional>
 #include <span>
 #include <string>
+#include <string_view>
+
+#include "net/inet/ip.hpp"
+#include "utils/hash.hpp"
 
 namespace core::net::inet6 {
 
@@ -12,28 +24,255 @@ class ip final {
   static const ip& kNonRoutable() noexcept;
   static const ip& kAny() noexcept;
 
+ public:
+  // NOTE: the length of the longest address,
+  // ffff:ffff:ffff:ffff:ffff:ffff:255.255.255.255
+  static constexpr std::size_t kMaxStringSize = 45;
+
  public:
   struct network_byte_order_t final {};
 
  public:
-  ip(std::span<const std::byte, 16> bytes, network_byte_order_t) noexcept;
+  constexpr ip(std::span<const std::byte, 16> bytes,
+               network_byte_order_t) noexcept
+      : data_() {
+    std::copy(bytes.begin(), bytes.end(), data_.begin());
+  }
   explicit ip(std::string_view string);
+  // NOTE: the IPv4-mapped address ::ffff:a.b.c.d which a dual-stack socket
+  // uses for the IPv4 peers
+  constexpr explicit ip(const net::inet::ip& ip) noexcept : data_() {
+    const std::uint32_t bytes = ip.get_bytes();
+    data_[10] = std::byte(0xff);
+    data_[11] = std::byte(0xff);
+    data_[12] = static_cast<std::byte>(bytes >> 24);
+    data_[13] = static_cast<std::byte>(bytes >> 16);
+    data_[14] = static_cast<std::byte>(bytes >> 8);
+    data_[15] = static_cast<std::byte>(bytes);
+  }
+
+ public:
+  // NOTE: accepts the RFC 4291 text forms including a single :: and a
+  // trailing dotted-quad like inet_pton() does. The string does not have to
+  // be null terminated
+  static constexpr std::optional<ip> parse(std::string_view string) noexcept;
 
  public:
   constexpr bool operator==(const ip&) const = default;
   constexpr bool operator!=(const ip&) const = default;
 
  public:
-  const std::array<std::byte, 16>& get_bytes(
-      network_byte_order_t) const noexcept;
+  constexpr const std::array<std::byte, 16>& get_bytes(
+      network_byte_order_t) const noexcept {
+    return data_;
+  }
+  // NOTE: the embedded address of an IPv4-mapped one, nullopt otherwise
+  constexpr std::optional<net::inet::ip> to_inet() const noexcept {
+    if (!is_mapped()) {
+      return std::nullopt;
+    }
+    return net::inet::ip(static_cast<std::uint32_t>(get_half(1)));
+  }
+
+ public:
+  // NOTE: the classification compares both halves of the address as 64-bit
+  // words at once without branching on the bytes. The IPv4-mapped addresses
+  // are not classified by their embedded address, see to_inet()
+  constexpr bool is_any() const noexcept {
+    return (get_half(0) | get_half(1)) == 0;
+  }
+  // NOTE: ::1
+  constexpr bool is_loopback() const noexcept {
+    return (get_half(0) | (get_half(1) ^ 1)) == 0;
+  }
+  // NOTE: ::ffff:0:0/96
+  constexpr bool is_mapped() const noexcept {
+    return (get_half(0) | ((get_half(1) >> 32) ^ 0xffff)) == 0;
+  }
+  // NOTE: fe80::/10
+  constexpr bool is_link_local() const noexcept {
+    return get_half(0) >> 54 == 0x3fa;
+  }
+  // NOTE: fc00::/7
+  constexpr bool is_unique_local() const noexcept {
+    return get_half(0) >> 57 == 0x7e;
+  }
+  // NOTE: ff00::/8
+  constexpr bool is_multicast() const noexcept {
+    return get_half(0) >> 56 == 0xff;
+  }
 
  public:
+  // NOTE: writes the RFC 5952 form of at most kMaxStringSize characters and
+  // returns the iterator past the last one. Like inet_ntop() the IPv4-mapped
+  // and IPv4-compatible addresses end with a dotted-quad
+  template <std::output_iterator<char> Iterator>
+  constexpr Iterator format_to(Iterator out) const;
   std::string to_string() const;
 
+ private:
+  static constexpr int from_hex(char c) noexcept;
+  // NOTE: the first or the second 8 bytes as a host order integer which
+  // compiles to a single load and byte swap
+  constexpr std::uint64_t get_half(std::size_t half) const noexcept {
+    const std::uint64_t value =
+        std::bit_cast<std::array<std::uint64_t, 2>>(data_)[half];
+    if constexpr (std::endian::native == std::endian::big) {
+      return value;
+    } else {
+      return __builtin_bswap64(value);
+    }
+  }
+
  private:
   std::array<std::byte, 16> data_;
 };
 
+constexpr int ip::from_hex(char c) noexcept {
+  if (c >= '0' && c <= '9') {
+    return c - '0';
+  }
+  if (c >= 'a' && c <= 'f') {
+    return c - 'a' + 10;
+  }
+  if (c >= 'A' && c <= 'F') {
+    return c - 'A' + 10;
+  }
+  return -1;
+}
+
+constexpr std::optional<ip> ip::parse(std::string_view string) noexcept {
+  constexpr std::size_t kMaxGroupDigits = 4;
+  constexpr std::size_t kInetSize = 4;
+
+  std::array<std::byte, 16> bytes{};
+  std::size_t size = 0;
+  std::optional<std::size_t> gap;
+  std::size_t i = 0;
+  if (string.starts_with("::")) {
+    gap = 0;
+    i = 2;
+  }
+  while (i < string.size()) {
+    if (size == bytes.size()) {
+      return std::nullopt;
+    }
+
+    const std::size_t begin = i;
+    std::uint32_t group = 0;
+    while (i < string.size() && i - begin < kMaxGroupDigits &&
+           from_hex(string[i]) != -1) {
+      group = group << 4 | static_cast<std::uint32_t>(from_hex(string[i]));
+      i += 1;
+    }
+    if (i == begin) {
+      return std::nullopt;
+    }
+    if (i < string.size() && string[i] == '.') {
+      const std::optional<net::inet::ip> inet =
+          net::inet::ip::parse(string.substr(begin));
+      if (!inet || size > bytes.size() - kInetSize) {
+        return std::nullopt;
+      }
+      const std::uint32_t inet_bytes = inet->get_bytes();
+      for (int shift = 24; shift >= 0; shift -= 8) {
+        bytes[size++] = static_cast<std::byte>(inet_bytes >> shift);
+      }
+      break;
+    }
+    bytes[size++] = static_cast<std::byte>(group >> 8);
+    bytes[size++] = static_cast<std::byte>(group);
+
+    if (i == string.size()) {
+      break;
+    }
+    if (string[i] != ':' || i + 1 == string.size()) {
+      return std::nullopt;
+    }
+    i += 1;
+    if (string[i] == ':') {
+      if (gap) {
+        return std::nullopt;
+      }
+      gap = size;
+      i += 1;
+    }
+  }
+
+  if (gap) {
+    // NOTE: :: stands for at least one group of zeros
+    if (size == bytes.size()) {
+      return std::nullopt;
+    }
+    std::copy_backward(bytes.begin() + *gap, bytes.begin() + size,
+                       bytes.end());
+    std::fill(bytes.begin() + *gap, bytes.end() - (size - *gap), std::byte(0));
+  } else if (size != bytes.size()) {
+    return std::nullopt;
+  }
+  return ip(bytes, network_byte_order_t{});
+}
+
+template <std::output_iterator<char> Iterator>
+constexpr Iterator ip::format_to(Iterator out) const {
+  constexpr std::size_t kGroups = 8;
+  constexpr char kHex[] = "0123456789abcdef";
+
+  std::array<std::uint16_t, kGroups> groups{};
+  for (std::size_t i = 0; i < kGroups; ++i) {
+    groups[i] = static_cast<std::uint16_t>(
+        std::to_integer<std::uint16_t>(data_[2 * i]) << 8 |
+        std::to_integer<std::uint16_t>(data_[2 * i + 1]));
+  }
+
+  // NOTE: the first longest run of at least two zero groups is shortened
+  std::size_t gap_begin = kGroups;
+  std::size_t gap_size = 1;
+  for (std::size_t i = 0; i < kGroups;) {
+    std::size_t j = i;
+    while (j < kGroups && groups[j] == 0) {
+      j += 1;
+    }
+    if (j - i > gap_size) {
+      gap_begin = i;
+      gap_size = j - i;
+    }
+    i = j + 1;
+  }
+
+  const bool inet = gap_begin == 0 &&
+                    (gap_size == 6 || (gap_size == 5 && groups[5] == 0xffff));
+  const std::size_t hex_groups = inet ? 6 : kGroups;
+  for (std::size_t i = 0; i < hex_groups; ++i) {
+    if (i == gap_begin) {
+      *out++ = ':';
+      if (i + gap_size == kGroups) {
+        *out++ = ':';
+      }
+      i += gap_size - 1;
+      continue;
+    }
+    if (i != 0) {
+      *out++ = ':';
+    }
+    bool leading = true;
+    for (int shift = 12; shift >= 0; shift -= 4) {
+      const std::size_t digit = (groups[i] >> shift) & 0xf;
+      leading = leading && digit == 0 && shift != 0;
+      if (!leading) {
+        *out++ = kHex[digit];
+      }
+    }
+  }
+  if (inet) {
+    *out++ = ':';
+    out = net::inet::ip(static_cast<std::uint32_t>(groups[6]) << 16 |
+                        groups[7])
+              .format_to(out);
+  }
+  return out;
+}
+
 }  // namespace core::net::inet6
 
 template <>
@@ -46,6 +285,22 @@ struct std::formatter<core::net::inet6::ip> {
   template <class FormatContext>
   constexpr auto format(const core::net::inet6::ip& ip,
                         FormatContext& ctx) const {
-    return std::format_to(ctx.out(), "{}", ip.to_string());
+    return ip.format_to(ctx.out());
+  }
+};
+
+template <>
+struct std::hash<core::net::inet6::ip> {
+  constexpr std::size_t operator()(
+      const core::net::inet6::ip& ip) const noexcept {
+    const auto& bytes =
+        ip.get_bytes(core::net::inet6::ip::network_byte_order_t{});
+    std::uint64_t high = 0;
+    std::uint64_t low = 0;
+    for (std::size_t i = 0; i < 8; ++i) {
+      high = high << 8 | std::to_integer<std::uint64_t>(bytes[i]);
+      low = low << 8 | std::to_integer<std::uint64_t>(bytes[i + 8]);
+    }
+    return core::utils::combine(core::utils::mix(high), low);
   }
 };
@@ -0,0 +1,10 @@
+#pragma once
+
+#include "net/inet/lpm_table.hpp"
+#include "net/inet6/cidr.hpp"
+
+namespace core::net::inet6 {
+
+using lpm_table = net::inet::basic_lpm_table<net::inet6::ip>;
+
+}  // namespace core::net::inet6
@@ -1,18 +1,28 @@
 #pragma once
 
+#include <optional>
+
+#include "net/inet/sockaddr.hpp"
 #include "net/inet6/ip.hpp"
 #include "net/inet6/port.hpp"
 #include "net/sockets/base_sockaddr.hpp"
 
 namespace core::net::inet6 {
 
-class sockaddr final : public net::sockets::base_sockaddr {
+class sockaddr final
+    : public net::sockets::basic_sockaddr<net::sockets::family::kInet6> {
  public:
   sockaddr(net::inet6::ip ip, net::inet6::port port);
+  // NOTE: the IPv4-mapped counterpart e.g. to connect a dual-stack socket to
+  // an IPv4 peer
+  explicit sockaddr(const net::inet::sockaddr& that);
 
  public:
   net::inet6::ip get_ip() const noexcept;
   net::inet6::port get_port() const noexcept;
+  // NOTE: the IPv4 peer behind an IPv4-mapped address as accepted or received
+  // by a dual-stack socket, nullopt otherwise
+  std::optional<net::inet::sockaddr> to_inet() const noexcept;
 };
 
 }  // namespace core::net::inet6
@@ -27,6 +37,12 @@ struct std::formatter<core::net::inet6::sockaddr> {
   template <class FormatContext>
   constexpr auto format(const core::net::inet6::sockaddr& sockaddr,
                         FormatContext& ctx) const {
-    return std::format_to(ctx.out(), "{}", sockaddr.to_string());
+    std::array<char, core::net::sockets::base_sockaddr::kMaxStringSize> buffer;
+    return std::copy(buffer.data(), sockaddr.format_to(buffer.data()),
+                     ctx.out());
   }
 };
+
+template <>
+struct std::hash<core::net::inet6::sockaddr>
+    : std::hash<core::net::sockets::base_sockaddr> {};
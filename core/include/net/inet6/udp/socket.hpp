@@ -1,13 +1,22 @@
 #pragma once
 
-#include "net/sockets/base_socket.hpp"
+#include "net/udp/base_socket.hpp"
 
 namespace core::net::inet6::udp {
 
-class socket final : public net::sockets::base_socket {
+class socket final : public net::udp::base_socket {
  public:
   socket(utils::uninitialized_t) noexcept;
+  explicit socket(io::fd&& fd) noexcept;
   socket();
+  explicit socket(net::sockets::flags_t flags);
+
+ public:
+  // NOTE: IPV6_V6ONLY, a socket bound to :: with it cleared is dual-stack and
+  // also serves the IPv4 peers under their IPv4-mapped addresses. It has to
+  // be set before bind() as the default comes from net.ipv6.bindv6only
+  void set_v6only(bool value);
+  bool get_v6only() const;
 };
 
 }  // namespace core::net::inet6::udp
@@ -1,45 +1,135 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <format>
-#include <memory>
+#include <functional>
 #include <string>
 
 #include "net/sockets/family.hpp"
 
+namespace core::io {
+
+class uring;
+
+}  // namespace core::io
+
+namespace core::net::udp {
+
+class base_socket;
+
+}  // namespace core::net::udp
+
 namespace core::net::sockets {
 
 class base_socket;
+class message_batch;
 class base_sockaddr {
  private:
   friend class base_socket;
+  friend class message_batch;
+  friend class io::uring;
+  friend class net::udp::base_socket;
 
  protected:
-  // NOTE: base_sockaddr always allocates enough memory to hold a sockaddr of
-  // the provided family. It is the responsibility of the derived class to fill
-  // the memory as needed
-  explicit base_sockaddr(net::sockets::family family);
+  // NOTE: base_sockaddr holds no data itself. The address is kept inline by
+  // basic_sockaddr in a storage sized for its family right after a header
+  // which is trivially copyable. It is the responsibility of the derived class
+  // to fill the storage as needed. Copies are protected to avoid slicing
+  base_sockaddr() noexcept = default;
+  base_sockaddr(const base_sockaddr& that) noexcept = default;
+  base_sockaddr& operator=(const base_sockaddr& that) noexcept = default;
+
+ protected:
+  struct header {
+    std::uint16_t length;
+    net::sockets::family family;
+  };
+  static constexpr std::size_t kStorageOffset = 4;
+
+  // NOTE: the size of the sockaddr of the family rounded up to fit it on every
+  // supported platform
+  static constexpr std::size_t get_storage_size(
+      net::sockets::family family) noexcept {
+    switch (family) {
+      case net::sockets::family::kInet:
+        return 16;
+      case net::sockets::family::kInet6:
+        return 28;
+      case net::sockets::family::kUnix:
+        return 110;
+      default:
+        return 0;
+    }
+  }
+
+  // NOTE: fills the header and the storage with an empty sockaddr of the
+  // family, expected to be called once by basic_sockaddr
+  void initialize(net::sockets::family family) noexcept;
 
  protected:
   // NOTE: get_storage() methods are expected to be used only in the subclasses
-  // to wrap access to the allocated storage or for two-step creation of a
-  // base_sockaddr object
+  // to wrap access to the storage or for two-step creation of a base_sockaddr
+  // object. set_length() records the length of the filled address e.g. the
+  // one returned by the kernel
   class storage;
   storage* get_storage() noexcept;
   const storage* get_storage() const noexcept;
+  void set_length(std::size_t length) noexcept;
 
  public:
   bool operator==(const base_sockaddr& that) const;
   bool operator!=(const base_sockaddr& that) const;
+  // NOTE: consistent with operator==, hence the IPv6 flow info and scope id
+  // are not hashed either
+  std::size_t hash() const noexcept;
+
+ public:
+  // NOTE: the length of the address, which for the unix sockaddrs covers only
+  // the used part of the path
+  std::size_t get_length() const noexcept;
+  // NOTE: the family the sockaddr is created for regardless of what the
+  // kernel writes into the storage
+  net::sockets::family get_family() const noexcept;
 
  public:
-  std::size_t get_length() const;
-  net::sockets::family get_family() const;
+  // NOTE: the length of the longest string, a unix path or abstract name
+  static constexpr std::size_t kMaxStringSize = 108;
 
  public:
+  // NOTE: writes at most kMaxStringSize characters without allocating and
+  // returns the pointer past the last one
+  char* format_to(char* out) const;
   std::string to_string() const;
 
  private:
-  std::shared_ptr<void> storage_;
+  // NOTE: the size of the sockaddr of the family which is the most the kernel
+  // may write into the storage
+  std::size_t get_capacity() const noexcept;
+
+  header& get_header() noexcept;
+  const header& get_header() const noexcept;
+};
+
+// NOTE: a sockaddr of a single family e.g. net::inet::sockaddr takes 20 bytes
+// instead of the size of the largest supported family
+template <net::sockets::family Family>
+class basic_sockaddr : public base_sockaddr {
+  static_assert(get_storage_size(Family) != 0);
+
+ protected:
+  basic_sockaddr() noexcept {
+    // NOTE: base_sockaddr locates the header and the storage by the offsets
+    static_assert(offsetof(basic_sockaddr, header_) == 0);
+    static_assert(offsetof(basic_sockaddr, storage_) == kStorageOffset);
+    initialize(Family);
+  }
+
+ private:
+  header header_;
+  alignas(4) std::byte storage_[get_storage_size(Family)];
 };
 
 }  // namespace core::net::sockets
@@ -54,6 +144,16 @@ struct std::formatter<core::net::sockets::base_sockaddr> {
   template <class FormatContext>
   constexpr auto format(const core::net::sockets::base_sockaddr& sockaddr,
                         FormatContext& ctx) const {
-    return std::format_to(ctx.out(), "{}", sockaddr.to_string());
+    std::array<char, core::net::sockets::base_sockaddr::kMaxStringSize> buffer;
+    return std::copy(buffer.data(), sockaddr.format_to(buffer.data()),
+                     ctx.out());
+  }
+};
+
+template <>
+struct std::hash<core::net::sockets::base_sockaddr> {
+  std::size_t operator()(
+      const core::net::sockets::base_sockaddr& sockaddr) const noexcept {
+    return sockaddr.hash();
   }
 };
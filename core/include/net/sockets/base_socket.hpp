@@ -1,36 +1,98 @@
 #pragma once
 
+#include <concepts>
 #include <optional>
 #include <span>
+#include <stdexcept>
+#include <tuple>
 
 #include "io/fd.hpp"
+#include "io/iovec.hpp"
 #include "net/sockets/base_sockaddr.hpp"
 #include "net/sockets/family.hpp"
+#include "net/sockets/flags.hpp"
+#include "net/sockets/message_batch.hpp"
+#include "net/sockets/options.hpp"
 #include "net/sockets/protocol.hpp"
 #include "net/sockets/type.hpp"
+#include "utils/static_pimpl.hpp"
+
+namespace core::io {
+
+class uring;
+
+}  // namespace core::io
 
 namespace core::net::sockets {
 
 class base_socket : public io::fd {
+ private:
+  friend class io::uring;
+
  protected:
   base_socket(utils::uninitialized_t) noexcept;
+  // NOTE: flags are passed to socket() as SOCK_NONBLOCK and SOCK_CLOEXEC
   base_socket(net::sockets::family family, net::sockets::type type,
-              net::sockets::protocol protocol);
+              net::sockets::protocol protocol,
+              net::sockets::flags_t flags = 0);
+  // NOTE: adopts a descriptor e.g. one received with SCM_RIGHTS. It is assumed
+  // to be a socket of the derived type, the flags are queried on demand
+  explicit base_socket(io::fd&& fd) noexcept;
+
+ public:
+  // NOTE: a copy is a dup() which shares O_NONBLOCK with the original but does
+  // not inherit FD_CLOEXEC
+  base_socket(const base_socket& that);
+  base_socket& operator=(const base_socket& that);
+  base_socket(base_socket&& that) noexcept;
+  base_socket& operator=(base_socket&& that);
+  ~base_socket() noexcept;
 
  public:
+  // NOTE: O_NONBLOCK and FD_CLOEXEC are cached once known, so the getters and
+  // the setters with the current value do not issue fcntl(). The cache
+  // assumes the flags are changed only through this object, a change made
+  // through a copy sharing O_NONBLOCK or the raw descriptor is not observed
   void set_nonblock(bool value);
+  void set_cloexec(bool value);
   void set_reuseaddr(bool value);
   void set_reuseport(bool value);
   void set_keepalive(bool value);
 
  public:
   bool get_nonblock() const;
+  bool get_cloexec() const;
   bool get_reuseaddr() const;
   bool get_reuseport() const;
   bool get_keepalive() const;
   net::sockets::family get_family() const;
   net::sockets::type get_type() const;
 
+ public:
+  // NOTE: typed setsockopt() and getsockopt() for the options declared in
+  // net::sockets::opt e.g. socket.set<opt::tcp_nodelay>(true). Options of
+  // another protocol or unsupported by the platform throw
+  template <typename Option>
+    requires opt::is_option<Option>
+  void set(typename Option::value_type value) {
+    set_option(Option::kId, opt::to_native(value));
+  }
+
+  template <typename Option>
+    requires opt::is_option<Option>
+  typename Option::value_type get() const {
+    return opt::from_native<typename Option::value_type>(
+        get_option(Option::kId));
+  }
+
+  // NOTE: sets every option of the profile in order. The options set before a
+  // failing one stay applied
+  template <typename... Options>
+  void apply(const opt::profile<Options...>& profile) {
+    std::apply([this](const auto&... values) { (set<Options>(values), ...); },
+               profile.values);
+  }
+
  public:
   enum class bind_status : std::uint8_t {
     kSuccess,
@@ -59,6 +121,33 @@ class base_socket : public io::fd {
   };
   accept_status accept(base_socket& socket) const;
 
+  // NOTE: drains up to sockets.size() pending connections with accept4()
+  // until the queue is empty. The accepted sockets are non-blocking and
+  // close-on-exec. The peer address of sockets[i] is stored in sockaddrs[i]
+  // without an extra getpeername() if sockaddrs is not empty in which case it
+  // has to be at least as long as sockets. Returns the number of accepted
+  // connections. The listening socket is expected to be non-blocking
+  template <typename Socket,
+            typename Sockaddr = net::sockets::base_sockaddr>
+    requires std::derived_from<Socket, base_socket> &&
+             std::derived_from<Sockaddr, net::sockets::base_sockaddr>
+  std::size_t accept_many(std::span<Socket> sockets,
+                          std::span<Sockaddr> sockaddrs = {}) const {
+    if (!sockaddrs.empty() && sockaddrs.size() < sockets.size())
+        [[unlikely]] {
+      throw std::invalid_argument("accept_many() sockaddrs are too few");
+    }
+    std::size_t accepted = 0;
+    while (accepted < sockets.size() &&
+           accept_nonblock(sockets[accepted], sockaddrs.empty()
+                                                  ? nullptr
+                                                  : &sockaddrs[accepted]) ==
+               accept_status::kSuccess) {
+      accepted += 1;
+    }
+    return accepted;
+  }
+
  public:
   std::size_t send(std::span<const std::byte> bytes) const;
   std::size_t send_to(std::span<const std::byte> bytes,
@@ -66,6 +155,45 @@ class base_socket : public io::fd {
   std::size_t receive(std::span<std::byte> bytes) const;
   std::size_t receive_from(std::span<std::byte> bytes,
                            net::sockets::base_sockaddr& sockaddr) const;
+  // NOTE: receive() returns 0 both at the end of the stream and when a
+  // nonblocking socket has nothing to receive, try_receive() returns nullopt
+  // in the latter case
+  std::optional<std::size_t> try_receive(std::span<std::byte> bytes) const;
+
+ public:
+  // NOTE: scatter/gather counterparts of the above with sendmsg()/recvmsg().
+  // The semantics of the partial transfer are the same, see io::iovec_cursor
+  std::size_t send(std::span<const io::const_iovec> iovecs) const;
+  std::size_t send_to(std::span<const io::const_iovec> iovecs,
+                      const net::sockets::base_sockaddr& sockaddr) const;
+  std::size_t receive(std::span<const io::iovec> iovecs) const;
+  std::size_t receive_from(std::span<const io::iovec> iovecs,
+                           net::sockets::base_sockaddr& sockaddr) const;
+
+ public:
+  // NOTE: batched counterparts of the above with sendmmsg()/recvmmsg(). The
+  // number of transferred messages is returned which is 0 if the socket is
+  // non-blocking and is not ready. send_many() starts from the message first
+  // to continue a partially sent batch. receive_many() fills the buffers of
+  // the batch in order and records the lengths and the source addresses.
+  // Linux only, both throw elsewhere
+  std::size_t send_many(net::sockets::message_batch& batch,
+                        std::size_t first = 0) const;
+  std::size_t receive_many(net::sockets::message_batch& batch) const;
+
+ private:
+  accept_status accept_nonblock(base_socket& socket,
+                                net::sockets::base_sockaddr* sockaddr) const;
+  // NOTE: takes over an accepted descriptor, known is the mask of the flags
+  // whose value in flags is set by the syscall that created the descriptor
+  void assign(io::fd&& fd, net::sockets::flags_t known,
+              net::sockets::flags_t flags);
+  void set_option(opt::id id, int value);
+  int get_option(opt::id id) const;
+
+ private:
+  struct impl;
+  utils::static_pimpl<impl, 2, 1> pimpl_;
 };
 
 }  // namespace core::net::sockets
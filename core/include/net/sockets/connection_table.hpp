@@ -0,0 +1,206 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace core::net::sockets {
+
+// NOTE: open addressing table meant for per-connection state keyed by
+// inet::four_tuple or a sockaddr. The entries are kept densely in a vector,
+// so the iteration is a linear scan, and a power of two array of 8-byte
+// buckets holding a part of the hash and the entry index is probed linearly.
+// erase() shifts the following buckets back instead of leaving tombstones
+// and moves the last entry into the erased slot, hence it invalidates the
+// iterators to the last entry and insertions invalidate all of them
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class connection_table final {
+ public:
+  using key_t = Key;
+  using value_t = Value;
+  using hash_t = Hash;
+  using entry_t = std::pair<key_t, value_t>;
+  using iterator = typename std::vector<entry_t>::iterator;
+  using const_iterator = typename std::vector<entry_t>::const_iterator;
+
+ public:
+  connection_table() = default;
+  explicit connection_table(std::size_t capacity) { reserve(capacity); }
+
+ public:
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_t& key, Args&&... args) {
+    if ((entries_.size() + 1) * kMaxLoadDenominator >
+        buckets_.size() * kMaxLoadNumerator) [[unlikely]] {
+      rehash(std::max(kMinBuckets, buckets_.size() * 2));
+    }
+
+    const std::uint64_t hash = hash_(key);
+    std::size_t position = hash & mask_;
+    for (;; position = (position + 1) & mask_) {
+      const bucket& candidate = buckets_[position];
+      if (candidate.index == kEmpty) {
+        break;
+      }
+      if (candidate.hash == static_cast<std::uint32_t>(hash) &&
+          entries_[candidate.index].first == key) {
+        return {entries_.begin() + candidate.index, false};
+      }
+    }
+
+    if (entries_.size() == kEmpty) [[unlikely]] {
+      throw std::length_error("connection_table is full");
+    }
+    entries_.emplace_back(std::piecewise_construct, std::forward_as_tuple(key),
+                          std::forward_as_tuple(std::forward<Args>(args)...));
+    buckets_[position] = bucket{
+        .hash = static_cast<std::uint32_t>(hash),
+        .index = static_cast<std::uint32_t>(entries_.size() - 1),
+    };
+    return {entries_.end() - 1, true};
+  }
+
+  iterator find(const key_t& key) noexcept {
+    const std::size_t position = find_bucket(key);
+    return position == kNotFound ? entries_.end()
+                                 : entries_.begin() + buckets_[position].index;
+  }
+
+  const_iterator find(const key_t& key) const noexcept {
+    const std::size_t position = find_bucket(key);
+    return position == kNotFound ? entries_.end()
+                                 : entries_.begin() + buckets_[position].index;
+  }
+
+  bool contains(const key_t& key) const noexcept {
+    return find_bucket(key) != kNotFound;
+  }
+
+  bool erase(const key_t& key) {
+    std::size_t hole = find_bucket(key);
+    if (hole == kNotFound) {
+      return false;
+    }
+    const std::uint32_t index = buckets_[hole].index;
+
+    // NOTE: a following bucket fills the hole unless the hole lies before its
+    // home position in the probe sequence
+    for (std::size_t position = (hole + 1) & mask_;
+         buckets_[position].index != kEmpty;
+         position = (position + 1) & mask_) {
+      const std::size_t home = buckets_[position].hash & mask_;
+      if (((position - home) & mask_) >= ((position - hole) & mask_)) {
+        buckets_[hole] = buckets_[position];
+        hole = position;
+      }
+    }
+    buckets_[hole] = bucket{};
+
+    const std::uint32_t last = static_cast<std::uint32_t>(entries_.size() - 1);
+    if (index != last) {
+      std::size_t position = hash_(entries_[last].first) & mask_;
+      while (buckets_[position].index != last) {
+        position = (position + 1) & mask_;
+      }
+      buckets_[position].index = index;
+      entries_[index] = std::move(entries_[last]);
+    }
+    entries_.pop_back();
+    return true;
+  }
+
+  void clear() noexcept {
+    entries_.clear();
+    std::fill(buckets_.begin(), buckets_.end(), bucket{});
+  }
+
+  void reserve(std::size_t capacity) {
+    std::size_t buckets = kMinBuckets;
+    while (capacity * kMaxLoadDenominator > buckets * kMaxLoadNumerator) {
+      buckets *= 2;
+    }
+    if (buckets > buckets_.size()) {
+      rehash(buckets);
+    }
+    entries_.reserve(capacity);
+  }
+
+ public:
+  std::size_t size() const noexcept { return entries_.size(); }
+  bool empty() const noexcept { return entries_.empty(); }
+
+ public:
+  iterator begin() noexcept { return entries_.begin(); }
+  iterator end() noexcept { return entries_.end(); }
+  const_iterator begin() const noexcept { return entries_.begin(); }
+  const_iterator end() const noexcept { return entries_.end(); }
+
+ private:
+  // NOTE: the low half of the hash picks the home bucket and is compared
+  // before the keys
+  struct bucket final {
+    std::uint32_t hash = 0;
+    std::uint32_t index = kEmpty;
+  };
+
+ private:
+  static constexpr std::uint32_t kEmpty =
+      std::numeric_limits<std::uint32_t>::max();
+  static constexpr std::size_t kNotFound =
+      std::numeric_limits<std::size_t>::max();
+  static constexpr std::size_t kMinBuckets = 16;
+  // NOTE: linear probing degrades quickly past 3/4 load
+  static constexpr std::size_t kMaxLoadNumerator = 3;
+  static constexpr std::size_t kMaxLoadDenominator = 4;
+
+ private:
+  std::size_t find_bucket(const key_t& key) const noexcept {
+    if (entries_.empty()) {
+      return kNotFound;
+    }
+
+    const std::uint64_t hash = hash_(key);
+    for (std::size_t position = hash & mask_;;
+         position = (position + 1) & mask_) {
+      const bucket& candidate = buckets_[position];
+      if (candidate.index == kEmpty) {
+        return kNotFound;
+      }
+      if (candidate.hash == static_cast<std::uint32_t>(hash) &&
+          entries_[candidate.index].first == key) {
+        return position;
+      }
+    }
+  }
+
+  void rehash(std::size_t size) {
+    std::vector<bucket> buckets(size);
+    const std::size_t mask = size - 1;
+    for (const bucket& moved : buckets_) {
+      if (moved.index == kEmpty) {
+        continue;
+      }
+      std::size_t position = moved.hash & mask;
+      while (buckets[position].index != kEmpty) {
+        position = (position + 1) & mask;
+      }
+      buckets[position] = moved;
+    }
+    buckets_ = std::move(buckets);
+    mask_ = mask;
+  }
+
+ private:
+  std::vector<entry_t> entries_;
+  std::vector<bucket> buckets_;
+  std::size_t mask_ = 0;
+  [[no_unique_address]] hash_t hash_;
+};
+
+}  // namespace core::net::sockets
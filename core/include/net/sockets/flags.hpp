@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstdint>
+
+namespace core::net::sockets {
+
+// NOTE: descriptor flags applied atomically on socket creation with
+// SOCK_NONBLOCK and SOCK_CLOEXEC so that no other thread observes the socket
+// without them e.g. a concurrent fork() and exec() leaking the descriptor
+enum flag : std::uint8_t {
+  kNonblock = 1 << 0,
+  kCloexec = 1 << 1,
+};
+using flags_t = std::uint8_t;
+
+}  // namespace core::net::sockets
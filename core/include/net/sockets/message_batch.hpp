@@ -0,0 +1,62 @@
+#pragma once
+
+#include <span>
+
+#include "net/sockets/base_sockaddr.hpp"
+#include "utils/mixins.hpp"
+#include "utils/static_pimpl.hpp"
+
+namespace core::net::sockets {
+
+class base_socket;
+
+// NOTE: preallocated datagrams for base_socket::send_many() and
+// base_socket::receive_many(). The batch owns the message headers and the
+// storage for the peer addresses of up to capacity messages so that no
+// allocation happens per transfer. The bytes are referenced by spans which
+// must outlive the transfer
+class message_batch final : public utils::non_copyable {
+ private:
+  friend class base_socket;
+
+ public:
+  explicit message_batch(std::size_t capacity);
+  ~message_batch() noexcept;
+
+ public:
+  // NOTE: appends a message. For sending the span is the payload and the
+  // optional sockaddr is the destination of the datagram, for receiving the
+  // span is the buffer to be filled and the sockaddr is ignored
+  void push(std::span<const std::byte> bytes);
+  void push(std::span<const std::byte> bytes,
+            const net::sockets::base_sockaddr& sockaddr);
+  void clear() noexcept;
+
+ public:
+  std::size_t get_capacity() const noexcept;
+  std::size_t get_size() const noexcept;
+
+ public:
+  // NOTE: the results of the last transfer of the i-th message. The length is
+  // the number of bytes sent or received and get_bytes() is the received part
+  // of the buffer. The sockaddr is the source of a received datagram and must
+  // be of the same family
+  std::size_t get_length(std::size_t i) const;
+  std::span<const std::byte> get_bytes(std::size_t i) const;
+  void get_sockaddr(std::size_t i, net::sockets::base_sockaddr& sockaddr) const;
+
+ private:
+  // NOTE: an opaque array of struct mmsghdr of get_size() elements, see
+  // base_sockaddr::get_storage() for the same approach
+  class header;
+  header* get_headers() noexcept;
+
+  // NOTE: points every message to its sockaddr storage before recvmmsg()
+  void prepare_receive() noexcept;
+
+ private:
+  struct impl;
+  utils::static_pimpl<impl, 80, 8> pimpl_;
+};
+
+}  // namespace core::net::sockets
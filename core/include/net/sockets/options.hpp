@@ -0,0 +1,116 @@
+#pragma once
+
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <optional>
+#include <tuple>
+
+namespace core::net::sockets::opt {
+
+// NOTE: identifiers of the supported options. The level and the name of each
+// one are resolved in the translation unit to keep the system headers out of
+// the interface
+enum class id : std::uint8_t {
+  kReuseaddr,
+  kReuseport,
+  kKeepalive,
+  kRcvbuf,
+  kSndbuf,
+  kRcvlowat,
+  kBusyPoll,
+  kIncomingCpu,
+  kLinger,
+  kTcpNodelay,
+  kTcpCork,
+  kTcpQuickack,
+  kTcpFastopen,
+  kTcpDeferAccept,
+  kTcpNotsentLowat,
+  kIpv6V6only,
+};
+
+// NOTE: every option is passed to setsockopt() as an int. value_type is what
+// the user sees, to_native() and from_native() convert between the two
+template <opt::id Id, typename T>
+struct option {
+  static constexpr opt::id kId = Id;
+  using value_type = T;
+};
+
+template <typename T>
+concept is_option = requires {
+  { T::kId } -> std::convertible_to<opt::id>;
+  typename T::value_type;
+};
+
+// NOTE: SOL_SOCKET options. The buffer sizes are in bytes and are doubled by
+// the kernel to account for the bookkeeping overhead which get() reports.
+// busy_poll requires CAP_NET_ADMIN to be raised above the sysctl default.
+// linger is disabled with std::nullopt
+struct reuseaddr final : opt::option<opt::id::kReuseaddr, bool> {};
+struct reuseport final : opt::option<opt::id::kReuseport, bool> {};
+struct keepalive final : opt::option<opt::id::kKeepalive, bool> {};
+struct rcvbuf final : opt::option<opt::id::kRcvbuf, int> {};
+struct sndbuf final : opt::option<opt::id::kSndbuf, int> {};
+struct rcvlowat final : opt::option<opt::id::kRcvlowat, int> {};
+struct busy_poll final
+    : opt::option<opt::id::kBusyPoll, std::chrono::microseconds> {};
+struct incoming_cpu final : opt::option<opt::id::kIncomingCpu, int> {};
+struct linger final
+    : opt::option<opt::id::kLinger, std::optional<std::chrono::seconds>> {};
+
+// NOTE: IPPROTO_TCP options. tcp_quickack is not sticky, the kernel may fall
+// back to delayed acknowledgements so it is usually set after every receive.
+// tcp_fastopen is the length of the pending TFO request queue of a listener
+struct tcp_nodelay final : opt::option<opt::id::kTcpNodelay, bool> {};
+struct tcp_cork final : opt::option<opt::id::kTcpCork, bool> {};
+struct tcp_quickack final : opt::option<opt::id::kTcpQuickack, bool> {};
+struct tcp_fastopen final : opt::option<opt::id::kTcpFastopen, int> {};
+struct tcp_defer_accept final
+    : opt::option<opt::id::kTcpDeferAccept, std::chrono::seconds> {};
+struct tcp_notsent_lowat final
+    : opt::option<opt::id::kTcpNotsentLowat, int> {};
+
+// NOTE: IPPROTO_IPV6 options
+struct ipv6_v6only final : opt::option<opt::id::kIpv6V6only, bool> {};
+
+constexpr int to_native(bool value) noexcept { return (value ? 1 : 0); }
+constexpr int to_native(int value) noexcept { return value; }
+template <typename Rep, typename Period>
+constexpr int to_native(std::chrono::duration<Rep, Period> value) noexcept {
+  return static_cast<int>(value.count());
+}
+template <typename Rep, typename Period>
+constexpr int to_native(
+    std::optional<std::chrono::duration<Rep, Period>> value) noexcept {
+  return (value ? static_cast<int>(value->count()) : -1);
+}
+
+template <typename T>
+constexpr T from_native(int value) noexcept {
+  if constexpr (std::same_as<T, bool>) {
+    return (value ? true : false);
+  } else if constexpr (std::same_as<T, int>) {
+    return value;
+  } else if constexpr (requires { typename T::value_type::period; }) {
+    return (value < 0 ? T(std::nullopt) : T(typename T::value_type(value)));
+  } else {
+    return T(value);
+  }
+}
+
+// NOTE: a set of option values applied in the declaration order by
+// base_socket::apply() e.g.
+//   opt::profile<opt::tcp_nodelay, opt::tcp_quickack> kLowLatency(true, true);
+//   socket.apply(kLowLatency);
+template <typename... Options>
+  requires(opt::is_option<Options> && ...)
+struct profile final {
+  constexpr explicit profile(typename Options::value_type... values)
+      : values(values...) {}
+
+  std::tuple<typename Options::value_type...> values;
+};
+
+}  // namespace core::net::sockets::opt
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include "net/sockets/base_socket.hpp"
+
+namespace core::net::tcp {
+
+// NOTE: TCP specifics shared by the inet and inet6 sockets. Zero-copy
+// transmission is Linux only, the methods throw on the other platforms
+class base_socket : public net::sockets::base_socket {
+ protected:
+  base_socket(utils::uninitialized_t) noexcept;
+  explicit base_socket(io::fd&& fd) noexcept;
+  explicit base_socket(net::sockets::family family,
+                       net::sockets::flags_t flags = 0);
+
+ public:
+  // NOTE: SO_ZEROCOPY has to be enabled before send_zerocopy()
+  void set_zerocopy(bool value);
+  bool get_zerocopy() const;
+
+ public:
+  // NOTE: sends with MSG_ZEROCOPY i.e. the kernel pins and references the
+  // pages of bytes instead of copying them. The buffer must not be modified or
+  // released until the send is reported by receive_zerocopy_completions().
+  // Every send_zerocopy() call that returns non-zero gets the next id of the
+  // socket starting from 0. The number of bytes sent is returned which is 0 if
+  // the socket is non-blocking and is not ready or if the pinned memory limit
+  // is reached and the completions have to be received first. The pinning
+  // only pays off for the buffers of tens of kilobytes and more
+  std::size_t send_zerocopy(std::span<const std::byte> bytes) const;
+
+ public:
+  // NOTE: the sends with ids in [first, last] are completed and their buffers
+  // may be reused. copied is set if the kernel fell back to copying the data
+  // e.g. on loopback or without the NIC support
+  struct zerocopy_completion final {
+    std::uint32_t first;
+    std::uint32_t last;
+    bool copied;
+  };
+
+  // NOTE: drains up to completions.size() notifications from the error queue
+  // of the socket and returns their number. The error queue never blocks. A
+  // pending notification is reported by io::poller as the kPollErr event
+  // which is delivered regardless of the registered events
+  std::size_t receive_zerocopy_completions(
+      std::span<zerocopy_completion> completions) const;
+};
+
+}  // namespace core::net::tcp
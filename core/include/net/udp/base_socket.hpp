@@ -0,0 +1,49 @@
+#pragma once
+
+#include <span>
+
+#include "net/sockets/base_socket.hpp"
+
+namespace core::net::udp {
+
+// NOTE: UDP specifics shared by the inet and inet6 sockets. Segmentation
+// offload is Linux only, the methods throw on the other platforms
+class base_socket : public net::sockets::base_socket {
+ protected:
+  base_socket(utils::uninitialized_t) noexcept;
+  explicit base_socket(io::fd&& fd) noexcept;
+  explicit base_socket(net::sockets::family family,
+                       net::sockets::flags_t flags = 0);
+
+ public:
+  // NOTE: UDP_GRO allows the kernel to coalesce consecutive datagrams of the
+  // same flow into a single receive_segmented() call
+  void set_gro(bool value);
+  bool get_gro() const;
+
+ public:
+  // NOTE: sends bytes as consecutive datagrams of segment_size bytes with the
+  // last one possibly shorter (UDP_SEGMENT). The whole buffer passes the
+  // network stack once and is split by the kernel or the NIC. The kernel
+  // limits the buffer to 64 segments and to the maximum datagram size. The
+  // number of bytes sent is returned which is 0 if the socket is non-blocking
+  // and is not ready
+  std::size_t send_segmented(std::span<const std::byte> bytes,
+                             std::size_t segment_size) const;
+  std::size_t send_segmented_to(
+      std::span<const std::byte> bytes, std::size_t segment_size,
+      const net::sockets::base_sockaddr& sockaddr) const;
+
+ public:
+  // NOTE: receives possibly coalesced datagrams into bytes. segment_size is
+  // set to the size of every datagram but the last one or to the number of
+  // received bytes if nothing was coalesced, see net::udp::segments to split
+  // the buffer. The buffer should fit 64KiB to not truncate coalesced data
+  std::size_t receive_segmented(std::span<std::byte> bytes,
+                                std::size_t& segment_size) const;
+  std::size_t receive_segmented_from(
+      std::span<std::byte> bytes, std::size_t& segment_size,
+      net::sockets::base_sockaddr& sockaddr) const;
+};
+
+}  // namespace core::net::udp
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <span>
+
+namespace core::net::udp {
+
+// NOTE: a view of the datagrams coalesced by base_socket::receive_segmented()
+// or to be split by base_socket::send_segmented(). Every segment but the last
+// one is exactly segment_size bytes long. Segments refer to the viewed buffer
+// and nothing is copied
+class segments final {
+ public:
+  class iterator final {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::span<const std::byte>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = value_type;
+
+   public:
+    constexpr iterator() noexcept = default;
+    constexpr iterator(const segments* segments, std::size_t index) noexcept
+        : segments_(segments), index_(index) {}
+
+   public:
+    constexpr value_type operator*() const noexcept {
+      return (*segments_)[index_];
+    }
+    constexpr iterator& operator++() noexcept {
+      index_ += 1;
+      return *this;
+    }
+    constexpr iterator operator++(int) noexcept {
+      iterator copy = *this;
+      index_ += 1;
+      return copy;
+    }
+    constexpr bool operator==(const iterator& that) const noexcept = default;
+
+   private:
+    const segments* segments_ = nullptr;
+    std::size_t index_ = 0;
+  };
+
+ public:
+  // NOTE: zero segment_size views the whole buffer as a single segment
+  constexpr segments(std::span<const std::byte> bytes,
+                     std::size_t segment_size) noexcept
+      : bytes_(bytes),
+        segment_size_(segment_size == 0 ? bytes.size() : segment_size) {}
+
+ public:
+  constexpr std::size_t size() const noexcept {
+    return bytes_.empty()
+               ? 0
+               : (bytes_.size() + segment_size_ - 1) / segment_size_;
+  }
+  constexpr bool empty() const noexcept { return bytes_.empty(); }
+
+  constexpr std::span<const std::byte> operator[](
+      std::size_t i) const noexcept {
+    const std::size_t offset = i * segment_size_;
+    return bytes_.subspan(offset,
+                          std::min(segment_size_, bytes_.size() - offset));
+  }
+
+  constexpr iterator begin() const noexcept { return iterator(this, 0); }
+  constexpr iterator end() const noexcept { return iterator(this, size()); }
+
+ private:
+  std::span<const std::byte> bytes_;
+  std::size_t segment_size_;
+};
+
+}  // namespace core::net::udp
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <span>
+#include <vector>
+
+#include "io/fd.hpp"
 #include "net/sockets/base_socket.hpp"
 #include "net/unix/sockaddr.hpp"
 
@@ -8,7 +12,13 @@ namespace core::net::unix {
 class base_socket : public net::sockets::base_socket {
  protected:
   base_socket(utils::uninitialized_t) noexcept;
-  explicit base_socket(core::net::sockets::type type);
+  explicit base_socket(io::fd&& fd) noexcept;
+  explicit base_socket(core::net::sockets::type type,
+                       net::sockets::flags_t flags = 0);
+  base_socket(const base_socket& that);
+  base_socket& operator=(const base_socket& that);
+  base_socket(base_socket&& that) noexcept;
+  base_socket& operator=(base_socket&& that);
   ~base_socket() noexcept;
 
  public:
@@ -17,6 +27,27 @@ class base_socket : public net::sockets::base_socket {
  public:
   net::sockets::base_socket::bind_status unlink_bind(
       const net::unix::sockaddr& sockaddr);
+
+ public:
+  // NOTE: the kernel limit of descriptors per message (SCM_MAX_FD)
+  static constexpr std::size_t kMaxFds = 253;
+
+  // NOTE: passes the descriptors to the peer as SCM_RIGHTS ancillary data of a
+  // single message carrying bytes. The peer receives its own duplicates so the
+  // descriptors may be closed once sent. bytes should not be empty as the
+  // ancillary data is attached to the first byte on stream sockets. The
+  // number of bytes sent is returned which is 0 if the socket is non-blocking
+  // and is not ready in which case no descriptor was passed
+  std::size_t send_fds(std::span<const std::byte> bytes,
+                       std::span<const io::fd* const> fds) const;
+
+  // NOTE: receives a message into bytes and appends the passed descriptors to
+  // fds. They are close-on-exec where MSG_CMSG_CLOEXEC is supported. Up to
+  // max_fds descriptors are accepted, the call throws if the sender passed
+  // more after closing the received ones. The number of bytes received is
+  // returned which is 0 if the socket is non-blocking and is not ready
+  std::size_t receive_fds(std::span<std::byte> bytes, std::vector<io::fd>& fds,
+                          std::size_t max_fds = kMaxFds) const;
 };
 
 }  // namespace core::net::unix
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "net/unix/base_socket.hpp"
+
+namespace core::net::unix::seqpacket {
+
+class socket final : public net::unix::base_socket {
+ public:
+  socket(utils::uninitialized_t) noexcept;
+  explicit socket(io::fd&& fd) noexcept;
+  socket();
+  explicit socket(net::sockets::flags_t flags);
+};
+
+}  // namespace core::net::unix::seqpacket
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <span>
+
+#include "net/unix/stream/socket.hpp"
+#include "utils/mixins.hpp"
+#include "utils/static_pimpl.hpp"
+
+namespace core::net::unix {
+
+// NOTE: bidirectional message channel between two processes of the same host
+// over a pair of single-producer single-consumer rings in shared memory. The
+// connecting side creates a memfd holding both rings and an eventfd per side
+// and passes them over an already connected unix stream socket with
+// SCM_RIGHTS, the other side adopts them once it verifies that the size of
+// the memfd is sealed. Afterwards the messages never pass
+// the kernel, the eventfds are written only when the peer sleeps waiting for
+// a message or for space and the socket is only watched to detect the peer
+// going away. Linux only, the constructors throw on the other platforms. Each
+// side is expected to be used by a single thread
+class shm_channel final : public utils::non_copyable {
+ public:
+  // NOTE: connecting side. capacity is the size of each ring in bytes and is
+  // rounded up to a power of two
+  shm_channel(net::unix::stream::socket socket, std::size_t capacity);
+  // NOTE: accepting side, blocks until the peer passes the rings
+  explicit shm_channel(net::unix::stream::socket socket);
+  shm_channel(shm_channel&& that) noexcept;
+  shm_channel& operator=(shm_channel&& that) noexcept;
+  ~shm_channel() noexcept;
+
+ public:
+  // NOTE: the largest message which fits the ring regardless of its state
+  std::size_t get_max_message_size() const noexcept;
+
+ public:
+  // NOTE: empty messages and messages larger than get_max_message_size()
+  // throw. try_send() returns false if the ring is full, send() waits for the
+  // peer to make space
+  bool try_send(std::span<const std::byte> message);
+  void send(std::span<const std::byte> message);
+
+ public:
+  // NOTE: copies the next message into bytes and returns its size or 0 if
+  // there is none. A message larger than bytes throws and stays in the ring.
+  // A record pointing outside the ring or past the published messages throws
+  // as the peer is not trusted. receive() waits for a message and throws if
+  // the peer went away with the ring drained
+  std::size_t try_receive(std::span<std::byte> bytes);
+  std::size_t receive(std::span<std::byte> bytes);
+
+ private:
+  struct impl;
+  utils::static_pimpl<impl, 88, 8> pimpl_;
+};
+
+}  // namespace core::net::unix
@@ -4,12 +4,14 @@
 
 namespace core::net::unix {
 
-class sockaddr final : public net::sockets::base_sockaddr {
+class sockaddr final
+    : public net::sockets::basic_sockaddr<net::sockets::family::kUnix> {
  public:
   static const sockaddr& kInvalid() noexcept;
   static const sockaddr& kEmpty() noexcept;
 
  public:
+  // NOTE: a path starting with a null byte is a Linux abstract name
   explicit sockaddr(std::string_view path);
 
  public:
@@ -28,6 +30,12 @@ struct std::formatter<core::net::unix::sockaddr> {
   template <class FormatContext>
   constexpr auto format(const core::net::unix::sockaddr& sockaddr,
                         FormatContext& ctx) const {
-    return std::format_to(ctx.out(), "{}", sockaddr.to_string());
+    std::array<char, core::net::sockets::base_sockaddr::kMaxStringSize> buffer;
+    return std::copy(buffer.data(), sockaddr.format_to(buffer.data()),
+                     ctx.out());
   }
 };
+
+template <>
+struct std::hash<core::net::unix::sockaddr>
+    : std::hash<core::net::sockets::base_sockaddr> {};
@@ -7,7 +7,9 @@ namespace core::net::unix::stream {
 class socket final : public net::unix::base_socket {
  public:
   socket(utils::uninitialized_t) noexcept;
+  explicit socket(io::fd&& fd) noexcept;
   socket();
+  explicit socket(net::sockets::flags_t flags);
 };
 
 }  // namespace core::net::unix::stream
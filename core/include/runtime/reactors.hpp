@@ -0,0 +1,69 @@
+#pragma once
+
+#include <functional>
+
+#include "io/poller.hpp"
+#include "net/inet/sockaddr.hpp"
+#include "net/inet/tcp/socket.hpp"
+#include "utils/mixins.hpp"
+#include "utils/static_pimpl.hpp"
+
+namespace core::runtime {
+
+// NOTE: thread-per-core runtime. Each reactor owns a thread pinned to a CPU,
+// a poller and a listening socket bound to the same address with SO_REUSEPORT
+// so that the kernel spreads the incoming connections across the reactors and
+// a connection never leaves the reactor that accepted it
+class reactors final : public utils::non_copyable {
+ public:
+  // NOTE: accepted sockets are nonblocking and are expected to be registered
+  // in the provided poller. Both callbacks are invoked on the reactor thread
+  using accept_callback_t =
+      std::function<void(io::poller&, net::inet::tcp::socket&&)>;
+
+  // NOTE: counters are updated by the reactor thread and may be read from any
+  // thread. wakeups is the number of returns from poll(), events the number of
+  // the dispatched events of the accepted sockets and errors the number of the
+  // unhandled errors reported by poll()
+  struct load final {
+    std::uint64_t wakeups;
+    std::uint64_t events;
+    std::uint64_t accepted;
+    std::uint64_t errors;
+  };
+
+ public:
+  // NOTE: count of zero creates a reactor per CPU available to the process.
+  // Reactors are pinned to the available CPUs in order. Pinning is not
+  // supported on macOS and is skipped there
+  reactors(const net::inet::sockaddr& sockaddr,
+           accept_callback_t accept_callback, io::poller::callback_t callback,
+           std::size_t count = 0, std::size_t backlog = 1024);
+  ~reactors() noexcept;
+
+ public:
+  std::size_t size() const noexcept;
+  void get_bind_sockaddr(net::inet::sockaddr& sockaddr) const;
+  reactors::load get_load(std::size_t reactor) const;
+
+ public:
+  // NOTE: start() throws if the reactors are already running. stop() blocks
+  // until every reactor finishes the current poll() and is a noop if the
+  // reactors are not running, it throws the first failure to wake up, join or
+  // poll a reactor after all of them are stopped. A reactor whose poll()
+  // fails stops polling on its own. Both must be called from the same thread
+  void start();
+  void stop();
+  bool is_running() const noexcept;
+
+ public:
+  // NOTE: safe to call from any thread including the reactor threads. The task
+  // is executed on the reactor thread by the next poll()
+  void post(std::size_t reactor, io::poller::task_t task);
+
+ private:
+  struct impl;
+  utils::static_pimpl<impl, 32, 8> pimpl_;
+};
+
+}  // namespace core::runtime
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace core::utils {
+
+// NOTE: the MurmurHash3 finalizer, a bijection which spreads every input bit
+// over the whole result. std::hash of the integers is the identity on the
+// major standard libraries which clusters the keys of an open addressing
+// table
+constexpr std::uint64_t mix(std::uint64_t value) noexcept {
+  value ^= value >> 33;
+  value *= 0xff51afd7ed558ccdULL;
+  value ^= value >> 33;
+  value *= 0xc4ceb9fe1a85ec53ULL;
+  value ^= value >> 33;
+  return value;
+}
+
+constexpr std::uint64_t combine(std::uint64_t seed,
+                                std::uint64_t value) noexcept {
+  return mix(seed ^
+             (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2)));
+}
+
+}  // namespace core::utils
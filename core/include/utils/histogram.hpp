@@ -0,0 +1,103 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
+
+namespace core::utils {
+
+// NOTE: histogram of unsigned values with logarithmic buckets. Every power of
+// two range is split into 4 linear sub-buckets so that a reported value is
+// within 25% of the recorded one. Values below 4 are exact. record() is O(1)
+// and does not allocate
+class histogram final {
+ public:
+  static constexpr std::size_t kSubBucketBits = 2;
+  static constexpr std::size_t kBuckets =
+      (std::numeric_limits<std::uint64_t>::digits - kSubBucketBits + 1)
+      << kSubBucketBits;
+
+ public:
+  constexpr void record(std::uint64_t value) noexcept {
+    buckets_[get_bucket(value)] += 1;
+    count_ += 1;
+    sum_ += value;
+    min_ = std::min(min_, value);
+    max_ = std::max(max_, value);
+  }
+
+  constexpr void merge(const histogram& that) noexcept {
+    for (std::size_t i = 0; i < kBuckets; ++i) {
+      buckets_[i] += that.buckets_[i];
+    }
+    count_ += that.count_;
+    sum_ += that.sum_;
+    min_ = std::min(min_, that.min_);
+    max_ = std::max(max_, that.max_);
+  }
+
+  constexpr void reset() noexcept { *this = histogram(); }
+
+ public:
+  constexpr std::uint64_t count() const noexcept { return count_; }
+  constexpr std::uint64_t sum() const noexcept { return sum_; }
+  constexpr std::uint64_t min() const noexcept {
+    return count_ == 0 ? 0 : min_;
+  }
+  constexpr std::uint64_t max() const noexcept { return max_; }
+
+  // NOTE: returns the upper bound of the bucket containing the value below
+  // which the quantile of the recorded values falls clamped to the maximum
+  // recorded value. quantile is in the range [0, 1]
+  constexpr std::uint64_t percentile(double quantile) const noexcept {
+    if (count_ == 0) {
+      return 0;
+    }
+
+    const std::uint64_t rank = std::max<std::uint64_t>(
+        1, static_cast<std::uint64_t>(quantile * static_cast<double>(count_) +
+                                      0.5));
+    std::uint64_t seen = 0;
+    for (std::size_t i = 0; i < kBuckets; ++i) {
+      seen += buckets_[i];
+      if (seen >= rank) {
+        return std::clamp(get_upper_bound(i), min(), max_);
+      }
+    }
+    return max_;
+  }
+
+ public:
+  static constexpr std::size_t get_bucket(std::uint64_t value) noexcept {
+    const std::size_t width = std::bit_width(value);
+    if (width <= kSubBucketBits) {
+      return static_cast<std::size_t>(value);
+    }
+    const std::size_t shift = width - kSubBucketBits - 1;
+    return ((shift + 1) << kSubBucketBits) +
+           static_cast<std::size_t>((value >> shift) & kSubBucketMask);
+  }
+
+  static constexpr std::uint64_t get_upper_bound(std::size_t bucket) noexcept {
+    if (bucket < (1u << kSubBucketBits)) {
+      return bucket;
+    }
+    const std::size_t shift = (bucket >> kSubBucketBits) - 1;
+    const std::uint64_t lower =
+        ((1ull << kSubBucketBits) | (bucket & kSubBucketMask)) << shift;
+    return lower + ((1ull << shift) - 1);
+  }
+
+ private:
+  static constexpr std::uint64_t kSubBucketMask = (1u << kSubBucketBits) - 1;
+
+  std::array<std::uint64_t, kBuckets> buckets_{};
+  std::uint64_t count_ = 0;
+  std::uint64_t sum_ = 0;
+  std::uint64_t min_ = std::numeric_limits<std::uint64_t>::max();
+  std::uint64_t max_ = 0;
+};
+
+}  // namespace core::utils
@@ -0,0 +1,167 @@
+#include "coro/async_socket.hpp"
+
+#include <optional>
+#include <utility>
+
+namespace core::coro {
+
+namespace {
+
+constexpr io::poller::events_t kFailure = io::poller::event::kPollErr |
+                                          io::poller::event::kPollHup |
+                                          io::poller::event::kPollNval;
+
+}  // namespace
+
+async_socket::async_socket(io::poller& poller,
+                           net::sockets::base_socket& socket) noexcept
+    : poller_(poller), socket_(socket) {}
+
+async_socket::~async_socket() noexcept {
+  if (registered_ != 0) {
+    try {
+      poller_.erase(socket_);
+    } catch (...) {
+    }
+  }
+}
+
+void async_socket::dispatch(io::poller&, const io::fd&,
+                            io::poller::events_t events, void* data) {
+  auto& self = *static_cast<async_socket*>(data);
+  const auto complete = [](operation& operation) {
+    try {
+      return operation.attempt_(operation);
+    } catch (...) {
+      operation.exception_ = std::current_exception();
+      return true;
+    }
+  };
+
+  std::coroutine_handle<> reader;
+  if (self.reader_ != nullptr &&
+      (events & (io::poller::event::kPollIn | kFailure)) != 0 &&
+      complete(*self.reader_)) {
+    reader = std::exchange(self.reader_, nullptr)->handle_;
+  }
+  std::coroutine_handle<> writer;
+  if (self.writer_ != nullptr &&
+      (events & (io::poller::event::kPollOut | kFailure)) != 0 &&
+      complete(*self.writer_)) {
+    writer = std::exchange(self.writer_, nullptr)->handle_;
+  }
+
+  // NOTE: the read interest is kept after the completion as the coroutine is
+  // likely to receive again and is dropped on the first event nobody awaits
+  self.update(reader || writer);
+
+  // NOTE: the resumed coroutines may destroy the async_socket
+  if (reader) {
+    reader.resume();
+  }
+  if (writer) {
+    writer.resume();
+  }
+}
+
+async_socket::receive_operation async_socket::async_receive(
+    std::span<std::byte> bytes) noexcept {
+  return receive_operation(*this, bytes);
+}
+
+async_socket::send_operation async_socket::async_send(
+    std::span<const std::byte> bytes) noexcept {
+  return send_operation(*this, bytes);
+}
+
+async_socket::accept_operation async_socket::async_accept(
+    net::sockets::base_socket& socket) noexcept {
+  return accept_operation(*this, socket);
+}
+
+async_socket::connect_operation async_socket::async_connect(
+    const net::sockets::base_sockaddr& sockaddr) noexcept {
+  return connect_operation(*this, sockaddr);
+}
+
+void async_socket::suspend(operation& awaiting) {
+  operation*& pending =
+      (awaiting.events_ & io::poller::event::kPollIn) != 0 ? reader_ : writer_;
+  pending = &awaiting;
+  try {
+    update(false);
+  } catch (...) {
+    pending = nullptr;
+    throw;
+  }
+}
+
+void async_socket::update(bool keep) {
+  const io::poller::events_t wanted =
+      (reader_ != nullptr ? io::poller::event::kPollIn : 0) |
+      (writer_ != nullptr ? io::poller::event::kPollOut : 0);
+  if (wanted == registered_ ||
+      (wanted == 0 && keep && registered_ == io::poller::event::kPollIn)) {
+    return;
+  }
+
+  if (wanted == 0) {
+    poller_.erase(socket_);
+  } else {
+    poller_.insert_or_assign(socket_, wanted, this);
+  }
+  registered_ = wanted;
+}
+
+async_socket::receive_operation::receive_operation(
+    async_socket& socket, std::span<std::byte> bytes) noexcept
+    : operation(socket, io::poller::event::kPollIn, &attempt), bytes_(bytes) {}
+
+bool async_socket::receive_operation::attempt(operation& operation) {
+  auto& self = static_cast<receive_operation&>(operation);
+  // NOTE: a spurious or stolen readiness keeps the operation pending, only a
+  // receive of zero bytes is the end of the stream
+  const std::optional<std::size_t> received =
+      self.get_socket().try_receive(self.bytes_);
+  if (!received) {
+    return false;
+  }
+  self.received_ = *received;
+  return true;
+}
+
+async_socket::send_operation::send_operation(
+    async_socket& socket, std::span<const std::byte> bytes) noexcept
+    : operation(socket, io::poller::event::kPollOut, &attempt), bytes_(bytes) {}
+
+bool async_socket::send_operation::attempt(operation& operation) {
+  auto& self = static_cast<send_operation&>(operation);
+  self.sent_ = self.get_socket().send(self.bytes_);
+  return self.sent_ > 0 || self.bytes_.empty();
+}
+
+async_socket::accept_operation::accept_operation(
+    async_socket& socket, net::sockets::base_socket& accepted) noexcept
+    : operation(socket, io::poller::event::kPollIn, &attempt),
+      accepted_(accepted) {}
+
+bool async_socket::accept_operation::attempt(operation& operation) {
+  auto& self = static_cast<accept_operation&>(operation);
+  return self.get_socket().accept(self.accepted_) ==
+         net::sockets::base_socket::accept_status::kSuccess;
+}
+
+async_socket::connect_operation::connect_operation(
+    async_socket& socket, const net::sockets::base_sockaddr& sockaddr) noexcept
+    : operation(socket, io::poller::event::kPollOut, &attempt),
+      sockaddr_(sockaddr) {}
+
+bool async_socket::connect_operation::attempt(operation& operation) {
+  auto& self = static_cast<connect_operation&>(operation);
+  // NOTE: a repeated connect() reports the result of the pending one
+  self.status_ = self.get_socket().connect(self.sockaddr_);
+  return self.status_ !=
+         net::sockets::base_socket::connection_status::kPending;
+}
+
+}  // namespace core::coro
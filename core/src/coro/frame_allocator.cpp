@@ -0,0 +1,72 @@
+#include "coro/frame_allocator.hpp"
+
+#include <array>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace core::coro {
+
+namespace {
+
+constexpr std::size_t kGranularity = 64;
+constexpr std::size_t kClasses = 64;
+constexpr std::size_t kMaxFrameSize = kGranularity * kClasses;
+constexpr std::uint32_t kMaxCachedFrames = 256;
+
+struct free_frame final {
+  free_frame* next;
+};
+
+// NOTE: frames are returned to the global allocator on the thread exit
+struct cache final {
+  std::array<free_frame*, kClasses> heads{};
+  std::array<std::uint32_t, kClasses> sizes{};
+
+  ~cache() noexcept {
+    for (free_frame* head : heads) {
+      while (head != nullptr) {
+        ::operator delete(std::exchange(head, head->next));
+      }
+    }
+  }
+};
+
+thread_local cache frames;
+
+constexpr std::size_t get_class(std::size_t size) noexcept {
+  return (size - 1) / kGranularity;
+}
+
+}  // namespace
+
+void* allocate_frame(std::size_t size) {
+  if (size == 0 || size > kMaxFrameSize) [[unlikely]] {
+    return ::operator new(size);
+  }
+
+  const std::size_t index = get_class(size);
+  if (free_frame* frame = frames.heads[index]; frame != nullptr) [[likely]] {
+    frames.heads[index] = frame->next;
+    frames.sizes[index] -= 1;
+    return frame;
+  }
+  return ::operator new((index + 1) * kGranularity);
+}
+
+void deallocate_frame(void* frame, std::size_t size) noexcept {
+  if (size == 0 || size > kMaxFrameSize) [[unlikely]] {
+    ::operator delete(frame);
+    return;
+  }
+
+  const std::size_t index = get_class(size);
+  if (frames.sizes[index] == kMaxCachedFrames) [[unlikely]] {
+    ::operator delete(frame);
+    return;
+  }
+  frames.heads[index] = ::new (frame) free_frame{.next = frames.heads[index]};
+  frames.sizes[index] += 1;
+}
+
+}  // namespace core::coro
@@ -0,0 +1,31 @@
+#include "coro/task.hpp"
+
+namespace core::coro {
+
+namespace {
+
+// NOTE: eagerly started coroutine destroying its frame on completion
+struct detached final {
+  struct promise_type final {
+    static void* operator new(std::size_t size) {
+      return allocate_frame(size);
+    }
+    static void operator delete(void* frame, std::size_t size) noexcept {
+      deallocate_frame(frame, size);
+    }
+
+    detached get_return_object() const noexcept { return {}; }
+    std::suspend_never initial_suspend() const noexcept { return {}; }
+    std::suspend_never final_suspend() const noexcept { return {}; }
+    void return_void() const noexcept {}
+    void unhandled_exception() const noexcept {}
+  };
+};
+
+detached run(task<void> task) { co_await std::move(task); }
+
+}  // namespace
+
+void spawn(task<void> task) { run(std::move(task)); }
+
+}  // namespace core::coro
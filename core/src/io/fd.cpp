@@ -1,8 +1,14 @@
 #include "io/fd.hpp"
 
+#ifdef __linux__
+#include <sys/sendfile.h>
+#endif
+#include <sys/uio.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <cerrno>
+#include <climits>
 #include <format>
 
 namespace core::io {
@@ -120,6 +126,89 @@ void fd::close() {
   }
 }
 
+std::size_t fd::read(std::span<const io::iovec> iovecs) const {
+  const ::ssize_t read = ::readv(
+      pimpl_->native_handle, reinterpret_cast<const ::iovec*>(iovecs.data()),
+      static_cast<int>(std::min<std::size_t>(iovecs.size(), IOV_MAX)));
+  if (read == kSyscallError) {
+    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+      return 0;
+    }
+    throw std::runtime_error(
+        std::format("readv failed: {}", std::strerror(errno)));
+  }
+  return static_cast<std::size_t>(read);
+}
+
+std::size_t fd::write(std::span<const io::const_iovec> iovecs) const {
+  const ::ssize_t written = ::writev(
+      pimpl_->native_handle, reinterpret_cast<const ::iovec*>(iovecs.data()),
+      static_cast<int>(std::min<std::size_t>(iovecs.size(), IOV_MAX)));
+  if (written == kSyscallError) {
+    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+      return 0;
+    }
+    throw std::runtime_error(
+        std::format("writev failed: {}", std::strerror(errno)));
+  }
+  return static_cast<std::size_t>(written);
+}
+
+std::size_t fd::send_file([[maybe_unused]] const io::fd& file,
+                          [[maybe_unused]] std::uint64_t& offset,
+                          [[maybe_unused]] std::size_t count) const {
+#ifdef __linux__
+  ::off_t native_offset = static_cast<::off_t>(offset);
+  const ::ssize_t sent = ::sendfile(
+      pimpl_->native_handle, file.pimpl_->native_handle, &native_offset, count);
+  if (sent == kSyscallError) {
+    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+      return 0;
+    }
+    throw std::runtime_error(
+        std::format("sendfile failed: {}", std::strerror(errno)));
+  }
+  offset = static_cast<std::uint64_t>(native_offset);
+  return static_cast<std::size_t>(sent);
+#else
+  throw std::invalid_argument("sendfile() is not supported on this platform");
+#endif
+}
+
+std::size_t fd::copy_file_range([[maybe_unused]] const io::fd& file,
+                                [[maybe_unused]] std::uint64_t& offset,
+                                [[maybe_unused]] std::uint64_t& out_offset,
+                                [[maybe_unused]] std::size_t count) const {
+#ifdef __linux__
+  ::off64_t native_offset = static_cast<::off64_t>(offset);
+  ::off64_t native_out_offset = static_cast<::off64_t>(out_offset);
+  const ::ssize_t copied =
+      ::copy_file_range(file.pimpl_->native_handle, &native_offset,
+                        pimpl_->native_handle, &native_out_offset, count, 0);
+  if (copied == kSyscallError) {
+    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+      return 0;
+    }
+    throw std::runtime_error(
+        std::format("copy_file_range failed: {}", std::strerror(errno)));
+  }
+  offset = static_cast<std::uint64_t>(native_offset);
+  out_offset = static_cast<std::uint64_t>(native_out_offset);
+  return static_cast<std::size_t>(copied);
+#else
+  throw std::invalid_argument(
+      "copy_file_range() is not supported on this platform");
+#endif
+}
+
 int fd::get_native_handle() const noexcept { return pimpl_->native_handle; }
 
+int fd::get_native_handle(const fd& fd) noexcept {
+  return fd.get_native_handle();
+}
+
+int fd::release() noexcept {
+  return std::exchange(pimpl_->native_handle, kInvalidFd);
+}
+
 }  // namespace core::io
@@ -0,0 +1,75 @@
+#include "io/iovec.hpp"
+
+#include <sys/uio.h>
+
+#include <cstddef>
+
+namespace core::io {
+
+static_assert(sizeof(io::iovec) == sizeof(::iovec));
+static_assert(alignof(io::iovec) == alignof(::iovec));
+static_assert(offsetof(io::iovec, base) == offsetof(::iovec, iov_base));
+static_assert(offsetof(io::iovec, length) == offsetof(::iovec, iov_len));
+static_assert(sizeof(io::const_iovec) == sizeof(::iovec));
+static_assert(alignof(io::const_iovec) == alignof(::iovec));
+static_assert(offsetof(io::const_iovec, base) ==
+              offsetof(::iovec, iov_base));
+static_assert(offsetof(io::const_iovec, length) ==
+              offsetof(::iovec, iov_len));
+
+namespace {
+
+template <typename Byte>
+std::span<io::basic_iovec<Byte>> skip_empty(
+    std::span<io::basic_iovec<Byte>> iovecs) noexcept {
+  while (!iovecs.empty() && iovecs.front().length == 0) {
+    iovecs = iovecs.subspan(1);
+  }
+  return iovecs;
+}
+
+}  // namespace
+
+template <typename Byte>
+basic_iovec_cursor<Byte>::basic_iovec_cursor(
+    std::span<io::basic_iovec<Byte>> iovecs) noexcept
+    : iovecs_(skip_empty(iovecs)) {}
+
+template <typename Byte>
+void basic_iovec_cursor<Byte>::advance(std::size_t bytes) noexcept {
+  while (bytes != 0 && !iovecs_.empty()) {
+    io::basic_iovec<Byte>& front = iovecs_.front();
+    if (bytes < front.length) {
+      front.base += bytes;
+      front.length -= bytes;
+      return;
+    }
+    bytes -= front.length;
+    iovecs_ = skip_empty(iovecs_.subspan(1));
+  }
+}
+
+template <typename Byte>
+std::span<const io::basic_iovec<Byte>> basic_iovec_cursor<Byte>::get_pending()
+    const noexcept {
+  return iovecs_;
+}
+
+template <typename Byte>
+std::size_t basic_iovec_cursor<Byte>::get_pending_bytes() const noexcept {
+  std::size_t bytes = 0;
+  for (const io::basic_iovec<Byte>& iovec : iovecs_) {
+    bytes += iovec.length;
+  }
+  return bytes;
+}
+
+template <typename Byte>
+bool basic_iovec_cursor<Byte>::is_done() const noexcept {
+  return iovecs_.empty();
+}
+
+template class basic_iovec_cursor<std::byte>;
+template class basic_iovec_cursor<const std::byte>;
+
+}  // namespace core::io
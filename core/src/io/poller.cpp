@@ -1,9 +1,20 @@
 #include "io/poller.hpp"
 
+#include <fcntl.h>
 #include <poll.h>
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#endif
+#include <unistd.h>
 
+#include <algorithm>
+#include <atomic>
 #include <format>
-#include <unordered_map>
+#include <memory>
+
+#include "queues/lockfree_mpsc_queue.hpp"
 
 namespace core::io {
 
@@ -12,6 +23,7 @@ namespace {
 constexpr int kSyscallError = -1;
 constexpr short kEmptyEvents = 0;
 constexpr std::chrono::milliseconds kBlockingTimeout(-1);
+constexpr std::int32_t kNoPosition = -1;
 
 constexpr short to_native_events(poller::events_t events) noexcept {
   short native_events = 0;
@@ -35,119 +47,702 @@ constexpr poller::events_t from_native_events(short native_events) noexcept {
   return events;
 }
 
+#ifdef __linux__
+using native_event_t = ::epoll_event;
+
+// NOTE: the maximum number of events returned by a single epoll_wait() call.
+// The rest of the ready descriptors are reported on the next wakeup
+constexpr int kEpollMaxEvents = 1024;
+
+constexpr std::uint32_t to_epoll_events(poller::events_t events) noexcept {
+  std::uint32_t native_events = 0;
+  native_events |= (events & poller::event::kPollIn)
+                       ? static_cast<std::uint32_t>(EPOLLIN)
+                       : 0;
+  native_events |= (events & poller::event::kPollPri)
+                       ? static_cast<std::uint32_t>(EPOLLPRI)
+                       : 0;
+  native_events |= (events & poller::event::kPollOut)
+                       ? static_cast<std::uint32_t>(EPOLLOUT)
+                       : 0;
+  native_events |= (events & poller::event::kPollErr)
+                       ? static_cast<std::uint32_t>(EPOLLERR)
+                       : 0;
+  native_events |= (events & poller::event::kPollHup)
+                       ? static_cast<std::uint32_t>(EPOLLHUP)
+                       : 0;
+  native_events |= (events & poller::event::kPollEt)
+                       ? static_cast<std::uint32_t>(EPOLLET)
+                       : 0;
+  return native_events;
+}
+
+constexpr poller::events_t from_epoll_events(
+    std::uint32_t native_events) noexcept {
+  poller::events_t events = 0;
+  events |= (native_events & EPOLLIN) ? poller::event::kPollIn : 0;
+  events |= (native_events & EPOLLPRI) ? poller::event::kPollPri : 0;
+  events |= (native_events & EPOLLOUT) ? poller::event::kPollOut : 0;
+  events |= (native_events & EPOLLERR) ? poller::event::kPollErr : 0;
+  events |= (native_events & EPOLLHUP) ? poller::event::kPollHup : 0;
+  return events;
+}
+#else
+struct native_event_t final {};
+#endif
+
+// NOTE: the maximum number of the posted tasks waiting to be executed. Also
+// the maximum number of the tasks executed by a single wakeup
+constexpr std::size_t kMailboxCapacity = 1024;
+
+// NOTE: tasks posted from other threads. notified is set by the first post()
+// after the last drain so that the descriptor is written only once per wakeup.
+// On Linux event is an eventfd and notifier is not used, otherwise they are the
+// read and the write ends of a pipe
+struct mailbox final {
+  mailbox(io::fd event, io::fd notifier) noexcept
+      : event(std::move(event)), notifier(std::move(notifier)) {}
+
+  queues::lockfree_mpsc_queue<poller::task_t, std::size_t, kMailboxCapacity>
+      tasks;
+  io::fd event;
+  io::fd notifier;
+  std::atomic<bool> notified = false;
+};
+
+// NOTE: busy polling state. hits and sleeps count the poll() calls that found
+// the events while spinning and the ones that had to block afterwards
+struct spinning final {
+  std::chrono::microseconds budget;
+  std::chrono::microseconds socket_budget;
+  std::uint64_t hits;
+  std::uint64_t sleeps;
+};
+
+using spin_clock_t = std::chrono::steady_clock;
+
+constexpr std::chrono::milliseconds kNonBlockingTimeout(0);
+
+// NOTE: the maximum number of the pause instructions between two nonblocking
+// polls. The backoff doubles after each empty poll
+constexpr std::uint32_t kMaxSpinBackoff = 64;
+
+inline void relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__)
+  asm volatile("yield");
+#endif
+}
+
+// NOTE: descriptors other than sockets are silently skipped
+void set_socket_busy_poll(int native_handle,
+                          std::chrono::microseconds budget) {
+#ifdef __linux__
+  const int value = static_cast<int>(budget.count());
+  if (::setsockopt(native_handle, SOL_SOCKET, SO_BUSY_POLL, &value,
+                   sizeof(value)) == kSyscallError &&
+      errno != ENOTSOCK) [[unlikely]] {
+    throw std::runtime_error(
+        std::format("setsockopt() failed: {}", std::strerror(errno)));
+  }
+#else
+  static_cast<void>(native_handle);
+  static_cast<void>(budget);
+#endif
+}
+
+using instrumentation_clock_t = std::chrono::steady_clock;
+
+// NOTE: returns the epoch if the instrumentation is compiled out so that the
+// measurements are optimized away
+inline instrumentation_clock_t::time_point measure() noexcept {
+  if constexpr (poller::kInstrumented) {
+    return instrumentation_clock_t::now();
+  } else {
+    return instrumentation_clock_t::time_point();
+  }
+}
+
+std::uint64_t to_nanoseconds(instrumentation_clock_t::duration duration) {
+  return static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+}
+
+// NOTE: registration of a descriptor. position is the index of the descriptor
+// in fds or kNoPosition if it is registered only in the kernel (or not at all)
+struct slot final {
+  void* data;
+  std::int32_t position;
+  bool registered;
+};
+
 }  // namespace
 
+// NOTE: slots is indexed directly by the descriptor value. kPoll backend keeps
+// the registered descriptors in fds. kEpoll backend keeps in fds only the
+// descriptors rejected by epoll_ctl() with EPERM (e.g. regular files) which are
+// reported as always ready, the same way poll() does. While dispatching kPoll
+// backend erases from fds lazily by inverting the descriptor which is ignored
+// by poll()
 struct poller::impl final {
   std::vector<::pollfd> fds;
-  std::unordered_map<int, std::size_t> fds_index;
-  std::vector<::pollfd> fds_to_insert;
+  std::vector<slot> slots;
+  std::vector<native_event_t> epoll_events;
+  std::unique_ptr<io::mailbox> mailbox;
+  int ready;
+  int dispatched;
+  int erased;
+  io::fd epoll;
+  poller::backend backend;
+  io::timer_wheel timers;
+  io::spinning spinning;
+  std::unique_ptr<poller::statistics> statistics;
 };
 
-poller::poller(callback_t callback) noexcept
-    : callback_(std::move(callback)) {};
+poller::poller(callback_t callback, poller::backend backend)
+    : pimpl_(impl{
+          .fds = {},
+          .slots = {},
+          .epoll_events = {},
+          .mailbox = nullptr,
+          .ready = 0,
+          .dispatched = 0,
+          .erased = 0,
+          .epoll = [backend] {
+            switch (backend) {
+              case poller::backend::kPoll:
+                return io::fd(utils::uninitialized_t{});
+              case poller::backend::kEpoll:
+#ifdef __linux__
+                if (const int epoll = ::epoll_create1(EPOLL_CLOEXEC);
+                    epoll != kSyscallError) [[likely]] {
+                  return io::fd(epoll);
+                }
+                throw std::runtime_error(std::format(
+                    "epoll_create1() failed: {}", std::strerror(errno)));
+#else
+                throw std::invalid_argument(
+                    "epoll backend is not supported on this platform");
+#endif
+            }
+          }(),
+          .backend = backend,
+          .timers = io::timer_wheel(),
+          .spinning = {},
+          .statistics = nullptr,
+      }),
+      callback_(std::move(callback)) {
+  if constexpr (kInstrumented) {
+    pimpl_->statistics = std::make_unique<poller::statistics>();
+  }
+  if (backend == poller::backend::kEpoll) {
+    pimpl_->epoll_events.resize(kEpollMaxEvents);
+  }
 
-poller::poller(poller&& that) noexcept : pimpl_(std::move(that.pimpl_)) {}
+#ifdef __linux__
+  const int event = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (event == kSyscallError) [[unlikely]] {
+    throw std::runtime_error(
+        std::format("eventfd() failed: {}", std::strerror(errno)));
+  }
+  pimpl_->mailbox = std::make_unique<io::mailbox>(
+      io::fd(event), io::fd(utils::uninitialized_t{}));
+#else
+  int pipe[2];
+  if (::pipe(pipe) == kSyscallError) [[unlikely]] {
+    throw std::runtime_error(
+        std::format("pipe() failed: {}", std::strerror(errno)));
+  }
+  pimpl_->mailbox =
+      std::make_unique<io::mailbox>(io::fd(pipe[0]), io::fd(pipe[1]));
+  for (const int end : pipe) {
+    if (::fcntl(end, F_SETFL, ::fcntl(end, F_GETFL) | O_NONBLOCK) ==
+            kSyscallError ||
+        ::fcntl(end, F_SETFD, FD_CLOEXEC) == kSyscallError) [[unlikely]] {
+      throw std::runtime_error(
+          std::format("fcntl() failed: {}", std::strerror(errno)));
+    }
+  }
+#endif
+  io::mailbox& mailbox = *pimpl_->mailbox;
+  insert_or_assign(mailbox.event, poller::event::kPollIn, &mailbox);
+}
+
+poller::poller(poller&& that) noexcept
+    : pimpl_(std::move(that.pimpl_)), callback_(std::move(that.callback_)) {}
 
 poller& poller::operator=(poller&& that) noexcept {
   pimpl_ = std::move(that.pimpl_);
+  callback_ = std::move(that.callback_);
   return *this;
 }
 
 poller::~poller() noexcept = default;
 
-bool poller::insert_or_assign(const io::fd& fd, events_t events) {
-  auto& [fds, fds_index, fds_to_insert] = *pimpl_;
+poller::backend poller::get_backend() const noexcept {
+  return pimpl_->backend;
+}
+
+bool poller::insert_or_assign(const io::fd& fd, events_t events, void* data) {
+  auto& [fds, slots, epoll_events, mailbox, ready, dispatched, erased, epoll,
+         backend, timers, spinning, statistics] = *pimpl_;
+
+  const int native_handle = fd.get_native_handle();
+  if (slots.size() <= static_cast<std::size_t>(native_handle)) [[unlikely]] {
+    slots.resize(std::max<std::size_t>(native_handle + 1, slots.size() * 2),
+                 slot{.data = nullptr,
+                      .position = kNoPosition,
+                      .registered = false});
+  }
+  slot& slot = slots[native_handle];
+  if (!slot.registered && spinning.socket_budget.count() > 0) [[unlikely]] {
+    set_socket_busy_poll(native_handle, spinning.socket_budget);
+  }
+
+  if (backend == poller::backend::kEpoll) {
+#ifdef __linux__
+    if (slot.position != kNoPosition) [[unlikely]] {
+      fds[slot.position].events = to_native_events(events);
+      slot.data = data;
+      return false;
+    }
 
-  auto fds_it = fds_index.find(fd.get_native_handle());
-  if (fds_it != fds_index.end()) [[unlikely]] {
-    fds.at(fds_it->second).events = to_native_events(events);
+    ::epoll_event event{.events = to_epoll_events(events),
+                        .data = {.fd = native_handle}};
+    // NOTE: the descriptor may have been closed and reused without erase() so
+    // the kernel is the source of truth and the operation is retried
+    const int operation = slot.registered ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+    if (::epoll_ctl(epoll.get_native_handle(), operation, native_handle,
+                    &event) != kSyscallError) [[likely]] {
+      slot.data = data;
+      return !std::exchange(slot.registered, true);
+    }
+
+    switch (errno) {
+      case EEXIST:
+      case ENOENT:
+        if (::epoll_ctl(epoll.get_native_handle(),
+                        errno == EEXIST ? EPOLL_CTL_MOD : EPOLL_CTL_ADD,
+                        native_handle, &event) == kSyscallError) [[unlikely]] {
+          throw std::runtime_error(std::format("epoll_ctl() failed: {}",
+                                               std::strerror(errno)));
+        }
+        slot.data = data;
+        return !std::exchange(slot.registered, true);
+      case EPERM:
+        if (events & poller::event::kPollEt) [[unlikely]] {
+          throw std::invalid_argument(
+              "edge-triggered registration of an always ready fd");
+        }
+        slot = {.data = data,
+                .position = static_cast<std::int32_t>(fds.size()),
+                .registered = true};
+        fds.push_back(::pollfd{.fd = native_handle,
+                               .events = to_native_events(events),
+                               .revents = kEmptyEvents});
+        return true;
+      [[unlikely]] default:
+        throw std::runtime_error(
+            std::format("epoll_ctl() failed: {}", std::strerror(errno)));
+    }
+#endif
+  }
+
+  if (events & poller::event::kPollEt) [[unlikely]] {
+    throw std::invalid_argument(
+        "edge-triggered registration is not supported by poll backend");
+  }
+
+  slot.data = data;
+  if (slot.registered) [[unlikely]] {
+    fds[slot.position].events = to_native_events(events);
     return false;
   }
 
-  auto fds_to_insert_it =
-      std::find_if(fds_to_insert.begin(), fds_to_insert.end(),
-                   [&fd](const ::pollfd& pollfd) {
-                     return pollfd.fd == fd.get_native_handle();
-                   });
-  if (fds_to_insert_it != fds_to_insert.end()) [[unlikely]] {
-    fds_to_insert_it->events = to_native_events(events);
+  slot.position = static_cast<std::int32_t>(fds.size());
+  slot.registered = true;
+  fds.push_back(::pollfd{.fd = native_handle,
+                         .events = to_native_events(events),
+                         .revents = kEmptyEvents});
+  return true;
+}
+
+bool poller::erase(const io::fd& fd) {
+  auto& [fds, slots, epoll_events, mailbox, ready, dispatched, erased, epoll,
+         backend, timers, spinning, statistics] = *pimpl_;
+
+  const int native_handle = fd.get_native_handle();
+  if (slots.size() <= static_cast<std::size_t>(native_handle) ||
+      !slots[native_handle].registered) [[unlikely]] {
     return false;
   }
+  slot& slot = slots[native_handle];
 
-  if (fds.size() < fds.capacity()) [[likely]] {
-    fds.push_back(::pollfd{.fd = fd.get_native_handle(),
-                           .events = to_native_events(events)});
+  if (backend == poller::backend::kEpoll) {
+#ifdef __linux__
+    if (slot.position != kNoPosition) [[unlikely]] {
+      slots[fds.back().fd].position = slot.position;
+      std::swap(fds[slot.position], fds.back());
+      fds.pop_back();
+    } else if (::epoll_ctl(epoll.get_native_handle(), EPOLL_CTL_DEL,
+                           native_handle, nullptr) == kSyscallError) {
+      switch (errno) {
+        case ENOENT:
+        case EPERM:
+          slot = {
+              .data = nullptr, .position = kNoPosition, .registered = false};
+          return false;
+        [[unlikely]] default:
+          throw std::runtime_error(
+              std::format("epoll_ctl() failed: {}", std::strerror(errno)));
+      }
+    }
+    slot = {.data = nullptr, .position = kNoPosition, .registered = false};
+
+    // NOTE: the events of the erased fd that are already fetched but not yet
+    // dispatched must not be delivered to the callback
+    for (int i = dispatched + 1; i < ready; ++i) {
+      if (epoll_events[i].data.fd == native_handle) {
+        epoll_events[i].events = 0;
+      }
+    }
+    return true;
+#endif
+  }
+
+  if (ready > 0) {
+    fds[slot.position].fd = ~native_handle;
+    erased += 1;
   } else {
-    fds_to_insert.push_back(::pollfd{.fd = fd.get_native_handle(),
-                                     .events = to_native_events(events)});
+    if (fds.back().fd >= 0) [[likely]] {
+      slots[fds.back().fd].position = slot.position;
+    }
+    std::swap(fds[slot.position], fds.back());
+    fds.pop_back();
   }
+  slot = {.data = nullptr, .position = kNoPosition, .registered = false};
   return true;
 }
 
-bool poller::erase(const io::fd& fd) {
-  auto& [fds, fds_index, fds_to_insert] = *pimpl_;
+void poller::post(task_t task) {
+  pimpl_->mailbox->tasks.push(std::move(task));
+  wakeup();
+}
 
-  auto it = fds_index.find(fd.get_native_handle());
-  if (it != fds_index.end()) [[likely]] {
-    fds.at(it->second).fd = -fds.at(it->second).fd;
-    return true;
+bool poller::try_post(task_t task) {
+  if (!pimpl_->mailbox->tasks.try_push(std::move(task))) [[unlikely]] {
+    return false;
   }
+  wakeup();
+  return true;
+}
 
-  auto fds_to_insert_it =
-      std::find_if(fds_to_insert.begin(), fds_to_insert.end(),
-                   [&fd](const ::pollfd& pollfd) {
-                     return pollfd.fd == fd.get_native_handle();
-                   });
-  if (fds_to_insert_it != fds_to_insert.end()) [[unlikely]] {
-    fds_to_insert_it->fd = -fds_to_insert_it->fd;
-    return true;
+void poller::wakeup() {
+  io::mailbox& mailbox = *pimpl_->mailbox;
+  if (mailbox.notified.exchange(true, std::memory_order::acq_rel)) {
+    return;
+  }
+
+#ifdef __linux__
+  const std::uint64_t value = 1;
+  const int notifier = mailbox.event.get_native_handle();
+#else
+  const std::uint8_t value = 1;
+  const int notifier = mailbox.notifier.get_native_handle();
+#endif
+  if (::write(notifier, &value, sizeof(value)) == kSyscallError &&
+      errno != EAGAIN) [[unlikely]] {
+    throw std::runtime_error(
+        std::format("write() failed: {}", std::strerror(errno)));
+  }
+}
+
+void poller::set_busy_poll(const poller::busy_poll& busy_poll) {
+  if (busy_poll.budget.count() < 0 || busy_poll.socket_budget.count() < 0)
+      [[unlikely]] {
+    throw std::invalid_argument("busy poll budget must not be negative");
   }
+#ifndef __linux__
+  if (busy_poll.socket_budget.count() > 0) {
+    throw std::invalid_argument(
+        "SO_BUSY_POLL is not supported on this platform");
+  }
+#endif
+
+  const auto& slots = pimpl_->slots;
+  io::spinning& spinning = pimpl_->spinning;
+  if (busy_poll.socket_budget != spinning.socket_budget) {
+    for (std::size_t i = 0; i < slots.size(); ++i) {
+      if (slots[i].registered) {
+        set_socket_busy_poll(static_cast<int>(i), busy_poll.socket_budget);
+      }
+    }
+  }
+  spinning.budget = busy_poll.budget;
+  spinning.socket_budget = busy_poll.socket_budget;
+}
+
+poller::busy_poll_counters poller::get_busy_poll_counters() const noexcept {
+  return poller::busy_poll_counters{
+      .spin_hits = pimpl_->spinning.hits,
+      .sleeps = pimpl_->spinning.sleeps,
+  };
+}
+
+poller::statistics poller::get_statistics() const {
+  if constexpr (kInstrumented) {
+    return *pimpl_->statistics;
+  } else {
+    return poller::statistics{};
+  }
+}
+
+void poller::reset_statistics() noexcept {
+  if constexpr (kInstrumented) {
+    *pimpl_->statistics = poller::statistics{};
+  }
+}
+
+timer_wheel::timer_id_t poller::schedule(std::chrono::milliseconds timeout,
+                                         timer_wheel::callback_t callback) {
+  return pimpl_->timers.schedule(timeout, std::move(callback));
+}
 
-  return false;
+bool poller::cancel(timer_wheel::timer_id_t timer) noexcept {
+  return pimpl_->timers.cancel(timer);
 }
 
 std::size_t poller::try_poll(std::chrono::milliseconds timeout) {
-  auto& [fds, fds_index, fds_to_insert] = *pimpl_;
+  auto& [fds, slots, epoll_events, mailbox, ready, dispatched, erased, epoll,
+         backend, timers, spinning, statistics] = *pimpl_;
+  [[maybe_unused]] const instrumentation_clock_t::time_point started =
+      measure();
 
-  if (!fds_to_insert.empty()) [[unlikely]] {
-    fds.reserve(fds.size() + fds_to_insert.size());
-    for (std::size_t i = 0; i < fds_to_insert.size(); ++i) {
-      fds_index.emplace(fds_to_insert.at(i).fd, fds.size() + i);
+  // NOTE: notified is reset before popping the tasks so that a task posted
+  // after the last pop always results in another wakeup
+  const auto drain = [this, &mailbox] {
+#ifdef __linux__
+    std::uint64_t value;
+    static_cast<void>(
+        ::read(mailbox->event.get_native_handle(), &value, sizeof(value)));
+#else
+    std::uint8_t values[64];
+    while (::read(mailbox->event.get_native_handle(), values,
+                  sizeof(values)) > 0);
+#endif
+    mailbox->notified.exchange(false, std::memory_order::acq_rel);
+
+    std::size_t unhandled = 0;
+    task_t task;
+    for (std::size_t i = 0; i < kMailboxCapacity; ++i) {
+      if (!mailbox->tasks.try_pop(task)) {
+        return unhandled;
+      }
+
+      try {
+        task();
+      } catch (...) {
+        unhandled += 1;
+      }
+      task = nullptr;
+    }
+    wakeup();
+    return unhandled;
+  };
+
+  // NOTE: returns the number of the ready descriptors or kSyscallError if
+  // interrupted. kEpoll backend reports the always ready descriptors after the
+  // ones fetched from the kernel
+  const auto wait = [&fds, &epoll_events, &epoll,
+                     &backend](std::chrono::milliseconds timeout) {
+    if (backend == poller::backend::kEpoll) {
+#ifdef __linux__
+      if (epoll_events.size() < fds.size() + kEpollMaxEvents) [[unlikely]] {
+        epoll_events.resize(fds.size() + kEpollMaxEvents);
+      }
+
+      int ready = ::epoll_wait(epoll.get_native_handle(), epoll_events.data(),
+                               kEpollMaxEvents,
+                               fds.empty() ? timeout.count() : 0);
+      if (ready == kSyscallError) [[unlikely]] {
+        if (errno == EINTR) {
+          return kSyscallError;
+        }
+        throw std::runtime_error(
+            std::format("epoll_wait() failed: {}", std::strerror(errno)));
+      }
+
+      for (const ::pollfd& pollfd : fds) {
+        epoll_events[ready++] = ::epoll_event{
+            .events = to_epoll_events(from_native_events(
+                pollfd.events & static_cast<short>(POLLIN | POLLOUT))),
+            .data = {.fd = pollfd.fd}};
+      }
+      return ready;
+#endif
+    }
+
+    const int affected = ::poll(fds.data(), fds.size(), timeout.count());
+    if (affected == kSyscallError) [[unlikely]] {
+      throw std::runtime_error(
+          std::format("poll() failed: {}", std::strerror(errno)));
+    }
+    return affected;
+  };
+
+  if (!timers.empty()) {
+    const std::chrono::milliseconds timers_timeout =
+        timers.get_timeout(timer_wheel::clock_t::now());
+    if (timeout < std::chrono::milliseconds(0) || timers_timeout < timeout) {
+      timeout = timers_timeout;
     }
-    fds.insert(fds.end(), fds_to_insert.begin(), fds_to_insert.end());
   }
 
-  int affected = ::poll(fds.data(), fds.size(), timeout.count());
-  if (affected == kSyscallError) [[unlikely]] {
-    throw std::runtime_error(
-        std::format("poll() failed: {}", std::strerror(errno)));
+  const instrumentation_clock_t::time_point waited = measure();
+  int affected = 0;
+  if (spinning.budget.count() > 0 && timeout.count() != 0) {
+    const spin_clock_t::time_point start = spin_clock_t::now();
+    const spin_clock_t::time_point deadline =
+        start + (timeout.count() < 0
+                     ? spinning.budget
+                     : std::min<std::chrono::microseconds>(spinning.budget,
+                                                           timeout));
+    for (std::uint32_t backoff = 1; (affected = wait(kNonBlockingTimeout)) == 0;
+         backoff = std::min(backoff * 2, kMaxSpinBackoff)) {
+      if (spin_clock_t::now() >= deadline) {
+        break;
+      }
+      for (std::uint32_t i = 0; i < backoff; ++i) {
+        relax();
+      }
+    }
+
+    if (affected > 0) {
+      spinning.hits += 1;
+    } else if (affected == 0) {
+      spinning.sleeps += 1;
+      if (timeout.count() > 0) {
+        timeout = std::max(
+            std::chrono::milliseconds(0),
+            timeout - std::chrono::floor<std::chrono::milliseconds>(
+                          spin_clock_t::now() - start));
+      }
+      affected = wait(timeout);
+    }
+  } else {
+    affected = wait(timeout);
   }
 
+  // NOTE: the iteration excludes the wait and thus is accounted on return
+  [[maybe_unused]] const instrumentation_clock_t::duration wait_duration =
+      measure() - waited;
+  const auto account = [&] {
+    if constexpr (kInstrumented) {
+      statistics->iteration.record(
+          to_nanoseconds(measure() - started - wait_duration));
+    }
+  };
+  if constexpr (kInstrumented) {
+    statistics->wait.record(to_nanoseconds(wait_duration));
+    statistics->events.record(
+        static_cast<std::uint64_t>(std::max(affected, 0)));
+  }
+  const auto dispatch = [&](const io::fd& fd, events_t events, void* data) {
+    const instrumentation_clock_t::time_point called = measure();
+    callback_(*this, fd, events, data);
+    if constexpr (kInstrumented) {
+      const instrumentation_clock_t::duration duration = measure() - called;
+      statistics->callback.record(to_nanoseconds(duration));
+      if (duration > statistics->slowest_callback) {
+        statistics->slowest_callback =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(duration);
+        statistics->slowest_data = data;
+      }
+    }
+  };
+
   std::size_t unhandled = 0;
-  for (std::size_t i = 0; i < fds.size() && affected > 0; ++i) {
-    if (fds.at(i).fd < 0) [[unlikely]] {
-      fds_index.at(fds.back().fd) = fds_index.at(-fds.at(i).fd);
-      std::swap(fds.back(), fds.at(i));
+  if (backend == poller::backend::kEpoll) {
+#ifdef __linux__
+    if (affected == kSyscallError) [[unlikely]] {
+      account();
+      return 0;
+    }
+
+    for (ready = affected, dispatched = 0; dispatched < ready; ++dispatched) {
+      const std::uint32_t native_events = epoll_events[dispatched].events;
+      if (native_events == 0) [[unlikely]] {
+        continue;
+      }
+
+      const int native_handle = epoll_events[dispatched].data.fd;
+      void* const data = slots[native_handle].data;
+      if (data == mailbox.get()) [[unlikely]] {
+        unhandled += drain();
+        continue;
+      }
+
+      try {
+        dispatch(
+            *std::launder(reinterpret_cast<const io::fd*>(&native_handle)),
+            from_epoll_events(native_events), data);
+      } catch (...) {
+        unhandled += 1;
+      }
+    }
+    ready = dispatched = 0;
+    if (!timers.empty()) {
+      unhandled += timers.advance(timer_wheel::clock_t::now());
+    }
+    account();
+    return unhandled;
+#endif
+  }
 
-      fds_index.erase(fds.at(i).fd);
+  // NOTE: the callback may insert into fds and reallocate it so neither the
+  // descriptor nor the events are referenced from fds while being dispatched.
+  // The descriptors erased while dispatching are compacted by the same loop
+  ready = affected;
+  for (std::size_t i = 0; i < fds.size() && (affected > 0 || erased > 0);
+       ++i) {
+    if (fds[i].fd < 0) [[unlikely]] {
+      std::swap(fds[i], fds.back());
       fds.pop_back();
+      if (i < fds.size() && fds[i].fd >= 0) {
+        slots[fds[i].fd].position = static_cast<std::int32_t>(i);
+      }
+      erased -= 1;
       i -= 1;
       continue;
     }
 
-    if (fds.at(i).revents == kEmptyEvents) {
+    const short revents = std::exchange(fds[i].revents, kEmptyEvents);
+    if (revents == kEmptyEvents) {
+      continue;
+    }
+
+    const int native_handle = fds[i].fd;
+    void* const data = slots[native_handle].data;
+    affected -= 1;
+    if (data == mailbox.get()) [[unlikely]] {
+      unhandled += drain();
       continue;
     }
 
     try {
-      callback_(*this,
-                *std::launder(reinterpret_cast<const io::fd*>(&fds.at(i).fd)),
-                from_native_events(fds.at(i).revents));
+      dispatch(*std::launder(reinterpret_cast<const io::fd*>(&native_handle)),
+               from_native_events(revents), data);
     } catch (...) {
       unhandled += 1;
     }
-    affected -= 1;
   }
+  ready = 0;
+
+  if (!timers.empty()) {
+    unhandled += timers.advance(timer_wheel::clock_t::now());
+  }
+  account();
   return unhandled;
 }
 
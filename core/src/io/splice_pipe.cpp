@@ -0,0 +1,159 @@
+#include "io/splice_pipe.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <format>
+
+namespace core::io {
+
+namespace {
+
+[[maybe_unused]] constexpr int kSyscallError = -1;
+
+}  // namespace
+
+struct splice_pipe::impl final {
+  io::fd reader;
+  io::fd writer;
+  std::size_t pending;
+};
+
+splice_pipe::splice_pipe()
+    : pimpl_([] {
+#ifdef __linux__
+        std::array<int, 2> pipe;
+        if (::pipe2(pipe.data(), O_NONBLOCK | O_CLOEXEC) == kSyscallError)
+            [[unlikely]] {
+          throw std::runtime_error(
+              std::format("pipe2() failed: {}", std::strerror(errno)));
+        }
+        return impl{
+            .reader = io::fd(pipe[0]),
+            .writer = io::fd(pipe[1]),
+            .pending = 0,
+        };
+#else
+        throw std::invalid_argument(
+            "splice() is not supported on this platform");
+#endif
+      }()) {
+}
+
+splice_pipe::splice_pipe(splice_pipe&& that) noexcept
+    : pimpl_(std::move(that.pimpl_)) {}
+
+splice_pipe& splice_pipe::operator=(splice_pipe&& that) noexcept {
+  pimpl_ = std::move(that.pimpl_);
+  return *this;
+}
+
+splice_pipe::~splice_pipe() noexcept = default;
+
+std::optional<std::size_t> splice_pipe::fill(
+    [[maybe_unused]] const io::fd& in, [[maybe_unused]] std::size_t count) {
+#ifdef __linux__
+  auto& [_, writer, pending] = *pimpl_;
+  const ::ssize_t spliced =
+      ::splice(in.get_native_handle(), nullptr, writer.get_native_handle(),
+               nullptr, count, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+  if (spliced == kSyscallError) {
+    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+      return std::nullopt;
+    }
+    throw std::runtime_error(
+        std::format("splice failed: {}", std::strerror(errno)));
+  }
+  pending += static_cast<std::size_t>(spliced);
+  return static_cast<std::size_t>(spliced);
+#else
+  return std::nullopt;
+#endif
+}
+
+std::size_t splice_pipe::drain([[maybe_unused]] const io::fd& out,
+                               [[maybe_unused]] std::size_t count) {
+#ifdef __linux__
+  auto& [reader, _, pending] = *pimpl_;
+  if (pending == 0) {
+    return 0;
+  }
+  const ::ssize_t spliced = ::splice(
+      reader.get_native_handle(), nullptr, out.get_native_handle(),
+      nullptr, std::min(count, pending), SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+  if (spliced == kSyscallError) {
+    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+      return 0;
+    }
+    throw std::runtime_error(
+        std::format("splice failed: {}", std::strerror(errno)));
+  }
+  pending -= static_cast<std::size_t>(spliced);
+  return static_cast<std::size_t>(spliced);
+#else
+  return 0;
+#endif
+}
+
+std::size_t splice_pipe::tee([[maybe_unused]] splice_pipe& that,
+                             [[maybe_unused]] std::size_t count) {
+#ifdef __linux__
+  if (pimpl_->pending == 0) {
+    return 0;
+  }
+  const ::ssize_t teed = ::tee(pimpl_->reader.get_native_handle(),
+                               that.pimpl_->writer.get_native_handle(),
+                               std::min(count, pimpl_->pending),
+                               SPLICE_F_NONBLOCK);
+  if (teed == kSyscallError) {
+    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+      return 0;
+    }
+    throw std::runtime_error(
+        std::format("tee failed: {}", std::strerror(errno)));
+  }
+  that.pimpl_->pending += static_cast<std::size_t>(teed);
+  return static_cast<std::size_t>(teed);
+#else
+  return 0;
+#endif
+}
+
+std::optional<std::size_t> splice_pipe::transfer(const io::fd& in,
+                                                 const io::fd& out,
+                                                 std::size_t count) {
+  const std::optional<std::size_t> filled = fill(in, count);
+  const std::size_t drained = drain(out);
+  if (drained != 0) {
+    return drained;
+  }
+  // NOTE: the end of the source is reported only after the bytes that were
+  // spliced before it have left the pipe
+  if (filled == 0 && pimpl_->pending == 0) {
+    return 0;
+  }
+  return std::nullopt;
+}
+
+std::size_t splice_pipe::get_pending() const noexcept {
+  return pimpl_->pending;
+}
+
+std::size_t splice_pipe::get_capacity() const {
+#ifdef __linux__
+  const int capacity =
+      ::fcntl(pimpl_->writer.get_native_handle(), F_GETPIPE_SZ);
+  if (capacity == kSyscallError) [[unlikely]] {
+    throw std::runtime_error(std::format("failed to get F_GETPIPE_SZ: {}",
+                                         std::strerror(errno)));
+  }
+  return static_cast<std::size_t>(capacity);
+#else
+  return 0;
+#endif
+}
+
+}  // namespace core::io
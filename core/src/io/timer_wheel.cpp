@@ -0,0 +1,268 @@
+#include "io/timer_wheel.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <limits>
+#include <vector>
+
+namespace core::io {
+
+namespace {
+
+constexpr std::size_t kLevels = 4;
+constexpr std::size_t kSlotBits = 6;
+constexpr std::size_t kSlots = 1 << kSlotBits;
+constexpr std::uint64_t kSlotMask = kSlots - 1;
+constexpr std::uint64_t kMaxDelta = (1ull << (kLevels * kSlotBits)) - 1;
+constexpr std::uint64_t kNoTick = std::numeric_limits<std::uint64_t>::max();
+
+constexpr std::uint32_t kNoNode = -1;
+constexpr std::uint16_t kExpiredSlot = kLevels * kSlots;
+constexpr std::uint16_t kNoSlot = -1;
+
+constexpr std::chrono::milliseconds kBlockingTimeout(-1);
+
+struct node final {
+  timer_wheel::callback_t callback;
+  std::uint64_t deadline;
+  std::uint32_t prev;
+  std::uint32_t next;
+  std::uint32_t generation;
+  std::uint16_t slot;
+};
+
+}  // namespace
+
+// NOTE: ticks are milliseconds since start. now is the last processed tick.
+// Each slot of a level above zero is cascaded to the lower levels at the tick
+// when the level below it wraps around. The extra list after the slots keeps
+// the timers expired at the tick being processed
+struct timer_wheel::impl final {
+  std::vector<node> nodes;
+  std::array<std::uint64_t, kLevels> occupied;
+  clock_t::time_point start;
+  std::uint64_t now;
+  std::uint32_t free;
+  std::uint32_t size;
+  std::array<std::uint32_t, kLevels * kSlots + 1> heads;
+
+  void link(std::uint32_t index, std::uint16_t slot) noexcept {
+    node& node = nodes[index];
+    node.slot = slot;
+    node.prev = kNoNode;
+    node.next = std::exchange(heads[slot], index);
+    if (node.next != kNoNode) {
+      nodes[node.next].prev = index;
+    }
+    if (slot != kExpiredSlot) {
+      occupied[slot / kSlots] |= 1ull << (slot % kSlots);
+    }
+  }
+
+  void unlink(std::uint32_t index) noexcept {
+    node& node = nodes[index];
+    if (node.prev != kNoNode) {
+      nodes[node.prev].next = node.next;
+    } else {
+      heads[node.slot] = node.next;
+    }
+    if (node.next != kNoNode) {
+      nodes[node.next].prev = node.prev;
+    }
+    if (node.slot != kExpiredSlot && heads[node.slot] == kNoNode) {
+      occupied[node.slot / kSlots] &= ~(1ull << (node.slot % kSlots));
+    }
+  }
+
+  void insert(std::uint32_t index) noexcept {
+    const std::uint64_t deadline = std::max(nodes[index].deadline, now + 1);
+    const std::uint64_t at = std::min(deadline, now + kMaxDelta);
+    const std::size_t level =
+        static_cast<std::size_t>(std::bit_width(at - now) - 1) / kSlotBits;
+    const std::size_t slot = (at >> (level * kSlotBits)) & kSlotMask;
+    link(index, static_cast<std::uint16_t>(level * kSlots + slot));
+  }
+
+  void release(std::uint32_t index) noexcept {
+    node& node = nodes[index];
+    node.callback = nullptr;
+    node.generation += 1;
+    node.slot = kNoSlot;
+    node.next = std::exchange(free, index);
+    size -= 1;
+  }
+
+  // NOTE: returns the first tick after now at which either a level zero slot
+  // fires or a slot of the upper levels is cascaded
+  std::uint64_t get_next_tick() const noexcept {
+    std::uint64_t next_tick = kNoTick;
+    for (std::size_t level = 0; level < kLevels; ++level) {
+      if (occupied[level] == 0) {
+        continue;
+      }
+
+      const std::size_t shift = level * kSlotBits;
+      const std::uint64_t period = (now >> shift) + 1;
+      const std::uint64_t rotated =
+          std::rotr(occupied[level], static_cast<int>(period & kSlotMask));
+      next_tick =
+          std::min(next_tick, (period + std::countr_zero(rotated)) << shift);
+    }
+    return next_tick;
+  }
+};
+
+timer_wheel::timer_wheel(clock_t::time_point now)
+    : pimpl_(impl{
+          .nodes = {},
+          .occupied = {},
+          .start = now,
+          .now = 0,
+          .free = kNoNode,
+          .size = 0,
+          .heads = {},
+      }) {
+  pimpl_->heads.fill(kNoNode);
+}
+
+timer_wheel::timer_wheel(timer_wheel&& that) noexcept
+    : pimpl_(std::move(that.pimpl_)) {}
+
+timer_wheel& timer_wheel::operator=(timer_wheel&& that) noexcept {
+  pimpl_ = std::move(that.pimpl_);
+  return *this;
+}
+
+timer_wheel::~timer_wheel() noexcept = default;
+
+std::size_t timer_wheel::size() const noexcept { return pimpl_->size; }
+
+bool timer_wheel::empty() const noexcept { return pimpl_->size == 0; }
+
+timer_wheel::timer_id_t timer_wheel::schedule(clock_t::time_point deadline,
+                                              callback_t callback) {
+  auto& [nodes, _, start, now, free, size, heads] = *pimpl_;
+
+  std::uint32_t index = free;
+  if (index != kNoNode) {
+    free = nodes[index].next;
+  } else {
+    index = static_cast<std::uint32_t>(nodes.size());
+    nodes.push_back(node{
+        .callback = {},
+        .deadline = 0,
+        .prev = kNoNode,
+        .next = kNoNode,
+        .generation = 0,
+        .slot = kNoSlot,
+    });
+  }
+
+  node& node = nodes[index];
+  node.callback = std::move(callback);
+  node.deadline =
+      deadline > start
+          ? std::chrono::ceil<std::chrono::milliseconds>(deadline - start)
+                .count()
+          : 0;
+  pimpl_->insert(index);
+  size += 1;
+  return static_cast<timer_id_t>(node.generation) << 32 | index;
+}
+
+timer_wheel::timer_id_t timer_wheel::schedule(
+    std::chrono::milliseconds timeout, callback_t callback) {
+  return schedule(clock_t::now() + timeout, std::move(callback));
+}
+
+bool timer_wheel::cancel(timer_id_t timer) noexcept {
+  const std::uint32_t index = static_cast<std::uint32_t>(timer);
+  const std::uint32_t generation = static_cast<std::uint32_t>(timer >> 32);
+
+  auto& nodes = pimpl_->nodes;
+  if (index >= nodes.size() || nodes[index].generation != generation ||
+      nodes[index].slot == kNoSlot) [[unlikely]] {
+    return false;
+  }
+
+  pimpl_->unlink(index);
+  pimpl_->release(index);
+  return true;
+}
+
+std::chrono::milliseconds timer_wheel::get_timeout(
+    clock_t::time_point now) const noexcept {
+  if (pimpl_->size == 0) {
+    return kBlockingTimeout;
+  }
+
+  const clock_t::time_point next =
+      pimpl_->start + std::chrono::milliseconds(pimpl_->get_next_tick());
+  if (next <= now) {
+    return std::chrono::milliseconds(0);
+  }
+  return std::chrono::ceil<std::chrono::milliseconds>(next - now);
+}
+
+std::size_t timer_wheel::advance(clock_t::time_point now) {
+  auto& [nodes, _, start, tick, free, size, heads] = *pimpl_;
+  if (now <= start) [[unlikely]] {
+    return 0;
+  }
+
+  std::size_t unhandled = 0;
+  const std::uint64_t target =
+      std::chrono::floor<std::chrono::milliseconds>(now - start).count();
+  while (tick < target && size > 0) {
+    const std::uint64_t next_tick = pimpl_->get_next_tick();
+    if (next_tick > target) {
+      break;
+    }
+    tick = next_tick;
+
+    for (std::size_t level = 1; level < kLevels; ++level) {
+      const std::size_t shift = level * kSlotBits;
+      if ((tick & ((1ull << shift) - 1)) != 0) {
+        break;
+      }
+
+      const std::uint16_t slot = static_cast<std::uint16_t>(
+          level * kSlots + ((tick >> shift) & kSlotMask));
+      while (heads[slot] != kNoNode) {
+        const std::uint32_t index = heads[slot];
+        pimpl_->unlink(index);
+        if (nodes[index].deadline <= tick) {
+          pimpl_->link(index, kExpiredSlot);
+        } else {
+          pimpl_->insert(index);
+        }
+      }
+    }
+
+    const std::uint16_t slot = static_cast<std::uint16_t>(tick & kSlotMask);
+    while (heads[slot] != kNoNode) {
+      const std::uint32_t index = heads[slot];
+      pimpl_->unlink(index);
+      pimpl_->link(index, kExpiredSlot);
+    }
+
+    while (heads[kExpiredSlot] != kNoNode) {
+      const std::uint32_t index = heads[kExpiredSlot];
+      callback_t callback = std::move(nodes[index].callback);
+      pimpl_->unlink(index);
+      pimpl_->release(index);
+      try {
+        if (callback) [[likely]] {
+          callback();
+        }
+      } catch (...) {
+        unhandled += 1;
+      }
+    }
+  }
+  tick = std::max(tick, target);
+  return unhandled;
+}
+
+}  // namespace core::io
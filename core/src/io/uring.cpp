@@ -0,0 +1,433 @@
+#include "io/uring.hpp"
+
+#ifdef __linux__
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <csignal>
+#include <cstring>
+#include <format>
+#include <stdexcept>
+
+namespace core::io {
+
+namespace {
+
+constexpr int kSyscallError = -1;
+constexpr std::chrono::milliseconds kBlockingTimeout(-1);
+constexpr std::uint32_t kNoOperation = -1;
+
+// NOTE: owns a region of memory shared with the kernel
+class mapping final : public utils::non_copyable {
+ public:
+  mapping() noexcept = default;
+  mapping(void* data, std::size_t size) noexcept : data_(data), size_(size) {}
+  mapping(mapping&& that) noexcept
+      : data_(std::exchange(that.data_, nullptr)),
+        size_(std::exchange(that.size_, 0)) {}
+  mapping& operator=(mapping&& that) noexcept {
+    std::swap(data_, that.data_);
+    std::swap(size_, that.size_);
+    return *this;
+  }
+  ~mapping() noexcept {
+#ifdef __linux__
+    if (data_) {
+      static_cast<void>(::munmap(data_, size_));
+    }
+#endif
+  }
+
+ public:
+  template <typename T>
+  T* at(std::uint32_t offset) const noexcept {
+    return reinterpret_cast<T*>(static_cast<std::byte*>(data_) + offset);
+  }
+
+ private:
+  void* data_ = nullptr;
+  std::size_t size_ = 0;
+};
+
+struct operation final {
+  uring::callback_t callback;
+  net::sockets::base_socket* accepted;
+  std::uint32_t next_free;
+};
+
+struct operations final {
+  std::vector<operation> slots;
+  std::uint32_t free;
+  std::uint32_t pending;
+};
+
+struct queues final {
+  mapping sq_ring;
+  mapping cq_ring;
+  mapping sqes;
+  std::uint32_t* sq_head;
+  std::uint32_t* sq_tail;
+  std::uint32_t* sq_array;
+  std::uint32_t* cq_head;
+  std::uint32_t* cq_tail;
+  void* cqes;
+  std::uint32_t sq_mask;
+  std::uint32_t cq_mask;
+  std::uint32_t to_submit;
+};
+
+}  // namespace
+
+struct uring::impl final {
+  io::operations operations;
+  io::queues queues;
+  io::fd ring;
+};
+
+#ifdef __linux__
+
+namespace {
+
+int enter(queues& queues, int ring, std::uint32_t min_complete,
+          std::chrono::milliseconds timeout) {
+  if (queues.to_submit == 0 && min_complete == 0) {
+    return 0;
+  }
+
+  std::uint32_t flags = (min_complete > 0) ? IORING_ENTER_GETEVENTS : 0;
+
+  ::__kernel_timespec timespec{
+      .tv_sec = timeout.count() / 1000,
+      .tv_nsec = (timeout.count() % 1000) * 1000000,
+  };
+  ::io_uring_getevents_arg getevents_arg{
+      .sigmask = 0,
+      .sigmask_sz = _NSIG / 8,
+      .pad = 0,
+      .ts = reinterpret_cast<std::uint64_t>(&timespec),
+  };
+  const bool timed = min_complete > 0 && timeout != kBlockingTimeout;
+  if (timed) {
+    flags |= IORING_ENTER_EXT_ARG;
+  }
+
+  const int submitted =
+      ::syscall(__NR_io_uring_enter, ring, queues.to_submit, min_complete,
+                flags, timed ? &getevents_arg : nullptr,
+                timed ? sizeof(getevents_arg) : 0);
+  if (submitted == kSyscallError) [[unlikely]] {
+    switch (errno) {
+      case EINTR:
+      case ETIME:
+      case EBUSY:
+        return 0;
+      default:
+        throw std::runtime_error(
+            std::format("io_uring_enter() failed: {}", std::strerror(errno)));
+    }
+  }
+  queues.to_submit -= submitted;
+  return submitted;
+}
+
+std::uint32_t acquire_operation(operations& operations,
+                                uring::callback_t callback,
+                                net::sockets::base_socket* accepted) {
+  if (operations.free == kNoOperation) [[unlikely]] {
+    throw std::runtime_error("too many io_uring operations in flight");
+  }
+
+  const std::uint32_t index = operations.free;
+  operation& operation = operations.slots.at(index);
+  operations.free = operation.next_free;
+  operations.pending += 1;
+  operation.callback = std::move(callback);
+  operation.accepted = accepted;
+  return index;
+}
+
+void release_operation(operations& operations, std::uint32_t index) {
+  operation& operation = operations.slots.at(index);
+  operation.callback = nullptr;
+  operation.accepted = nullptr;
+  operation.next_free = std::exchange(operations.free, index);
+  operations.pending -= 1;
+}
+
+// NOTE: the kernel consumes the submission queue only in io_uring_enter()
+// without SQPOLL, so a full queue is flushed first. enter() may submit a part
+// of the queue or nothing on EINTR/EBUSY, hence the head is re-read until a
+// slot is free and no progress at all is reported as an error instead of
+// overwriting an unsubmitted entry
+::io_uring_sqe& acquire_sqe(queues& queues, int ring) {
+  const std::uint32_t tail = *queues.sq_tail;
+  while (tail - reinterpret_cast<std::atomic<std::uint32_t>*>(queues.sq_head)
+                    ->load(std::memory_order::acquire) >
+         queues.sq_mask) [[unlikely]] {
+    if (enter(queues, ring, 0, kBlockingTimeout) == 0) {
+      throw std::runtime_error("io_uring submission queue is full");
+    }
+  }
+
+  const std::uint32_t index = tail & queues.sq_mask;
+  ::io_uring_sqe& sqe = *queues.sqes.at<::io_uring_sqe>(
+      static_cast<std::uint32_t>(index * sizeof(::io_uring_sqe)));
+  std::memset(&sqe, 0, sizeof(sqe));
+  queues.sq_array[index] = index;
+  return sqe;
+}
+
+// NOTE: takes an operation slot and a submission queue entry carrying it,
+// the slot is returned if no entry can be acquired
+::io_uring_sqe& prepare_sqe(operations& operations, queues& queues, int ring,
+                            uring::callback_t callback,
+                            net::sockets::base_socket* accepted) {
+  const std::uint32_t index =
+      acquire_operation(operations, std::move(callback), accepted);
+  try {
+    ::io_uring_sqe& sqe = acquire_sqe(queues, ring);
+    sqe.user_data = index;
+    return sqe;
+  } catch (...) {
+    release_operation(operations, index);
+    throw;
+  }
+}
+
+void release_sqe(queues& queues) {
+  reinterpret_cast<std::atomic<std::uint32_t>*>(queues.sq_tail)
+      ->store(*queues.sq_tail + 1, std::memory_order::release);
+  queues.to_submit += 1;
+}
+
+}  // namespace
+
+#endif
+
+uring::uring(std::uint32_t entries)
+    : pimpl_(impl{
+          .operations = {.slots = {}, .free = kNoOperation, .pending = 0},
+          .queues = {},
+          .ring = io::fd(utils::uninitialized_t{}),
+      }) {
+#ifdef __linux__
+  ::io_uring_params params{};
+  const int ring = ::syscall(__NR_io_uring_setup, entries, &params);
+  if (ring == kSyscallError) [[unlikely]] {
+    throw std::runtime_error(
+        std::format("io_uring_setup() failed: {}", std::strerror(errno)));
+  }
+  pimpl_->ring = io::fd(ring);
+
+  const std::size_t sq_ring_size =
+      params.sq_off.array + params.sq_entries * sizeof(std::uint32_t);
+  const std::size_t cq_ring_size =
+      params.cq_off.cqes + params.cq_entries * sizeof(::io_uring_cqe);
+  const bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+
+  const auto map = [ring](std::size_t size, ::off_t offset) {
+    void* data = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, ring, offset);
+    if (data == MAP_FAILED) [[unlikely]] {
+      throw std::runtime_error(
+          std::format("mmap() failed: {}", std::strerror(errno)));
+    }
+    return mapping(data, size);
+  };
+
+  auto& [sq_ring, cq_ring, sqes, sq_head, sq_tail, sq_array, cq_head, cq_tail,
+         cqes, sq_mask, cq_mask, to_submit] = pimpl_->queues;
+
+  sq_ring = map(single_mmap ? std::max(sq_ring_size, cq_ring_size)
+                            : sq_ring_size,
+                IORING_OFF_SQ_RING);
+  if (!single_mmap) {
+    cq_ring = map(cq_ring_size, IORING_OFF_CQ_RING);
+  }
+  sqes = map(params.sq_entries * sizeof(::io_uring_sqe), IORING_OFF_SQES);
+
+  const mapping& cq_mapping = single_mmap ? sq_ring : cq_ring;
+  sq_head = sq_ring.at<std::uint32_t>(params.sq_off.head);
+  sq_tail = sq_ring.at<std::uint32_t>(params.sq_off.tail);
+  sq_array = sq_ring.at<std::uint32_t>(params.sq_off.array);
+  sq_mask = *sq_ring.at<std::uint32_t>(params.sq_off.ring_mask);
+  cq_head = cq_mapping.at<std::uint32_t>(params.cq_off.head);
+  cq_tail = cq_mapping.at<std::uint32_t>(params.cq_off.tail);
+  cqes = cq_mapping.at<::io_uring_cqe>(params.cq_off.cqes);
+  cq_mask = *cq_mapping.at<std::uint32_t>(params.cq_off.ring_mask);
+  to_submit = 0;
+
+  auto& [slots, free, _] = pimpl_->operations;
+  slots.resize(params.cq_entries);
+  for (std::uint32_t i = 0; i < slots.size(); ++i) {
+    slots.at(i).next_free = i + 1;
+  }
+  slots.back().next_free = kNoOperation;
+  free = 0;
+#else
+  static_cast<void>(entries);
+  throw std::invalid_argument("io_uring is not supported on this platform");
+#endif
+}
+
+uring::uring(uring&& that) noexcept : pimpl_(std::move(that.pimpl_)) {}
+
+uring& uring::operator=(uring&& that) noexcept {
+  pimpl_ = std::move(that.pimpl_);
+  return *this;
+}
+
+uring::~uring() noexcept = default;
+
+void uring::accept(const net::sockets::base_socket& socket,
+                   net::sockets::base_socket& accepted, callback_t callback) {
+#ifdef __linux__
+  auto& [operations, queues, ring] = *pimpl_;
+
+  ::io_uring_sqe& sqe =
+      prepare_sqe(operations, queues, ring.get_native_handle(),
+                  std::move(callback), &accepted);
+  sqe.opcode = IORING_OP_ACCEPT;
+  sqe.fd = socket.get_native_handle();
+  release_sqe(queues);
+#else
+  static_cast<void>(socket);
+  static_cast<void>(accepted);
+  static_cast<void>(callback);
+#endif
+}
+
+void uring::connect(const net::sockets::base_socket& socket,
+                    const net::sockets::base_sockaddr& sockaddr,
+                    callback_t callback) {
+#ifdef __linux__
+  auto& [operations, queues, ring] = *pimpl_;
+
+  ::io_uring_sqe& sqe =
+      prepare_sqe(operations, queues, ring.get_native_handle(),
+                  std::move(callback), nullptr);
+  sqe.opcode = IORING_OP_CONNECT;
+  sqe.fd = socket.get_native_handle();
+  sqe.addr = reinterpret_cast<std::uint64_t>(sockaddr.get_storage());
+  sqe.off = sockaddr.get_length();
+  release_sqe(queues);
+#else
+  static_cast<void>(socket);
+  static_cast<void>(sockaddr);
+  static_cast<void>(callback);
+#endif
+}
+
+void uring::send(const io::fd& fd, std::span<const std::byte> bytes,
+                 callback_t callback) {
+#ifdef __linux__
+  auto& [operations, queues, ring] = *pimpl_;
+
+  ::io_uring_sqe& sqe =
+      prepare_sqe(operations, queues, ring.get_native_handle(),
+                  std::move(callback), nullptr);
+  sqe.opcode = IORING_OP_SEND;
+  sqe.fd = fd.get_native_handle();
+  sqe.addr = reinterpret_cast<std::uint64_t>(bytes.data());
+  sqe.len = static_cast<std::uint32_t>(bytes.size());
+  sqe.msg_flags = MSG_NOSIGNAL;
+  release_sqe(queues);
+#else
+  static_cast<void>(fd);
+  static_cast<void>(bytes);
+  static_cast<void>(callback);
+#endif
+}
+
+void uring::receive(const io::fd& fd, std::span<std::byte> bytes,
+                    callback_t callback) {
+#ifdef __linux__
+  auto& [operations, queues, ring] = *pimpl_;
+
+  ::io_uring_sqe& sqe =
+      prepare_sqe(operations, queues, ring.get_native_handle(),
+                  std::move(callback), nullptr);
+  sqe.opcode = IORING_OP_RECV;
+  sqe.fd = fd.get_native_handle();
+  sqe.addr = reinterpret_cast<std::uint64_t>(bytes.data());
+  sqe.len = static_cast<std::uint32_t>(bytes.size());
+  release_sqe(queues);
+#else
+  static_cast<void>(fd);
+  static_cast<void>(bytes);
+  static_cast<void>(callback);
+#endif
+}
+
+void uring::close(io::fd&& fd, callback_t callback) {
+#ifdef __linux__
+  auto& [operations, queues, ring] = *pimpl_;
+
+  ::io_uring_sqe& sqe =
+      prepare_sqe(operations, queues, ring.get_native_handle(),
+                  std::move(callback), nullptr);
+  sqe.opcode = IORING_OP_CLOSE;
+  sqe.fd = fd.release();
+  release_sqe(queues);
+#else
+  static_cast<void>(fd);
+  static_cast<void>(callback);
+#endif
+}
+
+std::size_t uring::get_pending() const noexcept {
+  return pimpl_->operations.pending;
+}
+
+std::size_t uring::try_run(std::chrono::milliseconds timeout) {
+  std::size_t unhandled = 0;
+#ifdef __linux__
+  auto& [operations, queues, ring] = *pimpl_;
+
+  enter(queues, ring.get_native_handle(),
+        timeout == std::chrono::milliseconds(0) ? 0 : 1, timeout);
+
+  std::uint32_t head = *queues.cq_head;
+  const std::uint32_t tail =
+      reinterpret_cast<std::atomic<std::uint32_t>*>(queues.cq_tail)
+          ->load(std::memory_order::acquire);
+  for (; head != tail; ++head) {
+    const ::io_uring_cqe& cqe = static_cast<const ::io_uring_cqe*>(
+        queues.cqes)[head & queues.cq_mask];
+
+    const std::uint32_t index = static_cast<std::uint32_t>(cqe.user_data);
+    const std::int32_t result = cqe.res;
+    operation& operation = operations.slots.at(index);
+    callback_t callback = std::move(operation.callback);
+    if (operation.accepted && result >= 0) {
+      // NOTE: IORING_OP_ACCEPT is submitted without flags
+      operation.accepted->assign(
+          io::fd(result), net::sockets::kNonblock | net::sockets::kCloexec, 0);
+    }
+    release_operation(operations, index);
+
+    reinterpret_cast<std::atomic<std::uint32_t>*>(queues.cq_head)
+        ->store(head + 1, std::memory_order::release);
+    try {
+      if (callback) [[likely]] {
+        callback(*this, result);
+      }
+    } catch (...) {
+      unhandled += 1;
+    }
+  }
+#else
+  static_cast<void>(timeout);
+#endif
+  return unhandled;
+}
+
+std::size_t uring::run() { return try_run(kBlockingTimeout); }
+
+}  // namespace core::io
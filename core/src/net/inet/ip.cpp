@@ -2,15 +2,118 @@
 
 #include <arpa/inet.h>
 
-#include <cerrno>
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
 #include <format>
+#include <stdexcept>
 
 namespace core::net::inet {
 
 namespace {
 
-constexpr int kInetPtonSuccess = 1;
-constexpr auto kInetNtopError = nullptr;
+#if defined(__x86_64__)
+
+// NOTE: the octet lengths, 1 to 3 digits each, select one of 3^4 shuffles
+// which moves the digits of every octet into its own 32-bit lane as
+// [hundreds, tens, ones, 0] with the missing digits zeroed
+constexpr std::size_t kMaxOctetDigits = 3;
+constexpr std::size_t kPatterns = 81;
+constexpr std::int8_t kZero = -128;
+
+constexpr auto kShuffles = [] {
+  std::array<std::array<std::int8_t, 16>, kPatterns> shuffles{};
+  for (std::size_t pattern = 0; pattern < kPatterns; ++pattern) {
+    std::size_t begin = 0;
+    for (std::size_t octet = 0, divisor = 27; octet < 4;
+         ++octet, divisor /= 3) {
+      const std::size_t length = pattern / divisor % kMaxOctetDigits + 1;
+      for (std::size_t i = 0; i < 4; ++i) {
+        shuffles[pattern][octet * 4 + i] = kZero;
+      }
+      for (std::size_t i = 0; i < length; ++i) {
+        shuffles[pattern][octet * 4 + kMaxOctetDigits - length + i] =
+            static_cast<std::int8_t>(begin + i);
+      }
+      begin += length + 1;
+    }
+  }
+  return shuffles;
+}();
+
+// NOTE: the smallest value of an octet of the given length without leading
+// zeros
+constexpr std::array<std::uint32_t, kMaxOctetDigits + 1> kMinOctets{0, 0, 10,
+                                                                     100};
+
+bool supports_ssse3() noexcept {
+  static const bool supported = __builtin_cpu_supports("ssse3");
+  return supported;
+}
+
+// NOTE: data has at least 16 readable bytes, the ones past size are ignored
+__attribute__((target("ssse3"))) std::optional<ip> parse_ssse3(
+    const char* data, std::size_t size) noexcept {
+  constexpr std::size_t kMinSize = 7;
+  if (size < kMinSize || size > ip::kMaxStringSize) {
+    return std::nullopt;
+  }
+
+  const __m128i chunk =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+  const __m128i digits = _mm_sub_epi8(chunk, _mm_set1_epi8('0'));
+  const __m128i is_digit =
+      _mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits);
+  const __m128i is_dot = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('.'));
+
+  const std::uint32_t used = (1u << size) - 1;
+  const std::uint32_t dots =
+      static_cast<std::uint32_t>(_mm_movemask_epi8(is_dot)) & used;
+  const std::uint32_t digit_mask =
+      static_cast<std::uint32_t>(_mm_movemask_epi8(is_digit)) & used;
+  if ((dots | digit_mask) != used || std::popcount(dots) != 3) {
+    return std::nullopt;
+  }
+
+  const std::size_t first = std::countr_zero(dots);
+  const std::size_t second = std::countr_zero(dots & (dots - 1));
+  const std::size_t third = 31 - std::countl_zero(dots);
+  const std::array<std::size_t, 4> lengths{
+      first, second - first - 1, third - second - 1, size - third - 1};
+  std::size_t pattern = 0;
+  for (const std::size_t length : lengths) {
+    if (length == 0 || length > kMaxOctetDigits) {
+      return std::nullopt;
+    }
+    pattern = pattern * kMaxOctetDigits + length - 1;
+  }
+
+  const __m128i shuffled = _mm_shuffle_epi8(
+      digits, _mm_loadu_si128(
+                  reinterpret_cast<const __m128i*>(kShuffles[pattern].data())));
+  const __m128i pairs = _mm_maddubs_epi16(
+      shuffled, _mm_setr_epi8(100, 10, 1, 0, 100, 10, 1, 0, 100, 10, 1, 0,
+                              100, 10, 1, 0));
+  const __m128i octets = _mm_madd_epi16(pairs, _mm_set1_epi16(1));
+
+  alignas(16) std::array<std::uint32_t, 4> values;
+  _mm_store_si128(reinterpret_cast<__m128i*>(values.data()), octets);
+  std::uint32_t bytes = 0;
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    if (values[i] > 255 || values[i] < kMinOctets[lengths[i]]) {
+      return std::nullopt;
+    }
+    bytes = bytes << 8 | values[i];
+  }
+  return ip(bytes);
+}
+
+#endif
 
 }  // namespace
 
@@ -34,38 +137,51 @@ const ip& ip::kNonRoutable() noexcept {
   return ip;
 }
 
-ip::ip(std::uint32_t bytes) noexcept : data_(htonl(bytes)) {}
-
-ip::ip(std::uint32_t bytes, network_byte_order_t) noexcept : data_(bytes) {}
-
-ip::ip(std::string_view string) {
-  if (string.size() > INET_ADDRSTRLEN) {
+ip::ip(std::string_view string) : data_() {
+  const std::optional<ip> ip = parse(string);
+  if (!ip) [[unlikely]] {
     throw std::invalid_argument(std::format("invalid ip: {}", string));
   }
-  if (::inet_pton(AF_INET, string.data(), &data_) != kInetPtonSuccess) {
-    throw std::invalid_argument(
-        std::format("invalid ip {}: {}", string, std::strerror(errno)));
-  }
+  data_ = ip->data_;
 }
 
-std::uint32_t ip::get_bytes() const noexcept { return ntohl(data_); }
-
-std::uint32_t ip::get_bytes(network_byte_order_t) const noexcept {
-  return data_;
+void ip::parse_lines(std::string_view lines, std::vector<ip>& ips) {
+#if defined(__x86_64__)
+  const bool ssse3 = supports_ssse3();
+#endif
+  while (!lines.empty()) {
+    const std::size_t size = std::min(lines.find('\n'), lines.size());
+    const std::string_view line = lines.substr(0, size);
+
+    std::optional<ip> ip;
+#if defined(__x86_64__)
+    if (ssse3 && lines.size() >= sizeof(__m128i)) {
+      ip = parse_ssse3(line.data(), line.size());
+    } else if (ssse3 && line.size() < sizeof(__m128i)) {
+      // NOTE: the tail of the list is copied to not read past its end
+      std::array<char, sizeof(__m128i)> chunk{};
+      std::memcpy(chunk.data(), line.data(), line.size());
+      ip = parse_ssse3(chunk.data(), line.size());
+    } else {
+      ip = parse(line);
+    }
+#else
+    ip = parse(line);
+#endif
+    if (!ip && !line.empty()) [[unlikely]] {
+      throw std::invalid_argument(std::format("invalid ip: {}", line));
+    }
+    if (ip) {
+      ips.push_back(*ip);
+    }
+    lines.remove_prefix(std::min(size + 1, lines.size()));
+  }
 }
 
 std::string ip::to_string() const {
-  std::string string;
-  string.resize(INET_ADDRSTRLEN);
-
-  if (::inet_ntop(AF_INET, &data_, string.data(), string.size()) !=
-      kInetNtopError) [[likely]] {
-    string.resize(string.find('\0'));
-    return string;
-  }
-
-  throw std::runtime_error(
-      std::format("could not serialize ip: {}", std::strerror(errno)));
+  std::string string(kMaxStringSize, '\0');
+  string.resize(format_to(string.data()) - string.data());
+  return string;
 }
 
 }  // namespace core::net::inet
@@ -5,7 +5,7 @@
 namespace core::net::inet {
 
 sockaddr::sockaddr(net::inet::ip ip, net::inet::port port)
-    : net::sockets::base_sockaddr(net::sockets::family::kInet) {
+    : net::sockets::basic_sockaddr<net::sockets::family::kInet>() {
   ::sockaddr_in* storage = reinterpret_cast<::sockaddr_in*>(get_storage());
   storage->sin_addr.s_addr =
       ip.get_bytes(net::inet::ip::network_byte_order_t{});
@@ -1,13 +1,17 @@
 #include "net/inet/tcp/socket.hpp"
 
+#include <utility>
+
 namespace core::net::inet::tcp {
 
 socket::socket(utils::uninitialized_t) noexcept
-    : net::sockets::base_socket(core::utils::uninitialized_t{}) {}
+    : net::tcp::base_socket(core::utils::uninitialized_t{}) {}
+
+socket::socket(io::fd&& fd) noexcept : net::tcp::base_socket(std::move(fd)) {}
+
+socket::socket() : net::tcp::base_socket(net::sockets::family::kInet) {}
 
-socket::socket()
-    : net::sockets::base_socket(net::sockets::family::kInet,
-                                net::sockets::type::kStream,
-                                net::sockets::protocol::kTcp) {}
+socket::socket(net::sockets::flags_t flags)
+    : net::tcp::base_socket(net::sockets::family::kInet, flags) {}
 
 }  // namespace core::net::inet::tcp
@@ -1,13 +1,17 @@
 #include "net/inet/udp/socket.hpp"
 
+#include <utility>
+
 namespace core::net::inet::udp {
 
 socket::socket(utils::uninitialized_t) noexcept
-    : net::sockets::base_socket(core::utils::uninitialized_t{}) {}
+    : net::udp::base_socket(core::utils::uninitialized_t{}) {}
+
+socket::socket(io::fd&& fd) noexcept : net::udp::base_socket(std::move(fd)) {}
+
+socket::socket() : net::udp::base_socket(net::sockets::family::kInet) {}
 
-socket::socket()
-    : net::sockets::base_socket(net::sockets::family::kInet,
-                                net::sockets::type::kDgram,
-                                net::sockets::protocol::kUdp) {}
+socket::socket(net::sockets::flags_t flags)
+    : net::udp::base_socket(net::sockets::family::kInet, flags) {}
 
 }  // namespace core::net::inet::udp
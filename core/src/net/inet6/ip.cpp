@@ -1,19 +1,10 @@
 #include "net/inet6/ip.hpp"
 
-#include <arpa/inet.h>
-
-#include <cerrno>
 #include <format>
+#include <stdexcept>
 
 namespace core::net::inet6 {
 
-namespace {
-
-constexpr int kInetPtonSuccess = 1;
-constexpr auto kInetNtopError = nullptr;
-
-}  // namespace
-
 const ip& ip::kLoopback() noexcept {
   static const ip ip("::1");
   return ip;
@@ -29,37 +20,18 @@ const ip& ip::kNonRoutable() noexcept {
   return ip;
 }
 
-ip::ip(std::span<const std::byte, 16> bytes, network_byte_order_t) noexcept {
-  std::memcpy(data_.data(), bytes.data(), bytes.size());
-}
-
-ip::ip(std::string_view string) {
-  if (string.size() > INET6_ADDRSTRLEN) {
+ip::ip(std::string_view string) : data_() {
+  const std::optional<ip> ip = parse(string);
+  if (!ip) [[unlikely]] {
     throw std::invalid_argument(std::format("invalid ip: {}", string));
   }
-  if (::inet_pton(AF_INET6, string.data(), &data_) != kInetPtonSuccess) {
-    throw std::invalid_argument(
-        std::format("invalid ip {}: {}", string, std::strerror(errno)));
-  }
-}
-
-const std::array<std::byte, 16>& ip::get_bytes(
-    network_byte_order_t) const noexcept {
-  return data_;
+  data_ = ip->data_;
 }
 
 std::string ip::to_string() const {
-  std::string string;
-  string.resize(INET6_ADDRSTRLEN);
-
-  if (::inet_ntop(AF_INET6, &data_, string.data(), string.size()) !=
-      kInetNtopError) [[likely]] {
-    string.resize(string.find('\0'));
-    return string;
-  }
-
-  throw std::runtime_error(
-      std::format("could not serialize ip: {}", std::strerror(errno)));
+  std::string string(kMaxStringSize, '\0');
+  string.resize(format_to(string.data()) - string.data());
+  return string;
 }
 
 }  // namespace core::net::inet6
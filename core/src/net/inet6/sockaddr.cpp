@@ -5,7 +5,7 @@
 namespace core::net::inet6 {
 
 sockaddr::sockaddr(net::inet6::ip ip, net::inet6::port port)
-    : net::sockets::base_sockaddr(net::sockets::family::kInet6) {
+    : net::sockets::basic_sockaddr<net::sockets::family::kInet6>() {
   ::sockaddr_in6* storage = reinterpret_cast<::sockaddr_in6*>(get_storage());
   std::memcpy(&storage->sin6_addr,
               ip.get_bytes(net::inet6::ip::network_byte_order_t{}).data(),
@@ -13,6 +13,9 @@ sockaddr::sockaddr(net::inet6::ip ip, net::inet6::port port)
   storage->sin6_port = port.get_bytes(net::inet6::port::network_byte_order_t{});
 }
 
+sockaddr::sockaddr(const net::inet::sockaddr& that)
+    : sockaddr(net::inet6::ip(that.get_ip()), that.get_port()) {}
+
 net::inet6::ip sockaddr::get_ip() const noexcept {
   const ::sockaddr_in6* storage =
       reinterpret_cast<const ::sockaddr_in6*>(get_storage());
@@ -28,4 +31,12 @@ net::inet6::port sockaddr::get_port() const noexcept {
                           net::inet6::port::network_byte_order_t{});
 }
 
+std::optional<net::inet::sockaddr> sockaddr::to_inet() const noexcept {
+  const std::optional<net::inet::ip> ip = get_ip().to_inet();
+  if (!ip) {
+    return std::nullopt;
+  }
+  return net::inet::sockaddr(*ip, get_port());
+}
+
 }  // namespace core::net::inet6
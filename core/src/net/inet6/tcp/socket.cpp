@@ -1,13 +1,25 @@
 #include "net/inet6/tcp/socket.hpp"
 
+#include <utility>
+
 namespace core::net::inet6::tcp {
 
 socket::socket(utils::uninitialized_t) noexcept
-    : net::sockets::base_socket(core::utils::uninitialized_t{}) {}
+    : net::tcp::base_socket(core::utils::uninitialized_t{}) {}
+
+socket::socket(io::fd&& fd) noexcept : net::tcp::base_socket(std::move(fd)) {}
+
+socket::socket() : net::tcp::base_socket(net::sockets::family::kInet6) {}
+
+socket::socket(net::sockets::flags_t flags)
+    : net::tcp::base_socket(net::sockets::family::kInet6, flags) {}
+
+void socket::set_v6only(bool value) {
+  set<net::sockets::opt::ipv6_v6only>(value);
+}
 
-socket::socket()
-    : net::sockets::base_socket(net::sockets::family::kInet6,
-                                net::sockets::type::kStream,
-                                net::sockets::protocol::kTcp) {}
+bool socket::get_v6only() const {
+  return get<net::sockets::opt::ipv6_v6only>();
+}
 
 }  // namespace core::net::inet6::tcp
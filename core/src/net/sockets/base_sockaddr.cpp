@@ -1,81 +1,137 @@
 #include "net/sockets/base_sockaddr.hpp"
 
-#include <arpa/inet.h>
+#include <netinet/in.h>
 #include <sys/un.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+#include "net/inet/ip.hpp"
+#include "net/inet/port.hpp"
+#include "net/inet6/ip.hpp"
+#include "utils/hash.hpp"
 
 namespace core::net::sockets {
 
+static_assert(std::is_trivially_copyable_v<base_sockaddr>);
+static_assert(sizeof(::sockaddr_un{}.sun_path) <=
+              base_sockaddr::kMaxStringSize);
+
 namespace {
 
-constexpr std::size_t kPortStrlen = 6;
-constexpr std::size_t kColonStrlen = 1;
-constexpr std::size_t kBracketStrlen = 1;
+template <typename Sockaddr = ::sockaddr>
+const Sockaddr* to_native(const std::byte* storage) noexcept {
+  return reinterpret_cast<const Sockaddr*>(storage);
+}
 
 }  // namespace
 
-base_sockaddr::base_sockaddr(net::sockets::family family) {
+void base_sockaddr::initialize(net::sockets::family family) noexcept {
+  static_assert(sizeof(::sockaddr_in) <=
+                get_storage_size(net::sockets::family::kInet));
+  static_assert(sizeof(::sockaddr_in6) <=
+                get_storage_size(net::sockets::family::kInet6));
+  static_assert(sizeof(::sockaddr_un) <=
+                get_storage_size(net::sockets::family::kUnix));
+  static_assert(alignof(::sockaddr_in6) <= kStorageOffset);
+  std::byte* storage = reinterpret_cast<std::byte*>(get_storage());
+  header& header = get_header();
+  header.family = family;
   switch (family) {
-    case net::sockets::family::kUnspecified:
-      throw std::invalid_argument(
-          std::format("invalid sockaddr family: {}", family));
     case net::sockets::family::kInet:
-      storage_ = std::make_shared<::sockaddr_in>(::sockaddr_in{
-          .sin_family = AF_INET,
-      });
+      std::construct_at(reinterpret_cast<::sockaddr_in*>(storage),
+                        ::sockaddr_in{
+                            .sin_family = AF_INET,
+                        });
+      header.length = sizeof(::sockaddr_in);
       break;
     case net::sockets::family::kInet6:
-      storage_ = std::make_shared<::sockaddr_in6>(::sockaddr_in6{
-          .sin6_family = AF_INET6,
-      });
+      std::construct_at(reinterpret_cast<::sockaddr_in6*>(storage),
+                        ::sockaddr_in6{
+                            .sin6_family = AF_INET6,
+                        });
+      header.length = sizeof(::sockaddr_in6);
       break;
     case net::sockets::family::kUnix:
-      storage_ = std::make_shared<::sockaddr_un>(::sockaddr_un{
-          .sun_family = AF_UNIX,
-      });
+      std::construct_at(reinterpret_cast<::sockaddr_un*>(storage),
+                        ::sockaddr_un{
+                            .sun_family = AF_UNIX,
+                        });
+      header.length = offsetof(::sockaddr_un, sun_path);
+      break;
+    [[unlikely]] case net::sockets::family::kUnspecified:
+      header.length = 0;
       break;
   }
 }
 
+base_sockaddr::header& base_sockaddr::get_header() noexcept {
+  return *std::launder(reinterpret_cast<header*>(this));
+}
+
+const base_sockaddr::header& base_sockaddr::get_header() const noexcept {
+  return *std::launder(reinterpret_cast<const header*>(this));
+}
+
 base_sockaddr::storage* base_sockaddr::get_storage() noexcept {
-  return static_cast<base_sockaddr::storage*>(storage_.get());
+  return reinterpret_cast<base_sockaddr::storage*>(
+      reinterpret_cast<std::byte*>(this) + kStorageOffset);
 }
 
 const base_sockaddr::storage* base_sockaddr::get_storage() const noexcept {
-  return static_cast<const base_sockaddr::storage*>(storage_.get());
+  return reinterpret_cast<const base_sockaddr::storage*>(
+      reinterpret_cast<const std::byte*>(this) + kStorageOffset);
+}
+
+void base_sockaddr::set_length(std::size_t length) noexcept {
+  // NOTE: the kernel reports no address at all e.g. for an unnamed unix peer
+  // which is kept as an empty path so that the path size never underflows
+  if (get_header().family == net::sockets::family::kUnix) {
+    length = std::max(length, offsetof(::sockaddr_un, sun_path));
+  }
+  get_header().length =
+      static_cast<std::uint16_t>(std::min(length, get_capacity()));
 }
 
 bool base_sockaddr::operator==(const base_sockaddr& that) const {
-  if (storage_ == that.storage_) {
-    return true;
+  const net::sockets::family family = get_header().family;
+  if (family != that.get_header().family) {
+    return false;
   }
-  switch (static_cast<const ::sockaddr*>(storage_.get())->sa_family) {
-    case AF_INET: {
-      const ::sockaddr_in* this_sockaddr =
-          static_cast<const ::sockaddr_in*>(storage_.get());
+  const std::byte* storage = reinterpret_cast<const std::byte*>(get_storage());
+  const std::byte* that_storage =
+      reinterpret_cast<const std::byte*>(that.get_storage());
+  switch (family) {
+    case net::sockets::family::kInet: {
+      const ::sockaddr_in* this_sockaddr = to_native<::sockaddr_in>(storage);
       const ::sockaddr_in* that_sockaddr =
-          static_cast<const ::sockaddr_in*>(that.storage_.get());
-      return !std::memcmp(&this_sockaddr->sin_addr, &that_sockaddr->sin_addr,
-                          sizeof(::sockaddr_in{}.sin_addr)) &&
+          to_native<::sockaddr_in>(that_storage);
+      return this_sockaddr->sin_addr.s_addr == that_sockaddr->sin_addr.s_addr &&
              this_sockaddr->sin_port == that_sockaddr->sin_port;
     }
-    case AF_INET6: {
-      const ::sockaddr_in6* this_sockaddr =
-          static_cast<const ::sockaddr_in6*>(storage_.get());
+    case net::sockets::family::kInet6: {
+      const ::sockaddr_in6* this_sockaddr = to_native<::sockaddr_in6>(storage);
       const ::sockaddr_in6* that_sockaddr =
-          static_cast<const ::sockaddr_in6*>(that.storage_.get());
+          to_native<::sockaddr_in6>(that_storage);
       return !std::memcmp(&this_sockaddr->sin6_addr, &that_sockaddr->sin6_addr,
                           sizeof(::sockaddr_in6{}.sin6_addr)) &&
              this_sockaddr->sin6_port == that_sockaddr->sin6_port;
     }
-    case AF_UNIX: {
-      const ::sockaddr_un* this_sockaddr =
-          static_cast<const ::sockaddr_un*>(storage_.get());
-      const ::sockaddr_un* that_sockaddr =
-          static_cast<const ::sockaddr_un*>(that.storage_.get());
-      return !std::strcmp(this_sockaddr->sun_path, that_sockaddr->sun_path);
+    case net::sockets::family::kUnix: {
+      // NOTE: the abstract names may contain null bytes
+      const std::size_t length = get_header().length;
+      return length == that.get_header().length &&
+             !std::memcmp(to_native<::sockaddr_un>(storage)->sun_path,
+                          to_native<::sockaddr_un>(that_storage)->sun_path,
+                          length - offsetof(::sockaddr_un, sun_path));
     }
     [[unlikely]] default:
       throw std::runtime_error("unimplemented");
@@ -86,79 +142,105 @@ bool base_sockaddr::operator!=(const base_sockaddr& that) const {
   return !operator==(that);
 }
 
-std::size_t base_sockaddr::get_length() const {
-  switch (static_cast<const ::sockaddr*>(storage_.get())->sa_family) {
-    case AF_INET:
+std::size_t base_sockaddr::hash() const noexcept {
+  const std::byte* storage = reinterpret_cast<const std::byte*>(get_storage());
+  switch (get_header().family) {
+    case net::sockets::family::kInet: {
+      const ::sockaddr_in* sockaddr = to_native<::sockaddr_in>(storage);
+      const net::inet::ip ip(sockaddr->sin_addr.s_addr,
+                             net::inet::ip::network_byte_order_t{});
+      return utils::combine(std::hash<net::inet::ip>{}(ip), sockaddr->sin_port);
+    }
+    case net::sockets::family::kInet6: {
+      const ::sockaddr_in6* sockaddr = to_native<::sockaddr_in6>(storage);
+      const net::inet6::ip ip(
+          std::span<const std::byte, 16>(
+              reinterpret_cast<const std::byte*>(&sockaddr->sin6_addr), 16),
+          net::inet6::ip::network_byte_order_t{});
+      return utils::combine(std::hash<net::inet6::ip>{}(ip),
+                            sockaddr->sin6_port);
+    }
+    case net::sockets::family::kUnix: {
+      const ::sockaddr_un* sockaddr = to_native<::sockaddr_un>(storage);
+      return std::hash<std::string_view>{}(
+          std::string_view(sockaddr->sun_path,
+                           get_header().length -
+                               offsetof(::sockaddr_un, sun_path)));
+    }
+    [[unlikely]] default:
+      return 0;
+  }
+}
+
+std::size_t base_sockaddr::get_length() const noexcept {
+  return get_header().length;
+}
+
+std::size_t base_sockaddr::get_capacity() const noexcept {
+  switch (get_header().family) {
+    case net::sockets::family::kInet:
       return sizeof(::sockaddr_in);
-    case AF_INET6:
+    case net::sockets::family::kInet6:
       return sizeof(::sockaddr_in6);
-    case AF_UNIX:
+    case net::sockets::family::kUnix:
       return sizeof(::sockaddr_un);
     [[unlikely]] default:
-      throw std::runtime_error("unimplemented");
+      return 0;
   }
 }
 
-net::sockets::family base_sockaddr::get_family() const {
-  switch (static_cast<const ::sockaddr*>(storage_.get())->sa_family) {
-    case AF_INET:
-      return net::sockets::family::kInet;
-    case AF_INET6:
-      return net::sockets::family::kInet6;
-    case AF_UNIX:
-      return net::sockets::family::kUnix;
-    [[unlikely]] default:
-      throw std::runtime_error("unimplemented");
-  }
+net::sockets::family base_sockaddr::get_family() const noexcept {
+  return get_header().family;
 }
 
-std::string base_sockaddr::to_string() const {
-  std::string string;
-  switch (static_cast<const ::sockaddr*>(storage_.get())->sa_family) {
-    case AF_INET: {
-      const ::sockaddr_in* sockaddr =
-          static_cast<const ::sockaddr_in*>(storage_.get());
-
-      string.resize(INET_ADDRSTRLEN + kColonStrlen + kPortStrlen);
-      if (!::inet_ntop(AF_INET, &sockaddr->sin_addr, string.data(),
-                       string.size())) [[unlikely]] {
-        throw std::runtime_error(
-            std::format("inet_ntop failed: {}", std::strerror(errno)));
-      }
-      string.resize(string.find('\0'));
-      string.push_back(':');
-      string.append(std::to_string(ntohs(sockaddr->sin_port)));
-      break;
+char* base_sockaddr::format_to(char* out) const {
+  const std::byte* storage = reinterpret_cast<const std::byte*>(get_storage());
+  switch (get_header().family) {
+    case net::sockets::family::kInet: {
+      const ::sockaddr_in* sockaddr = to_native<::sockaddr_in>(storage);
+      out = net::inet::ip(sockaddr->sin_addr.s_addr,
+                          net::inet::ip::network_byte_order_t{})
+                .format_to(out);
+      *out++ = ':';
+      return net::inet::port(sockaddr->sin_port,
+                             net::inet::port::network_byte_order_t{})
+          .format_to(out);
     }
-    case AF_INET6: {
-      const ::sockaddr_in6* sockaddr =
-          static_cast<const ::sockaddr_in6*>(storage_.get());
-
-      string.resize(kBracketStrlen + INET6_ADDRSTRLEN + kBracketStrlen +
-                    kColonStrlen + kPortStrlen);
-      string.front() = '[';
-      if (!::inet_ntop(AF_INET6, &sockaddr->sin6_addr,
-                       string.data() + kBracketStrlen, string.size()))
-          [[unlikely]] {
-        throw std::runtime_error(
-            std::format("inet_ntop failed: {}", std::strerror(errno)));
-      }
-      string.resize(string.find('\0'));
-      string.push_back(']');
-      string.push_back(':');
-      string.append(std::to_string(ntohs(sockaddr->sin6_port)));
-      break;
+    case net::sockets::family::kInet6: {
+      const ::sockaddr_in6* sockaddr = to_native<::sockaddr_in6>(storage);
+      *out++ = '[';
+      out = net::inet6::ip(std::span<const std::byte, 16>(
+                               reinterpret_cast<const std::byte*>(
+                                   &sockaddr->sin6_addr),
+                               16),
+                           net::inet6::ip::network_byte_order_t{})
+                .format_to(out);
+      *out++ = ']';
+      *out++ = ':';
+      return net::inet::port(sockaddr->sin6_port,
+                             net::inet::port::network_byte_order_t{})
+          .format_to(out);
     }
-    case AF_UNIX: {
-      const ::sockaddr_un* sockaddr =
-          static_cast<const ::sockaddr_un*>(storage_.get());
-
-      string.assign(sockaddr->sun_path);
-      break;
+    case net::sockets::family::kUnix: {
+      const ::sockaddr_un* sockaddr = to_native<::sockaddr_un>(storage);
+      const std::size_t size =
+          get_header().length - offsetof(::sockaddr_un, sun_path);
+      // NOTE: the abstract names are shown with the leading @ by convention
+      if (size != 0 && sockaddr->sun_path[0] == '\0') {
+        *out++ = '@';
+        return std::copy_n(sockaddr->sun_path + 1, size - 1, out);
+      }
+      return std::copy_n(sockaddr->sun_path,
+                         ::strnlen(sockaddr->sun_path, size), out);
     }
     [[unlikely]] default:
       throw std::runtime_error("unimplemented");
   }
+}
+
+std::string base_sockaddr::to_string() const {
+  std::string string(kMaxStringSize, '\0');
+  string.resize(format_to(string.data()) - string.data());
   return string;
 }
 
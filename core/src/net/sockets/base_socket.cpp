@@ -2,10 +2,16 @@
 
 #include <arpa/inet.h>
 #include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
 #include <sys/socket.h>
 
+#include <algorithm>
 #include <cerrno>
+#include <climits>
 #include <format>
+#include <string_view>
+#include <utility>
 
 namespace core::net::sockets {
 
@@ -13,6 +19,21 @@ namespace {
 
 constexpr int kSyscallError = -1;
 
+template <typename Byte>
+::msghdr to_native_msghdr(std::span<const io::basic_iovec<Byte>> iovecs,
+                          const void *name, ::socklen_t namelen) noexcept {
+  return ::msghdr{
+      .msg_name = const_cast<void *>(name),
+      .msg_namelen = namelen,
+      .msg_iov = const_cast<::iovec *>(
+          reinterpret_cast<const ::iovec *>(iovecs.data())),
+      .msg_iovlen = std::min<std::size_t>(iovecs.size(), IOV_MAX),
+      .msg_control = nullptr,
+      .msg_controllen = 0,
+      .msg_flags = 0,
+  };
+}
+
 constexpr int to_native_family(net::sockets::family family) {
   switch (family) {
     case net::sockets::family::kUnspecified:
@@ -83,65 +104,184 @@ constexpr int to_native_protocol(net::sockets::protocol protocol) noexcept {
   }
 }
 
+struct native_option {
+  int level;
+  int name;
+  std::string_view label;
+};
+
+constexpr native_option to_native_option(opt::id id) {
+  switch (id) {
+    case opt::id::kReuseaddr:
+      return {SOL_SOCKET, SO_REUSEADDR, "SO_REUSEADDR"};
+    case opt::id::kReuseport:
+      return {SOL_SOCKET, SO_REUSEPORT, "SO_REUSEPORT"};
+    case opt::id::kKeepalive:
+      return {SOL_SOCKET, SO_KEEPALIVE, "SO_KEEPALIVE"};
+    case opt::id::kRcvbuf:
+      return {SOL_SOCKET, SO_RCVBUF, "SO_RCVBUF"};
+    case opt::id::kSndbuf:
+      return {SOL_SOCKET, SO_SNDBUF, "SO_SNDBUF"};
+    case opt::id::kRcvlowat:
+      return {SOL_SOCKET, SO_RCVLOWAT, "SO_RCVLOWAT"};
+    case opt::id::kLinger:
+      return {SOL_SOCKET, SO_LINGER, "SO_LINGER"};
+    case opt::id::kTcpNodelay:
+      return {IPPROTO_TCP, TCP_NODELAY, "TCP_NODELAY"};
+    case opt::id::kIpv6V6only:
+      return {IPPROTO_IPV6, IPV6_V6ONLY, "IPV6_V6ONLY"};
+#ifdef __linux__
+    case opt::id::kBusyPoll:
+      return {SOL_SOCKET, SO_BUSY_POLL, "SO_BUSY_POLL"};
+    case opt::id::kIncomingCpu:
+      return {SOL_SOCKET, SO_INCOMING_CPU, "SO_INCOMING_CPU"};
+    case opt::id::kTcpCork:
+      return {IPPROTO_TCP, TCP_CORK, "TCP_CORK"};
+    case opt::id::kTcpQuickack:
+      return {IPPROTO_TCP, TCP_QUICKACK, "TCP_QUICKACK"};
+    case opt::id::kTcpFastopen:
+      return {IPPROTO_TCP, TCP_FASTOPEN, "TCP_FASTOPEN"};
+    case opt::id::kTcpDeferAccept:
+      return {IPPROTO_TCP, TCP_DEFER_ACCEPT, "TCP_DEFER_ACCEPT"};
+    case opt::id::kTcpNotsentLowat:
+      return {IPPROTO_TCP, TCP_NOTSENT_LOWAT, "TCP_NOTSENT_LOWAT"};
+#else
+    default:
+      throw std::invalid_argument(
+          "socket option is not supported on this platform");
+#endif
+  }
+}
+
 }  // namespace
 
+struct base_socket::impl {
+  // NOTE: known is the mask of the flags whose value in flags is up to date
+  net::sockets::flags_t known;
+  net::sockets::flags_t flags;
+};
+
 base_socket::base_socket(utils::uninitialized_t) noexcept
-    : io::fd(utils::uninitialized_t{}) {}
+    : io::fd(utils::uninitialized_t{}), pimpl_(impl{.known = 0, .flags = 0}) {}
 
 base_socket::base_socket(net::sockets::family family, net::sockets::type type,
-                         net::sockets::protocol protocol)
-    : io::fd([family, type, protocol] {
-        const int fd = ::socket(to_native_family(family), to_native_type(type),
+                         net::sockets::protocol protocol,
+                         net::sockets::flags_t flags)
+    : io::fd([family, type, protocol, flags] {
+        int native_type = to_native_type(type);
+#ifdef SOCK_NONBLOCK
+        native_type |= ((flags & net::sockets::kNonblock) ? SOCK_NONBLOCK : 0);
+        native_type |= ((flags & net::sockets::kCloexec) ? SOCK_CLOEXEC : 0);
+#endif
+        const int fd = ::socket(to_native_family(family), native_type,
                                 to_native_protocol(protocol));
         if (fd == kSyscallError) [[unlikely]] {
           throw std::runtime_error(
               std::format("socket() failed: {}", std::strerror(errno)));
         }
         return fd;
-      }()) {}
+      }()),
+      pimpl_(impl{
+          .known = net::sockets::kNonblock | net::sockets::kCloexec,
+          .flags = 0,
+      }) {
+#ifdef SOCK_NONBLOCK
+  pimpl_->flags = flags;
+#else
+  set_nonblock(flags & net::sockets::kNonblock);
+  set_cloexec(flags & net::sockets::kCloexec);
+#endif
+}
+
+base_socket::base_socket(io::fd &&fd) noexcept
+    : io::fd(std::move(fd)), pimpl_(impl{.known = 0, .flags = 0}) {}
+
+base_socket::base_socket(const base_socket &that)
+    : io::fd(that),
+      pimpl_(impl{
+          .known = static_cast<net::sockets::flags_t>(that.pimpl_->known |
+                                                      net::sockets::kCloexec),
+          .flags = static_cast<net::sockets::flags_t>(that.pimpl_->flags &
+                                                      ~net::sockets::kCloexec),
+      }) {}
+
+base_socket &base_socket::operator=(const base_socket &that) {
+  io::fd::operator=(that);
+  // NOTE: dup2() into an open descriptor does not inherit FD_CLOEXEC either
+  // but an uninitialized target keeps it unknown
+  pimpl_->known = that.pimpl_->known & ~net::sockets::kCloexec;
+  pimpl_->flags = that.pimpl_->flags;
+  return *this;
+}
+
+base_socket::base_socket(base_socket &&that) noexcept
+    : io::fd(std::move(that)),
+      pimpl_(std::exchange(*that.pimpl_, impl{.known = 0, .flags = 0})) {}
+
+base_socket &base_socket::operator=(base_socket &&that) {
+  io::fd::operator=(std::move(that));
+  *pimpl_ = std::exchange(*that.pimpl_, impl{.known = 0, .flags = 0});
+  return *this;
+}
+
+base_socket::~base_socket() noexcept = default;
 
 void base_socket::set_nonblock(bool value) {
-  int flags = ::fcntl(get_native_handle(), F_GETFL);
-  if (flags == kSyscallError) [[unlikely]] {
+  auto &[known, flags] = *pimpl_;
+  if ((known & net::sockets::kNonblock) &&
+      static_cast<bool>(flags & net::sockets::kNonblock) == value) {
+    return;
+  }
+
+  int native_flags = ::fcntl(get_native_handle(), F_GETFL);
+  if (native_flags == kSyscallError) [[unlikely]] {
     throw std::runtime_error(std::format("failed to get F_GETFL on socket: {}",
                                          std::strerror(errno)));
   }
 
-  flags = value ? (flags | O_NONBLOCK) : (flags & ~O_NONBLOCK);
-  if (::fcntl(get_native_handle(), F_SETFL, flags) == kSyscallError)
+  native_flags =
+      value ? (native_flags | O_NONBLOCK) : (native_flags & ~O_NONBLOCK);
+  if (::fcntl(get_native_handle(), F_SETFL, native_flags) == kSyscallError)
       [[unlikely]] {
     throw std::runtime_error(std::format(
         "failed to set O_NONBLOCK on socket: {}", std::strerror(errno)));
   }
+  known |= net::sockets::kNonblock;
+  flags = value ? (flags | net::sockets::kNonblock)
+                : (flags & ~net::sockets::kNonblock);
 }
 
-void base_socket::set_reuseaddr(bool value) {
-  const int optval = (value ? 1 : 0);
-  if (::setsockopt(get_native_handle(), SOL_SOCKET, SO_REUSEADDR, &optval,
-                   sizeof(optval)) == kSyscallError) [[unlikely]] {
-    throw std::runtime_error(std::format(
-        "failed to set SO_REUSEADDR on socket: {}", std::strerror(errno)));
+void base_socket::set_cloexec(bool value) {
+  auto &[known, flags] = *pimpl_;
+  if ((known & net::sockets::kCloexec) &&
+      static_cast<bool>(flags & net::sockets::kCloexec) == value) {
+    return;
   }
-}
 
-void base_socket::set_reuseport(bool value) {
-  const int optval = (value ? 1 : 0);
-  if (::setsockopt(get_native_handle(), SOL_SOCKET, SO_REUSEPORT, &optval,
-                   sizeof(optval)) == kSyscallError) [[unlikely]] {
-    throw std::runtime_error(std::format(
-        "failed to set SO_REUSEPORT on socket: {}", std::strerror(errno)));
+  int native_flags = ::fcntl(get_native_handle(), F_GETFD);
+  if (native_flags == kSyscallError) [[unlikely]] {
+    throw std::runtime_error(std::format("failed to get F_GETFD on socket: {}",
+                                         std::strerror(errno)));
   }
-}
 
-void base_socket::set_keepalive(bool value) {
-  const int optval = (value ? 1 : 0);
-  if (::setsockopt(get_native_handle(), SOL_SOCKET, SO_KEEPALIVE, &optval,
-                   sizeof(optval)) == kSyscallError) [[unlikely]] {
+  native_flags =
+      value ? (native_flags | FD_CLOEXEC) : (native_flags & ~FD_CLOEXEC);
+  if (::fcntl(get_native_handle(), F_SETFD, native_flags) == kSyscallError)
+      [[unlikely]] {
     throw std::runtime_error(std::format(
-        "failed to set SO_KEEPALIVE on socket: {}", std::strerror(errno)));
+        "failed to set FD_CLOEXEC on socket: {}", std::strerror(errno)));
   }
+  known |= net::sockets::kCloexec;
+  flags = value ? (flags | net::sockets::kCloexec)
+                : (flags & ~net::sockets::kCloexec);
 }
 
+void base_socket::set_reuseaddr(bool value) { set<opt::reuseaddr>(value); }
+
+void base_socket::set_reuseport(bool value) { set<opt::reuseport>(value); }
+
+void base_socket::set_keepalive(bool value) { set<opt::keepalive>(value); }
+
 net::sockets::family base_socket::get_family() const {
 #ifdef SO_DOMAIN
   int optval;
@@ -179,48 +319,84 @@ net::sockets::type base_socket::get_type() const {
 }
 
 bool base_socket::get_nonblock() const {
-  const int flags = ::fcntl(get_native_handle(), F_GETFL);
-  if (flags == kSyscallError) [[unlikely]] {
+  const auto &[known, flags] = *pimpl_;
+  if (known & net::sockets::kNonblock) [[likely]] {
+    return (flags & net::sockets::kNonblock);
+  }
+
+  const int native_flags = ::fcntl(get_native_handle(), F_GETFL);
+  if (native_flags == kSyscallError) [[unlikely]] {
     throw std::runtime_error(std::format(
         "failed to get O_NONBLOCK on socket: {}", std::strerror(errno)));
   }
-  return (flags & O_NONBLOCK);
+  return (native_flags & O_NONBLOCK);
 }
 
-bool base_socket::get_reuseaddr() const {
-  int optval;
-  ::socklen_t optlen = sizeof(optval);
-  if (::getsockopt(get_native_handle(), SOL_SOCKET, SO_REUSEADDR, &optval,
-                   &optlen) == kSyscallError ||
-      optlen != sizeof(optval)) [[unlikely]] {
+bool base_socket::get_cloexec() const {
+  const auto &[known, flags] = *pimpl_;
+  if (known & net::sockets::kCloexec) [[likely]] {
+    return (flags & net::sockets::kCloexec);
+  }
+
+  const int native_flags = ::fcntl(get_native_handle(), F_GETFD);
+  if (native_flags == kSyscallError) [[unlikely]] {
     throw std::runtime_error(std::format(
-        "failed to get SO_REUSEADDR on socket: {}", std::strerror(errno)));
+        "failed to get FD_CLOEXEC on socket: {}", std::strerror(errno)));
   }
-  return (optval ? true : false);
+  return (native_flags & FD_CLOEXEC);
 }
 
-bool base_socket::get_reuseport() const {
-  int optval;
-  ::socklen_t optlen = sizeof(optval);
-  if (::getsockopt(get_native_handle(), SOL_SOCKET, SO_REUSEPORT, &optval,
-                   &optlen) == kSyscallError ||
-      optlen != sizeof(optval)) [[unlikely]] {
-    throw std::runtime_error(std::format(
-        "failed to get SO_REUSEPORT on socket: {}", std::strerror(errno)));
+bool base_socket::get_reuseaddr() const { return get<opt::reuseaddr>(); }
+
+bool base_socket::get_reuseport() const { return get<opt::reuseport>(); }
+
+bool base_socket::get_keepalive() const { return get<opt::keepalive>(); }
+
+void base_socket::set_option(opt::id id, int value) {
+  const native_option option = to_native_option(id);
+  if (id == opt::id::kLinger) {
+    const ::linger optval{.l_onoff = (value < 0 ? 0 : 1),
+                          .l_linger = (value < 0 ? 0 : value)};
+    if (::setsockopt(get_native_handle(), option.level, option.name, &optval,
+                     sizeof(optval)) == kSyscallError) [[unlikely]] {
+      throw std::runtime_error(std::format("failed to set {} on socket: {}",
+                                           option.label,
+                                           std::strerror(errno)));
+    }
+    return;
+  }
+
+  if (::setsockopt(get_native_handle(), option.level, option.name, &value,
+                   sizeof(value)) == kSyscallError) [[unlikely]] {
+    throw std::runtime_error(std::format("failed to set {} on socket: {}",
+                                         option.label, std::strerror(errno)));
   }
-  return (optval ? true : false);
 }
 
-bool base_socket::get_keepalive() const {
+int base_socket::get_option(opt::id id) const {
+  const native_option option = to_native_option(id);
+  if (id == opt::id::kLinger) {
+    ::linger optval;
+    ::socklen_t optlen = sizeof(optval);
+    if (::getsockopt(get_native_handle(), option.level, option.name, &optval,
+                     &optlen) == kSyscallError ||
+        optlen != sizeof(optval)) [[unlikely]] {
+      throw std::runtime_error(std::format("failed to get {} on socket: {}",
+                                           option.label,
+                                           std::strerror(errno)));
+    }
+    return (optval.l_onoff ? optval.l_linger : -1);
+  }
+
   int optval;
   ::socklen_t optlen = sizeof(optval);
-  if (::getsockopt(get_native_handle(), SOL_SOCKET, SO_KEEPALIVE, &optval,
+  if (::getsockopt(get_native_handle(), option.level, option.name, &optval,
                    &optlen) == kSyscallError ||
       optlen != sizeof(optval)) [[unlikely]] {
-    throw std::runtime_error(std::format(
-        "failed to get SO_KEEPALIVE on socket: {}", std::strerror(errno)));
+    throw std::runtime_error(std::format("failed to get {} on socket: {}",
+                                         option.label, std::strerror(errno)));
   }
-  return (optval ? true : false);
+  return optval;
 }
 
 base_socket::bind_status base_socket::bind(
@@ -264,24 +440,26 @@ base_socket::connection_status base_socket::connect(
 
 void base_socket::get_bind_sockaddr(
     net::sockets::base_sockaddr &sockaddr) const {
-  ::socklen_t socklen = static_cast<::socklen_t>(sockaddr.get_length());
+  ::socklen_t socklen = static_cast<::socklen_t>(sockaddr.get_capacity());
   if (::getsockname(get_native_handle(),
                     reinterpret_cast<::sockaddr *>(sockaddr.get_storage()),
                     &socklen) == kSyscallError) [[unlikely]] {
     throw std::runtime_error(
         std::format("failed to get bind address: {}", std::strerror(errno)));
   }
+  sockaddr.set_length(socklen);
 }
 
 void base_socket::get_connect_sockaddr(
     net::sockets::base_sockaddr &sockaddr) const {
-  ::socklen_t socklen = static_cast<::socklen_t>(sockaddr.get_length());
+  ::socklen_t socklen = static_cast<::socklen_t>(sockaddr.get_capacity());
   if (::getpeername(get_native_handle(),
                     reinterpret_cast<::sockaddr *>(sockaddr.get_storage()),
                     &socklen) == kSyscallError) [[unlikely]] {
     throw std::runtime_error(
         std::format("failed to get peer address: {}", std::strerror(errno)));
   }
+  sockaddr.set_length(socklen);
 }
 
 void base_socket::listen(std::size_t backlog) {
@@ -301,8 +479,47 @@ base_socket::accept_status base_socket::accept(base_socket &socket) const {
     throw std::runtime_error(
         std::format("accept failed: {}", std::strerror(errno)));
   }
-  static_cast<io::fd &>(socket) = io::fd(accepted);
+  // NOTE: accept() inherits O_NONBLOCK from the listener on BSD and macOS
+  // but not on Linux so that none of the flags is known
+  socket.assign(io::fd(accepted), 0, 0);
+  return base_socket::accept_status::kSuccess;
+}
+
+base_socket::accept_status base_socket::accept_nonblock(
+    base_socket &socket, net::sockets::base_sockaddr *sockaddr) const {
+#ifdef __linux__
+  ::socklen_t socklen =
+      sockaddr != nullptr ? static_cast<::socklen_t>(sockaddr->get_capacity())
+                          : 0;
+  const int accepted = ::accept4(
+      get_native_handle(),
+      sockaddr != nullptr
+          ? reinterpret_cast<::sockaddr *>(sockaddr->get_storage())
+          : nullptr,
+      sockaddr != nullptr ? &socklen : nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+  if (accepted == kSyscallError) {
+    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+      return base_socket::accept_status::kEmptyQueue;
+    }
+    throw std::runtime_error(
+        std::format("accept4 failed: {}", std::strerror(errno)));
+  }
+  if (sockaddr != nullptr) {
+    sockaddr->set_length(socklen);
+  }
+  socket.assign(io::fd(accepted),
+                net::sockets::kNonblock | net::sockets::kCloexec,
+                net::sockets::kNonblock | net::sockets::kCloexec);
   return base_socket::accept_status::kSuccess;
+#else
+  throw std::invalid_argument("accept4() is not supported on this platform");
+#endif
+}
+
+void base_socket::assign(io::fd &&fd, net::sockets::flags_t known,
+                         net::sockets::flags_t flags) {
+  static_cast<io::fd &>(*this) = std::move(fd);
+  *pimpl_ = impl{.known = known, .flags = flags};
 }
 
 std::size_t base_socket::send(std::span<const std::byte> bytes) const {
@@ -336,11 +553,33 @@ std::size_t base_socket::send_to(
 }
 
 std::size_t base_socket::receive(std::span<std::byte> bytes) const {
+  return try_receive(bytes).value_or(0);
+}
+
+std::size_t base_socket::receive_from(
+    std::span<std::byte> bytes, net::sockets::base_sockaddr &sockaddr) const {
+  ::socklen_t socklen = static_cast<::socklen_t>(sockaddr.get_capacity());
+  const ::ssize_t received = ::recvfrom(
+      get_native_handle(), bytes.data(), bytes.size(), 0,
+      reinterpret_cast<::sockaddr *>(sockaddr.get_storage()), &socklen);
+  if (received == kSyscallError) {
+    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+      return 0;
+    }
+    throw std::runtime_error(
+        std::format("recvfrom failed: {}", std::strerror(errno)));
+  }
+  sockaddr.set_length(socklen);
+  return static_cast<std::size_t>(received);
+}
+
+std::optional<std::size_t> base_socket::try_receive(
+    std::span<std::byte> bytes) const {
   const ::ssize_t received =
       ::recv(get_native_handle(), bytes.data(), bytes.size(), 0);
   if (received == kSyscallError) {
     if (errno == EAGAIN || errno == EWOULDBLOCK) {
-      return 0;
+      return std::nullopt;
     }
     throw std::runtime_error(
         std::format("recv failed: {}", std::strerror(errno)));
@@ -348,20 +587,113 @@ std::size_t base_socket::receive(std::span<std::byte> bytes) const {
   return static_cast<std::size_t>(received);
 }
 
+std::size_t base_socket::send(std::span<const io::const_iovec> iovecs) const {
+  const ::msghdr msghdr = to_native_msghdr(iovecs, nullptr, 0);
+  const ::ssize_t sent = ::sendmsg(get_native_handle(), &msghdr, 0);
+  if (sent == kSyscallError) {
+    if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS) {
+      return 0;
+    }
+    throw std::runtime_error(
+        std::format("sendmsg failed: {}", std::strerror(errno)));
+  }
+  return static_cast<std::size_t>(sent);
+}
+
+std::size_t base_socket::send_to(
+    std::span<const io::const_iovec> iovecs,
+    const net::sockets::base_sockaddr &sockaddr) const {
+  const ::msghdr msghdr =
+      to_native_msghdr(iovecs, sockaddr.get_storage(),
+                       static_cast<::socklen_t>(sockaddr.get_length()));
+  const ::ssize_t sent = ::sendmsg(get_native_handle(), &msghdr, 0);
+  if (sent == kSyscallError) {
+    if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS) {
+      return 0;
+    }
+    throw std::runtime_error(
+        std::format("sendmsg failed: {}", std::strerror(errno)));
+  }
+  return static_cast<std::size_t>(sent);
+}
+
+std::size_t base_socket::receive(std::span<const io::iovec> iovecs) const {
+  ::msghdr msghdr = to_native_msghdr(iovecs, nullptr, 0);
+  const ::ssize_t received = ::recvmsg(get_native_handle(), &msghdr, 0);
+  if (received == kSyscallError) {
+    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+      return 0;
+    }
+    throw std::runtime_error(
+        std::format("recvmsg failed: {}", std::strerror(errno)));
+  }
+  return static_cast<std::size_t>(received);
+}
+
 std::size_t base_socket::receive_from(
-    std::span<std::byte> bytes, net::sockets::base_sockaddr &sockaddr) const {
-  ::socklen_t socklen = static_cast<::socklen_t>(sockaddr.get_length());
-  const ::ssize_t received = ::recvfrom(
-      get_native_handle(), bytes.data(), bytes.size(), 0,
-      reinterpret_cast<::sockaddr *>(sockaddr.get_storage()), &socklen);
+    std::span<const io::iovec> iovecs,
+    net::sockets::base_sockaddr &sockaddr) const {
+  ::msghdr msghdr =
+      to_native_msghdr(iovecs, sockaddr.get_storage(),
+                       static_cast<::socklen_t>(sockaddr.get_capacity()));
+  const ::ssize_t received = ::recvmsg(get_native_handle(), &msghdr, 0);
   if (received == kSyscallError) {
     if (errno == EAGAIN || errno == EWOULDBLOCK) {
       return 0;
     }
     throw std::runtime_error(
-        std::format("recvfrom failed: {}", std::strerror(errno)));
+        std::format("recvmsg failed: {}", std::strerror(errno)));
   }
+  sockaddr.set_length(msghdr.msg_namelen);
   return static_cast<std::size_t>(received);
 }
 
+std::size_t base_socket::send_many(net::sockets::message_batch &batch,
+                                   std::size_t first) const {
+#ifdef __linux__
+  if (first >= batch.get_size()) [[unlikely]] {
+    return 0;
+  }
+  const int sent = ::sendmmsg(
+      get_native_handle(),
+      reinterpret_cast<::mmsghdr *>(batch.get_headers()) + first,
+      static_cast<unsigned int>(batch.get_size() - first), 0);
+  if (sent == kSyscallError) {
+    if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS) {
+      return 0;
+    }
+    throw std::runtime_error(
+        std::format("sendmmsg failed: {}", std::strerror(errno)));
+  }
+  return static_cast<std::size_t>(sent);
+#else
+  static_cast<void>(batch);
+  static_cast<void>(first);
+  throw std::invalid_argument("sendmmsg() is not supported on this platform");
+#endif
+}
+
+std::size_t base_socket::receive_many(
+    net::sockets::message_batch &batch) const {
+#ifdef __linux__
+  batch.prepare_receive();
+  const int received =
+      ::recvmmsg(get_native_handle(),
+                 reinterpret_cast<::mmsghdr *>(batch.get_headers()),
+                 static_cast<unsigned int>(batch.get_size()), MSG_WAITFORONE,
+                 nullptr);
+  if (received == kSyscallError) {
+    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+      return 0;
+    }
+    throw std::runtime_error(
+        std::format("recvmmsg failed: {}", std::strerror(errno)));
+  }
+  return static_cast<std::size_t>(received);
+#else
+  static_cast<void>(batch);
+  throw std::invalid_argument("recvmmsg() is not supported on this platform");
+#endif
+}
+
 }  // namespace core::net::sockets
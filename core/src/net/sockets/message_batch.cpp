@@ -0,0 +1,141 @@
+#include "net/sockets/message_batch.hpp"
+
+#include <sys/socket.h>
+
+#include <algorithm>
+#include <cstring>
+#include <format>
+#include <vector>
+
+namespace core::net::sockets {
+
+namespace {
+
+#ifdef __linux__
+using mmsghdr = ::mmsghdr;
+#else
+// NOTE: the layout of struct mmsghdr so that the batch can be built where
+// sendmmsg() and recvmmsg() are not available and the transfers throw
+struct mmsghdr final {
+  ::msghdr msg_hdr;
+  unsigned int msg_len;
+};
+#endif
+
+}  // namespace
+
+struct message_batch::impl final {
+  std::vector<mmsghdr> headers;
+  std::vector<::iovec> iovecs;
+  std::vector<::sockaddr_storage> sockaddrs;
+  std::size_t size;
+};
+
+message_batch::message_batch(std::size_t capacity)
+    : pimpl_(impl{
+          .headers = std::vector<mmsghdr>(capacity),
+          .iovecs = std::vector<::iovec>(capacity),
+          .sockaddrs = std::vector<::sockaddr_storage>(capacity),
+          .size = 0,
+      }) {
+  if (capacity == 0) [[unlikely]] {
+    throw std::invalid_argument("message batch capacity must be positive");
+  }
+  for (std::size_t i = 0; i < capacity; ++i) {
+    pimpl_->headers[i].msg_hdr.msg_iov = &pimpl_->iovecs[i];
+    pimpl_->headers[i].msg_hdr.msg_iovlen = 1;
+  }
+}
+
+message_batch::~message_batch() noexcept = default;
+
+void message_batch::push(std::span<const std::byte> bytes) {
+  auto& [headers, iovecs, _, size] = *pimpl_;
+  if (size == headers.size()) [[unlikely]] {
+    throw std::length_error(
+        std::format("message batch is full: {}", headers.size()));
+  }
+  iovecs[size] = ::iovec{
+      .iov_base = const_cast<std::byte*>(bytes.data()),
+      .iov_len = bytes.size(),
+  };
+  headers[size].msg_hdr.msg_name = nullptr;
+  headers[size].msg_hdr.msg_namelen = 0;
+  headers[size].msg_len = 0;
+  size += 1;
+}
+
+void message_batch::push(std::span<const std::byte> bytes,
+                         const net::sockets::base_sockaddr& sockaddr) {
+  push(bytes);
+  auto& [headers, _, sockaddrs, size] = *pimpl_;
+  std::memcpy(&sockaddrs[size - 1], sockaddr.get_storage(),
+              sockaddr.get_length());
+  headers[size - 1].msg_hdr.msg_name = &sockaddrs[size - 1];
+  headers[size - 1].msg_hdr.msg_namelen =
+      static_cast<::socklen_t>(sockaddr.get_length());
+}
+
+void message_batch::clear() noexcept { pimpl_->size = 0; }
+
+std::size_t message_batch::get_capacity() const noexcept {
+  return pimpl_->headers.size();
+}
+
+std::size_t message_batch::get_size() const noexcept { return pimpl_->size; }
+
+std::size_t message_batch::get_length(std::size_t i) const {
+  if (i >= pimpl_->size) [[unlikely]] {
+    throw std::out_of_range(
+        std::format("message index {} out of range {}", i, pimpl_->size));
+  }
+  return pimpl_->headers[i].msg_len;
+}
+
+std::span<const std::byte> message_batch::get_bytes(std::size_t i) const {
+  const std::size_t length = get_length(i);
+  return {static_cast<const std::byte*>(pimpl_->iovecs[i].iov_base),
+          std::min(length, pimpl_->iovecs[i].iov_len)};
+}
+
+void message_batch::get_sockaddr(std::size_t i,
+                                 net::sockets::base_sockaddr& sockaddr) const {
+  if (i >= pimpl_->size) [[unlikely]] {
+    throw std::out_of_range(
+        std::format("message index {} out of range {}", i, pimpl_->size));
+  }
+  const ::msghdr& header = pimpl_->headers[i].msg_hdr;
+  if (header.msg_name == nullptr || header.msg_namelen == 0) [[unlikely]] {
+    throw std::runtime_error(std::format("message {} has no sockaddr", i));
+  }
+
+  // NOTE: the family of the sockaddr has to match as it determines the derived
+  // type
+  const auto& storage = pimpl_->sockaddrs[i];
+  if (storage.ss_family !=
+      reinterpret_cast<const ::sockaddr*>(sockaddr.get_storage())->sa_family)
+      [[unlikely]] {
+    throw std::invalid_argument(std::format(
+        "message {} sockaddr family mismatch: {}", i, sockaddr.get_family()));
+  }
+  const std::size_t length =
+      std::min<std::size_t>(header.msg_namelen, sockaddr.get_capacity());
+  std::memcpy(sockaddr.get_storage(), &storage, length);
+  sockaddr.set_length(length);
+}
+
+message_batch::header* message_batch::get_headers() noexcept {
+  return reinterpret_cast<header*>(pimpl_->headers.data());
+}
+
+void message_batch::prepare_receive() noexcept {
+  auto& [headers, _, sockaddrs, size] = *pimpl_;
+  for (std::size_t i = 0; i < size; ++i) {
+    headers[i].msg_hdr.msg_name = &sockaddrs[i];
+    headers[i].msg_hdr.msg_namelen = sizeof(::sockaddr_storage);
+    headers[i].msg_hdr.msg_flags = 0;
+    headers[i].msg_len = 0;
+  }
+}
+
+}  // namespace core::net::sockets
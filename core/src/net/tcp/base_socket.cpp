@@ -0,0 +1,135 @@
+#include "net/tcp/base_socket.hpp"
+
+#ifdef __linux__
+#include <linux/errqueue.h>
+#include <netinet/in.h>
+#endif
+#include <sys/socket.h>
+
+#include <cerrno>
+#include <cstring>
+#include <format>
+#include <utility>
+
+namespace core::net::tcp {
+
+namespace {
+
+[[maybe_unused]] constexpr int kSyscallError = -1;
+
+}  // namespace
+
+base_socket::base_socket(utils::uninitialized_t) noexcept
+    : net::sockets::base_socket(core::utils::uninitialized_t{}) {}
+
+base_socket::base_socket(io::fd&& fd) noexcept
+    : net::sockets::base_socket(std::move(fd)) {}
+
+base_socket::base_socket(net::sockets::family family,
+                         net::sockets::flags_t flags)
+    : net::sockets::base_socket(family, net::sockets::type::kStream,
+                                net::sockets::protocol::kTcp, flags) {}
+
+void base_socket::set_zerocopy([[maybe_unused]] bool value) {
+#ifdef __linux__
+  const int optval = (value ? 1 : 0);
+  if (::setsockopt(get_native_handle(), SOL_SOCKET, SO_ZEROCOPY, &optval,
+                   sizeof(optval)) == kSyscallError) [[unlikely]] {
+    throw std::runtime_error(std::format(
+        "failed to set SO_ZEROCOPY on socket: {}", std::strerror(errno)));
+  }
+#else
+  throw std::invalid_argument("SO_ZEROCOPY is not supported on this platform");
+#endif
+}
+
+bool base_socket::get_zerocopy() const {
+#ifdef __linux__
+  int optval;
+  ::socklen_t optlen = sizeof(optval);
+  if (::getsockopt(get_native_handle(), SOL_SOCKET, SO_ZEROCOPY, &optval,
+                   &optlen) == kSyscallError ||
+      optlen != sizeof(optval)) [[unlikely]] {
+    throw std::runtime_error(std::format(
+        "failed to get SO_ZEROCOPY on socket: {}", std::strerror(errno)));
+  }
+  return (optval ? true : false);
+#else
+  throw std::invalid_argument("SO_ZEROCOPY is not supported on this platform");
+#endif
+}
+
+std::size_t base_socket::send_zerocopy(
+    [[maybe_unused]] std::span<const std::byte> bytes) const {
+#ifdef __linux__
+  const ::ssize_t sent =
+      ::send(get_native_handle(), bytes.data(), bytes.size(), MSG_ZEROCOPY);
+  if (sent == kSyscallError) {
+    if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS) {
+      return 0;
+    }
+    throw std::runtime_error(
+        std::format("send failed: {}", std::strerror(errno)));
+  }
+  return static_cast<std::size_t>(sent);
+#else
+  throw std::invalid_argument(
+      "MSG_ZEROCOPY is not supported on this platform");
+#endif
+}
+
+std::size_t base_socket::receive_zerocopy_completions(
+    [[maybe_unused]] std::span<zerocopy_completion> completions) const {
+#ifdef __linux__
+  std::size_t received = 0;
+  while (received < completions.size()) {
+    // NOTE: the extended error is followed by the offending sockaddr
+    alignas(::cmsghdr) std::byte control[CMSG_SPACE(
+        sizeof(::sock_extended_err) + sizeof(::sockaddr_in6))];
+    ::msghdr msghdr{
+        .msg_name = nullptr,
+        .msg_namelen = 0,
+        .msg_iov = nullptr,
+        .msg_iovlen = 0,
+        .msg_control = control,
+        .msg_controllen = sizeof(control),
+        .msg_flags = 0,
+    };
+    if (::recvmsg(get_native_handle(), &msghdr, MSG_ERRQUEUE) ==
+        kSyscallError) {
+      if (errno == EAGAIN || errno == EWOULDBLOCK) {
+        break;
+      }
+      throw std::runtime_error(
+          std::format("recvmsg failed: {}", std::strerror(errno)));
+    }
+
+    for (::cmsghdr* cmsghdr = CMSG_FIRSTHDR(&msghdr); cmsghdr != nullptr;
+         cmsghdr = CMSG_NXTHDR(&msghdr, cmsghdr)) {
+      if (!(cmsghdr->cmsg_level == SOL_IP &&
+            cmsghdr->cmsg_type == IP_RECVERR) &&
+          !(cmsghdr->cmsg_level == SOL_IPV6 &&
+            cmsghdr->cmsg_type == IPV6_RECVERR)) {
+        continue;
+      }
+
+      ::sock_extended_err error;
+      std::memcpy(&error, CMSG_DATA(cmsghdr), sizeof(error));
+      if (error.ee_origin != SO_EE_ORIGIN_ZEROCOPY || error.ee_errno != 0) {
+        continue;
+      }
+      completions[received++] = zerocopy_completion{
+          .first = error.ee_info,
+          .last = error.ee_data,
+          .copied = (error.ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0,
+      };
+    }
+  }
+  return received;
+#else
+  throw std::invalid_argument(
+      "MSG_ZEROCOPY is not supported on this platform");
+#endif
+}
+
+}  // namespace core::net::tcp
@@ -0,0 +1,196 @@
+#include "net/udp/base_socket.hpp"
+
+#ifdef __linux__
+#include <netinet/udp.h>
+#endif
+#include <sys/socket.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <utility>
+
+namespace core::net::udp {
+
+namespace {
+
+[[maybe_unused]] constexpr int kSyscallError = -1;
+
+#ifdef __linux__
+std::size_t send_segmented(int fd, std::span<const std::byte> bytes,
+                           std::size_t segment_size, const void* name,
+                           ::socklen_t namelen) {
+  if (segment_size == 0 || segment_size > UINT16_MAX) [[unlikely]] {
+    throw std::invalid_argument(
+        std::format("invalid UDP segment size: {}", segment_size));
+  }
+
+  ::iovec iovec{
+      .iov_base = const_cast<std::byte*>(bytes.data()),
+      .iov_len = bytes.size(),
+  };
+  alignas(::cmsghdr) std::byte control[CMSG_SPACE(sizeof(std::uint16_t))]{};
+  ::msghdr msghdr{
+      .msg_name = const_cast<void*>(name),
+      .msg_namelen = namelen,
+      .msg_iov = &iovec,
+      .msg_iovlen = 1,
+      .msg_control = control,
+      .msg_controllen = sizeof(control),
+      .msg_flags = 0,
+  };
+
+  ::cmsghdr* cmsghdr = CMSG_FIRSTHDR(&msghdr);
+  cmsghdr->cmsg_level = SOL_UDP;
+  cmsghdr->cmsg_type = UDP_SEGMENT;
+  cmsghdr->cmsg_len = CMSG_LEN(sizeof(std::uint16_t));
+  const std::uint16_t size = static_cast<std::uint16_t>(segment_size);
+  std::memcpy(CMSG_DATA(cmsghdr), &size, sizeof(size));
+
+  const ::ssize_t sent = ::sendmsg(fd, &msghdr, 0);
+  if (sent == kSyscallError) {
+    if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS) {
+      return 0;
+    }
+    throw std::runtime_error(
+        std::format("sendmsg failed: {}", std::strerror(errno)));
+  }
+  return static_cast<std::size_t>(sent);
+}
+
+std::size_t receive_segmented(int fd, std::span<std::byte> bytes,
+                              std::size_t& segment_size, void* name,
+                              ::socklen_t* namelen) {
+  ::iovec iovec{
+      .iov_base = bytes.data(),
+      .iov_len = bytes.size(),
+  };
+  alignas(::cmsghdr) std::byte control[CMSG_SPACE(sizeof(int))]{};
+  ::msghdr msghdr{
+      .msg_name = name,
+      .msg_namelen = (namelen != nullptr ? *namelen : 0),
+      .msg_iov = &iovec,
+      .msg_iovlen = 1,
+      .msg_control = control,
+      .msg_controllen = sizeof(control),
+      .msg_flags = 0,
+  };
+
+  const ::ssize_t received = ::recvmsg(fd, &msghdr, 0);
+  if (received == kSyscallError) {
+    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+      segment_size = 0;
+      return 0;
+    }
+    throw std::runtime_error(
+        std::format("recvmsg failed: {}", std::strerror(errno)));
+  }
+
+  segment_size = static_cast<std::size_t>(received);
+  for (::cmsghdr* cmsghdr = CMSG_FIRSTHDR(&msghdr); cmsghdr != nullptr;
+       cmsghdr = CMSG_NXTHDR(&msghdr, cmsghdr)) {
+    if (cmsghdr->cmsg_level == SOL_UDP && cmsghdr->cmsg_type == UDP_GRO) {
+      int size;
+      std::memcpy(&size, CMSG_DATA(cmsghdr), sizeof(size));
+      segment_size = static_cast<std::size_t>(size);
+    }
+  }
+  return static_cast<std::size_t>(received);
+}
+#endif
+
+}  // namespace
+
+base_socket::base_socket(utils::uninitialized_t) noexcept
+    : net::sockets::base_socket(core::utils::uninitialized_t{}) {}
+
+base_socket::base_socket(io::fd&& fd) noexcept
+    : net::sockets::base_socket(std::move(fd)) {}
+
+base_socket::base_socket(net::sockets::family family,
+                         net::sockets::flags_t flags)
+    : net::sockets::base_socket(family, net::sockets::type::kDgram,
+                                net::sockets::protocol::kUdp, flags) {}
+
+void base_socket::set_gro([[maybe_unused]] bool value) {
+#ifdef __linux__
+  const int optval = (value ? 1 : 0);
+  if (::setsockopt(get_native_handle(), SOL_UDP, UDP_GRO, &optval,
+                   sizeof(optval)) == kSyscallError) [[unlikely]] {
+    throw std::runtime_error(std::format("failed to set UDP_GRO on socket: {}",
+                                         std::strerror(errno)));
+  }
+#else
+  throw std::invalid_argument("UDP_GRO is not supported on this platform");
+#endif
+}
+
+bool base_socket::get_gro() const {
+#ifdef __linux__
+  int optval;
+  ::socklen_t optlen = sizeof(optval);
+  if (::getsockopt(get_native_handle(), SOL_UDP, UDP_GRO, &optval, &optlen) ==
+          kSyscallError ||
+      optlen != sizeof(optval)) [[unlikely]] {
+    throw std::runtime_error(std::format("failed to get UDP_GRO on socket: {}",
+                                         std::strerror(errno)));
+  }
+  return (optval ? true : false);
+#else
+  throw std::invalid_argument("UDP_GRO is not supported on this platform");
+#endif
+}
+
+std::size_t base_socket::send_segmented(
+    [[maybe_unused]] std::span<const std::byte> bytes,
+    [[maybe_unused]] std::size_t segment_size) const {
+#ifdef __linux__
+  return net::udp::send_segmented(get_native_handle(), bytes, segment_size,
+                                  nullptr, 0);
+#else
+  throw std::invalid_argument("UDP_SEGMENT is not supported on this platform");
+#endif
+}
+
+std::size_t base_socket::send_segmented_to(
+    [[maybe_unused]] std::span<const std::byte> bytes,
+    [[maybe_unused]] std::size_t segment_size,
+    [[maybe_unused]] const net::sockets::base_sockaddr& sockaddr) const {
+#ifdef __linux__
+  return net::udp::send_segmented(
+      get_native_handle(), bytes, segment_size, sockaddr.get_storage(),
+      static_cast<::socklen_t>(sockaddr.get_length()));
+#else
+  throw std::invalid_argument("UDP_SEGMENT is not supported on this platform");
+#endif
+}
+
+std::size_t base_socket::receive_segmented(
+    [[maybe_unused]] std::span<std::byte> bytes,
+    [[maybe_unused]] std::size_t& segment_size) const {
+#ifdef __linux__
+  return net::udp::receive_segmented(get_native_handle(), bytes, segment_size,
+                                     nullptr, nullptr);
+#else
+  throw std::invalid_argument("UDP_GRO is not supported on this platform");
+#endif
+}
+
+std::size_t base_socket::receive_segmented_from(
+    [[maybe_unused]] std::span<std::byte> bytes,
+    [[maybe_unused]] std::size_t& segment_size,
+    [[maybe_unused]] net::sockets::base_sockaddr& sockaddr) const {
+#ifdef __linux__
+  ::socklen_t socklen = static_cast<::socklen_t>(sockaddr.get_capacity());
+  const std::size_t received = net::udp::receive_segmented(
+      get_native_handle(), bytes, segment_size, sockaddr.get_storage(),
+      &socklen);
+  sockaddr.set_length(socklen);
+  return received;
+#else
+  throw std::invalid_argument("UDP_GRO is not supported on this platform");
+#endif
+}
+
+}  // namespace core::net::udp
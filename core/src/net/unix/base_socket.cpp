@@ -1,21 +1,43 @@
 #include "net/unix/base_socket.hpp"
 
+#include <sys/socket.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <format>
+#include <iterator>
+#include <utility>
+
 namespace core::net::unix {
 
 namespace {
 
 constexpr int kSyscallError = -1;
 
+constexpr std::size_t kControlSize =
+    CMSG_SPACE(sizeof(int) * net::unix::base_socket::kMaxFds);
+
 }  // namespace
 
 base_socket::base_socket(utils::uninitialized_t) noexcept
     : net::sockets::base_socket(core::utils::uninitialized_t{}) {}
 
-base_socket::base_socket(net::sockets::type type)
+base_socket::base_socket(io::fd&& fd) noexcept
+    : net::sockets::base_socket(std::move(fd)) {}
+
+base_socket::base_socket(net::sockets::type type, net::sockets::flags_t flags)
     : net::sockets::base_socket(net::sockets::family::kUnix, type,
-                                net::sockets::protocol::kUnspecified) {}
+                                net::sockets::protocol::kUnspecified, flags) {}
+
+base_socket::base_socket(const base_socket& that) = default;
+
+base_socket& base_socket::operator=(const base_socket& that) = default;
+
+base_socket::base_socket(base_socket&& that) noexcept = default;
+
+base_socket& base_socket::operator=(base_socket&& that) = default;
 
 base_socket::~base_socket() noexcept {
   static const base_socket kUninitialized(utils::uninitialized_t{});
@@ -60,4 +82,108 @@ net::sockets::base_socket::bind_status base_socket::unlink_bind(
   return net::sockets::base_socket::bind(sockaddr);
 }
 
+std::size_t base_socket::send_fds(std::span<const std::byte> bytes,
+                                  std::span<const io::fd* const> fds) const {
+  if (fds.size() > kMaxFds) [[unlikely]] {
+    throw std::invalid_argument(
+        std::format("send_fds() passes more than {} descriptors", kMaxFds));
+  }
+
+  alignas(::cmsghdr) std::byte control[kControlSize];
+  ::iovec iovec{
+      .iov_base = const_cast<std::byte*>(bytes.data()),
+      .iov_len = bytes.size(),
+  };
+  ::msghdr message{
+      .msg_name = nullptr,
+      .msg_namelen = 0,
+      .msg_iov = &iovec,
+      .msg_iovlen = 1,
+      .msg_control = fds.empty() ? nullptr : control,
+      .msg_controllen = fds.empty() ? 0 : CMSG_SPACE(sizeof(int) * fds.size()),
+      .msg_flags = 0,
+  };
+  if (!fds.empty()) {
+    ::cmsghdr* header = CMSG_FIRSTHDR(&message);
+    header->cmsg_level = SOL_SOCKET;
+    header->cmsg_type = SCM_RIGHTS;
+    header->cmsg_len = CMSG_LEN(sizeof(int) * fds.size());
+    for (std::size_t i = 0; i < fds.size(); ++i) {
+      const int native_handle = io::fd::get_native_handle(*fds[i]);
+      std::memcpy(CMSG_DATA(header) + i * sizeof(int), &native_handle,
+                  sizeof(int));
+    }
+  }
+
+  const ::ssize_t sent = ::sendmsg(get_native_handle(), &message, 0);
+  if (sent == kSyscallError) {
+    if (errno == EAGAIN || errno == EWOULDBLOCK || errno == ENOBUFS) {
+      return 0;
+    }
+    throw std::runtime_error(
+        std::format("sendmsg failed: {}", std::strerror(errno)));
+  }
+  return static_cast<std::size_t>(sent);
+}
+
+std::size_t base_socket::receive_fds(std::span<std::byte> bytes,
+                                     std::vector<io::fd>& fds,
+                                     std::size_t max_fds) const {
+  max_fds = std::min(max_fds, kMaxFds);
+  std::vector<io::fd> received_fds;
+  received_fds.reserve(max_fds);
+
+  alignas(::cmsghdr) std::byte control[kControlSize];
+  ::iovec iovec{
+      .iov_base = bytes.data(),
+      .iov_len = bytes.size(),
+  };
+  ::msghdr message{
+      .msg_name = nullptr,
+      .msg_namelen = 0,
+      .msg_iov = &iovec,
+      .msg_iovlen = 1,
+      .msg_control = control,
+      // NOTE: CMSG_SPACE() is padded and may fit one more descriptor
+      .msg_controllen = CMSG_LEN(sizeof(int) * max_fds),
+      .msg_flags = 0,
+  };
+#ifdef MSG_CMSG_CLOEXEC
+  constexpr int kFlags = MSG_CMSG_CLOEXEC;
+#else
+  constexpr int kFlags = 0;
+#endif
+  const ::ssize_t received = ::recvmsg(get_native_handle(), &message, kFlags);
+  if (received == kSyscallError) {
+    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+      return 0;
+    }
+    throw std::runtime_error(
+        std::format("recvmsg failed: {}", std::strerror(errno)));
+  }
+
+  for (::cmsghdr* header = CMSG_FIRSTHDR(&message); header != nullptr;
+       header = CMSG_NXTHDR(&message, header)) {
+    if (header->cmsg_level != SOL_SOCKET || header->cmsg_type != SCM_RIGHTS) {
+      continue;
+    }
+    const std::size_t count = (header->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+    for (std::size_t i = 0; i < count; ++i) {
+      int native_handle;
+      std::memcpy(&native_handle, CMSG_DATA(header) + i * sizeof(int),
+                  sizeof(int));
+      received_fds.emplace_back(native_handle);
+    }
+  }
+  // NOTE: the kernel closes the descriptors that did not fit, the received
+  // ones are closed by received_fds
+  if (message.msg_flags & MSG_CTRUNC) [[unlikely]] {
+    throw std::runtime_error(std::format(
+        "receive_fds() received more than {} descriptors", max_fds));
+  }
+
+  std::move(received_fds.begin(), received_fds.end(), std::back_inserter(fds));
+  return static_cast<std::size_t>(received);
+}
+
 }  // namespace core::net::unix
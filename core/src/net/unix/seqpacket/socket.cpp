@@ -0,0 +1,17 @@
+#include "net/unix/seqpacket/socket.hpp"
+
+#include <utility>
+
+namespace core::net::unix::seqpacket {
+
+socket::socket(utils::uninitialized_t) noexcept
+    : net::unix::base_socket(core::utils::uninitialized_t{}) {}
+
+socket::socket(io::fd&& fd) noexcept : net::unix::base_socket(std::move(fd)) {}
+
+socket::socket() : net::unix::base_socket(net::sockets::type::kSeqpacket) {}
+
+socket::socket(net::sockets::flags_t flags)
+    : net::unix::base_socket(net::sockets::type::kSeqpacket, flags) {}
+
+}  // namespace core::net::unix::seqpacket
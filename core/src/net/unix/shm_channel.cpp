@@ -0,0 +1,472 @@
+#include "net/unix/shm_channel.hpp"
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/eventfd.h>
+#endif
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <array>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cerrno>
+#include <cstring>
+#include <format>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "utils/constants.hpp"
+
+namespace core::net::unix {
+
+namespace {
+
+constexpr int kSyscallError = -1;
+constexpr std::size_t kMinCapacity = 4096;
+constexpr std::size_t kMaxCapacity = std::size_t(1) << 30;
+constexpr std::size_t kFds = 3;
+#ifdef __linux__
+// NOTE: the size of the memfd is sealed so that the peer can not truncate it
+// under the mapping of the other side which would raise SIGBUS on access
+constexpr int kSeals = F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL;
+#endif
+
+// NOTE: control block of a ring placed in the shared memory right before its
+// data. head is advanced by the writer, tail by the reader. The waiting flags
+// are raised by the side about to sleep on its eventfd
+struct ring {
+  alignas(utils::kCacheLineSize) std::atomic<std::uint64_t> head;
+  alignas(utils::kCacheLineSize) std::atomic<std::uint64_t> tail;
+  alignas(utils::kCacheLineSize) std::atomic<std::uint32_t> reader_waiting;
+  std::atomic<std::uint32_t> writer_waiting;
+};
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free);
+static_assert(std::atomic<std::uint32_t>::is_always_lock_free);
+
+// NOTE: every message is preceded by a record and padded to its alignment. A
+// record of kWrap length pads the rest of the ring when a message does not
+// fit before the end, the alignment of the size of the record keeps room for
+// it there
+struct alignas(sizeof(std::uint64_t)) record {
+  std::uint32_t length;
+  std::uint32_t reserved;
+};
+constexpr std::uint32_t kWrap = std::numeric_limits<std::uint32_t>::max();
+
+constexpr std::size_t to_record_size(std::size_t length) noexcept {
+  return sizeof(record) + ((length + alignof(record) - 1) &
+                           ~(alignof(record) - 1));
+}
+
+constexpr std::size_t to_mapping_size(std::size_t capacity) noexcept {
+  return 2 * (sizeof(ring) + capacity);
+}
+
+struct mapping {
+  mapping(int native_handle, std::size_t size)
+      : data(static_cast<std::byte*>(::mmap(nullptr, size,
+                                            PROT_READ | PROT_WRITE, MAP_SHARED,
+                                            native_handle, 0))),
+        size(size) {
+    if (data == MAP_FAILED) [[unlikely]] {
+      throw std::runtime_error(
+          std::format("mmap failed: {}", std::strerror(errno)));
+    }
+  }
+  mapping(mapping&& that) noexcept
+      : data(std::exchange(that.data, nullptr)),
+        size(std::exchange(that.size, 0)) {}
+  mapping& operator=(mapping&& that) noexcept {
+    std::swap(data, that.data);
+    std::swap(size, that.size);
+    return *this;
+  }
+  ~mapping() noexcept {
+    if (data != nullptr) {
+      static_cast<void>(::munmap(data, size));
+    }
+  }
+
+  ring* get_ring(std::size_t index, std::size_t capacity) const noexcept {
+    return reinterpret_cast<ring*>(data + index * (sizeof(ring) + capacity));
+  }
+
+  std::byte* data;
+  std::size_t size;
+};
+
+// NOTE: io::fd exposes the handles of the descriptors to its derived classes
+// only
+struct native_handle final : io::fd {
+  static int get(const io::fd& fd) noexcept {
+    return io::fd::get_native_handle(fd);
+  }
+};
+
+#ifdef __linux__
+int create_event() {
+  const int event = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (event == kSyscallError) [[unlikely]] {
+    throw std::runtime_error(
+        std::format("eventfd failed: {}", std::strerror(errno)));
+  }
+  return event;
+}
+#endif
+
+void notify(std::atomic<std::uint32_t>& waiting, const io::fd& event) {
+  // NOTE: pairs with the fence in wait() so that either the sleeping side sees
+  // the progress or this side sees its flag
+  std::atomic_thread_fence(std::memory_order::seq_cst);
+  if (waiting.load(std::memory_order::relaxed) == 0 ||
+      waiting.exchange(0, std::memory_order::relaxed) == 0) [[likely]] {
+    return;
+  }
+  const std::uint64_t value = 1;
+  const std::array<io::const_iovec, 1> iovecs{io::const_iovec(
+      std::as_bytes(std::span<const std::uint64_t, 1>(&value, 1)))};
+  static_cast<void>(event.write(iovecs));
+}
+
+}  // namespace
+
+struct shm_channel::impl {
+  net::unix::stream::socket socket;
+  io::fd own_event;
+  io::fd peer_event;
+  mapping memory;
+  ring* tx;
+  ring* rx;
+  std::size_t capacity;
+  // NOTE: own positions which are only published to the shared memory as the
+  // peer may overwrite them there
+  std::uint64_t head;
+  std::uint64_t tail;
+  // NOTE: last observed positions of the peer to touch its cache line only
+  // when the ring looks full or empty
+  std::uint64_t cached_tail;
+  std::uint64_t cached_head;
+
+  std::byte* get_data(ring* ring) const noexcept {
+    return reinterpret_cast<std::byte*>(ring) + sizeof(*ring);
+  }
+
+  template <typename Predicate>
+  void wait(std::atomic<std::uint32_t>& waiting, Predicate predicate) const {
+    waiting.store(1, std::memory_order::relaxed);
+    std::atomic_thread_fence(std::memory_order::seq_cst);
+    if (predicate()) {
+      waiting.store(0, std::memory_order::relaxed);
+      return;
+    }
+
+    std::array<::pollfd, 2> pollfds{
+        ::pollfd{.fd = native_handle::get(own_event),
+                 .events = POLLIN,
+                 .revents = 0},
+        ::pollfd{.fd = native_handle::get(socket),
+                 .events = POLLIN,
+                 .revents = 0},
+    };
+    while (::poll(pollfds.data(), pollfds.size(), -1) == kSyscallError) {
+      if (errno != EINTR) [[unlikely]] {
+        waiting.store(0, std::memory_order::relaxed);
+        throw std::runtime_error(
+            std::format("poll failed: {}", std::strerror(errno)));
+      }
+    }
+    waiting.store(0, std::memory_order::relaxed);
+
+    if (pollfds[0].revents & POLLIN) {
+      std::uint64_t value;
+      const std::array<io::iovec, 1> iovecs{io::iovec(
+          std::as_writable_bytes(std::span<std::uint64_t, 1>(&value, 1)))};
+      static_cast<void>(own_event.read(iovecs));
+    }
+    // NOTE: the peer does not write to the socket after the handshake so any
+    // event means it has gone away
+    if (pollfds[1].revents != 0 && !predicate()) [[unlikely]] {
+      throw std::runtime_error("shm_channel peer has gone away");
+    }
+  }
+};
+
+shm_channel::shm_channel(net::unix::stream::socket socket,
+                         std::size_t capacity)
+    : pimpl_([&socket, &capacity]() -> impl {
+#ifdef __linux__
+        if (capacity == 0 || capacity > kMaxCapacity) [[unlikely]] {
+          throw std::invalid_argument(
+              std::format("invalid shm_channel capacity: {}", capacity));
+        }
+        capacity = std::bit_ceil(std::max(capacity, kMinCapacity));
+
+        const int memory_handle = ::memfd_create(
+            "core::net::unix::shm_channel", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+        if (memory_handle == kSyscallError) [[unlikely]] {
+          throw std::runtime_error(
+              std::format("memfd_create failed: {}", std::strerror(errno)));
+        }
+        const io::fd memory(memory_handle);
+        if (::ftruncate(memory_handle,
+                        static_cast<::off_t>(to_mapping_size(capacity))) ==
+            kSyscallError) [[unlikely]] {
+          throw std::runtime_error(
+              std::format("ftruncate failed: {}", std::strerror(errno)));
+        }
+        if (::fcntl(memory_handle, F_ADD_SEALS, kSeals) == kSyscallError)
+            [[unlikely]] {
+          throw std::runtime_error(
+              std::format("fcntl failed: {}", std::strerror(errno)));
+        }
+
+        io::fd own_event(create_event());
+        io::fd peer_event(create_event());
+
+        // NOTE: the fresh memfd is zero filled which is the initial state of
+        // both rings
+        mapping shared(memory_handle, to_mapping_size(capacity));
+        ring* tx = shared.get_ring(0, capacity);
+        ring* rx = shared.get_ring(1, capacity);
+
+        const std::uint64_t header = capacity;
+        const std::array<const io::fd*, kFds> fds{&memory, &own_event,
+                                                  &peer_event};
+        if (socket.send_fds(std::as_bytes(std::span<const std::uint64_t, 1>(
+                                &header, 1)),
+                            fds) != sizeof(header)) [[unlikely]] {
+          throw std::runtime_error(
+              "failed to pass the shared memory to the shm_channel peer");
+        }
+        return impl{
+            .socket = std::move(socket),
+            .own_event = std::move(own_event),
+            .peer_event = std::move(peer_event),
+            .memory = std::move(shared),
+            .tx = tx,
+            .rx = rx,
+            .capacity = capacity,
+            .head = 0,
+            .tail = 0,
+            .cached_tail = 0,
+            .cached_head = 0,
+        };
+#else
+        static_cast<void>(socket);
+        static_cast<void>(capacity);
+        throw std::invalid_argument(
+            "shm_channel is not supported on this platform");
+#endif
+      }()) {
+}
+
+shm_channel::shm_channel(net::unix::stream::socket socket)
+    : pimpl_([&socket]() -> impl {
+#ifdef __linux__
+        ::pollfd pollfd{.fd = native_handle::get(socket),
+                        .events = POLLIN,
+                        .revents = 0};
+        while (::poll(&pollfd, 1, -1) == kSyscallError) {
+          if (errno != EINTR) [[unlikely]] {
+            throw std::runtime_error(
+                std::format("poll failed: {}", std::strerror(errno)));
+          }
+        }
+
+        std::uint64_t header = 0;
+        std::vector<io::fd> fds;
+        if (socket.receive_fds(std::as_writable_bytes(
+                                   std::span<std::uint64_t, 1>(&header, 1)),
+                               fds, kFds) != sizeof(header) ||
+            fds.size() != kFds) [[unlikely]] {
+          throw std::runtime_error(
+              "failed to receive the shared memory from the shm_channel peer");
+        }
+
+        const int seals = ::fcntl(native_handle::get(fds[0]), F_GET_SEALS);
+        if (seals == kSyscallError) [[unlikely]] {
+          throw std::runtime_error(
+              std::format("fcntl failed: {}", std::strerror(errno)));
+        }
+        if ((seals & kSeals) != kSeals) [[unlikely]] {
+          throw std::runtime_error(
+              "shm_channel peer passed the shared memory unsealed");
+        }
+
+        const std::size_t capacity = header;
+        struct ::stat stat;
+        if (::fstat(native_handle::get(fds[0]), &stat) == kSyscallError)
+            [[unlikely]] {
+          throw std::runtime_error(
+              std::format("fstat failed: {}", std::strerror(errno)));
+        }
+        if (capacity < kMinCapacity || capacity > kMaxCapacity ||
+            !std::has_single_bit(capacity) ||
+            static_cast<std::size_t>(stat.st_size) !=
+                to_mapping_size(capacity)) [[unlikely]] {
+          throw std::runtime_error(
+              std::format("invalid shm_channel capacity: {}", capacity));
+        }
+
+        mapping shared(native_handle::get(fds[0]), to_mapping_size(capacity));
+        ring* tx = shared.get_ring(1, capacity);
+        ring* rx = shared.get_ring(0, capacity);
+        return impl{
+            .socket = std::move(socket),
+            .own_event = std::move(fds[2]),
+            .peer_event = std::move(fds[1]),
+            .memory = std::move(shared),
+            .tx = tx,
+            .rx = rx,
+            .capacity = capacity,
+            .head = 0,
+            .tail = 0,
+            .cached_tail = 0,
+            .cached_head = 0,
+        };
+#else
+        static_cast<void>(socket);
+        throw std::invalid_argument(
+            "shm_channel is not supported on this platform");
+#endif
+      }()) {
+}
+
+shm_channel::shm_channel(shm_channel&& that) noexcept
+    : pimpl_(std::move(that.pimpl_)) {}
+
+shm_channel& shm_channel::operator=(shm_channel&& that) noexcept {
+  pimpl_ = std::move(that.pimpl_);
+  return *this;
+}
+
+shm_channel::~shm_channel() noexcept = default;
+
+std::size_t shm_channel::get_max_message_size() const noexcept {
+  return pimpl_->capacity / 2 - sizeof(record);
+}
+
+bool shm_channel::try_send(std::span<const std::byte> message) {
+  if (message.empty() || message.size() > get_max_message_size())
+      [[unlikely]] {
+    throw std::invalid_argument(
+        std::format("invalid shm_channel message size: {}", message.size()));
+  }
+
+  auto& [socket, own_event, peer_event, memory, tx, rx, capacity, head, tail,
+         cached_tail, cached_head] = *pimpl_;
+  const std::size_t offset = head & (capacity - 1);
+  const std::size_t size = to_record_size(message.size());
+  const std::size_t padding =
+      (capacity - offset < size) ? capacity - offset : 0;
+  if (head + padding + size - cached_tail > capacity &&
+      head + padding + size -
+              (cached_tail = tx->tail.load(std::memory_order::acquire)) >
+          capacity) {
+    return false;
+  }
+
+  std::byte* data = pimpl_->get_data(tx);
+  if (padding != 0) {
+    const record wrap{.length = kWrap, .reserved = 0};
+    std::memcpy(data + offset, &wrap, sizeof(wrap));
+  }
+  const std::size_t message_offset = (head + padding) & (capacity - 1);
+  const record header{.length = static_cast<std::uint32_t>(message.size()),
+                      .reserved = 0};
+  std::memcpy(data + message_offset, &header, sizeof(header));
+  std::memcpy(data + message_offset + sizeof(header), message.data(),
+              message.size());
+  head += padding + size;
+  tx->head.store(head, std::memory_order::release);
+
+  notify(tx->reader_waiting, peer_event);
+  return true;
+}
+
+void shm_channel::send(std::span<const std::byte> message) {
+  while (!try_send(message)) {
+    const impl& impl = *pimpl_;
+    const std::uint64_t tail = impl.cached_tail;
+    impl.wait(impl.tx->writer_waiting, [&impl, tail] {
+      return impl.tx->tail.load(std::memory_order::acquire) != tail;
+    });
+  }
+}
+
+std::size_t shm_channel::try_receive(std::span<std::byte> bytes) {
+  auto& [socket, own_event, peer_event, memory, tx, rx, capacity, head, tail,
+         cached_tail, cached_head] = *pimpl_;
+  const std::byte* data = pimpl_->get_data(rx);
+  // NOTE: the ring is writable by the peer so that the head is checked to be
+  // aligned and at most a ring ahead and the records to stay within the ring
+  // and the published range. The own tail is always aligned
+  std::uint64_t position = tail;
+  while (true) {
+    if (position == cached_head) {
+      const std::uint64_t published = rx->head.load(std::memory_order::acquire);
+      if (published == position) {
+        return 0;
+      }
+      if (published % alignof(record) != 0 || published - position > capacity)
+          [[unlikely]] {
+        throw std::runtime_error("shm_channel ring is corrupted");
+      }
+      cached_head = published;
+    }
+
+    const std::size_t available = cached_head - position;
+    const std::size_t offset = position & (capacity - 1);
+    if (available > capacity || available < sizeof(record) ||
+        offset + sizeof(record) > capacity) [[unlikely]] {
+      throw std::runtime_error("shm_channel ring is corrupted");
+    }
+    record header;
+    std::memcpy(&header, data + offset, sizeof(header));
+    if (header.length == kWrap) {
+      if (available < capacity - offset) [[unlikely]] {
+        throw std::runtime_error("shm_channel ring is corrupted");
+      }
+      position += capacity - offset;
+      continue;
+    }
+    if (header.length == 0 ||
+        header.length > capacity - offset - sizeof(record) ||
+        to_record_size(header.length) > available) [[unlikely]] {
+      throw std::runtime_error(std::format(
+          "shm_channel ring is corrupted: message of {} bytes", header.length));
+    }
+
+    if (header.length > bytes.size()) [[unlikely]] {
+      tail = position;
+      rx->tail.store(tail, std::memory_order::release);
+      throw std::invalid_argument(std::format(
+          "shm_channel message of {} bytes does not fit the buffer of {}",
+          header.length, bytes.size()));
+    }
+    std::memcpy(bytes.data(), data + offset + sizeof(header), header.length);
+    tail = position + to_record_size(header.length);
+    rx->tail.store(tail, std::memory_order::release);
+
+    notify(rx->writer_waiting, peer_event);
+    return header.length;
+  }
+}
+
+std::size_t shm_channel::receive(std::span<std::byte> bytes) {
+  std::size_t received;
+  while ((received = try_receive(bytes)) == 0) {
+    const impl& impl = *pimpl_;
+    impl.wait(impl.rx->reader_waiting, [&impl] {
+      return impl.rx->head.load(std::memory_order::acquire) != impl.tail;
+    });
+  }
+  return received;
+}
+
+}  // namespace core::net::unix
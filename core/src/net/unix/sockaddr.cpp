@@ -2,6 +2,9 @@
 
 #include <sys/un.h>
 
+#include <cstddef>
+#include <cstring>
+
 namespace core::net::unix {
 
 namespace {
@@ -21,20 +24,30 @@ const sockaddr& sockaddr::kEmpty() noexcept {
 }
 
 sockaddr::sockaddr(std::string_view path)
-    : net::sockets::base_sockaddr(net::sockets::family::kUnix) {
-  if (path.size() >= kMaxPathSize) [[unlikely]] {
+    : net::sockets::basic_sockaddr<net::sockets::family::kUnix>() {
+  const bool abstract = !path.empty() && path.front() == '\0';
+  if (path.size() >= kMaxPathSize + (abstract ? 1 : 0)) [[unlikely]] {
     throw std::invalid_argument(
         std::format("invalid path size {}", path.size()));
   }
 
   ::sockaddr_un* storage = reinterpret_cast<::sockaddr_un*>(get_storage());
-  std::strncpy(storage->sun_path, path.data(), path.size());
+  std::memcpy(storage->sun_path, path.data(), path.size());
+  // NOTE: the abstract names are not null terminated and an empty path is an
+  // unnamed address
+  set_length(offsetof(::sockaddr_un, sun_path) + path.size() +
+             (abstract || path.empty() ? 0 : 1));
 }
 
 std::string_view sockaddr::get_path() const noexcept {
   const ::sockaddr_un* storage =
       reinterpret_cast<const ::sockaddr_un*>(get_storage());
-  return std::string_view(storage->sun_path);
+  const std::size_t size = get_length() - offsetof(::sockaddr_un, sun_path);
+  if (size != 0 && storage->sun_path[0] == '\0') {
+    return std::string_view(storage->sun_path, size);
+  }
+  return std::string_view(storage->sun_path,
+                          ::strnlen(storage->sun_path, size));
 }
 
 }  // namespace core::net::unix
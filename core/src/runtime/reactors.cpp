@@ -0,0 +1,283 @@
+#include "runtime/reactors.hpp"
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <exception>
+#include <format>
+#include <future>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace core::runtime {
+
+namespace {
+
+constexpr int kSyscallError = -1;
+constexpr std::size_t kCacheLineSize = 64;
+
+// NOTE: every counter has a single writer so that a relaxed load and store is
+// enough and no locked instruction is needed on the reactor thread
+void increment(std::atomic<std::uint64_t>& counter,
+               std::uint64_t value = 1) noexcept {
+  counter.store(counter.load(std::memory_order::relaxed) + value,
+                std::memory_order::relaxed);
+}
+
+std::vector<int> get_cpus() {
+  std::vector<int> cpus;
+#ifdef __linux__
+  ::cpu_set_t set;
+  CPU_ZERO(&set);
+  if (::sched_getaffinity(0, sizeof(set), &set) == kSyscallError)
+      [[unlikely]] {
+    throw std::runtime_error(
+        std::format("sched_getaffinity() failed: {}", std::strerror(errno)));
+  }
+  for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+    if (CPU_ISSET(cpu, &set)) {
+      cpus.push_back(cpu);
+    }
+  }
+#else
+  const unsigned count = std::max(std::thread::hardware_concurrency(), 1u);
+  for (unsigned cpu = 0; cpu < count; ++cpu) {
+    cpus.push_back(static_cast<int>(cpu));
+  }
+#endif
+  return cpus;
+}
+
+// NOTE: pins the calling thread
+void pin(int cpu) {
+#ifdef __linux__
+  ::cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  const int error =
+      ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set);
+  if (error != 0) [[unlikely]] {
+    throw std::runtime_error(std::format("pthread_setaffinity_np() failed: {}",
+                                         std::strerror(error)));
+  }
+#else
+  (void)cpu;
+#endif
+}
+
+struct reactor final {
+  reactor(int cpu, reactors::accept_callback_t accept_callback,
+          io::poller::callback_t callback)
+      : poller([this, accept_callback = std::move(accept_callback),
+                callback = std::move(callback)](
+                   io::poller& poller, const io::fd& fd,
+                   io::poller::events_t events, void* data) {
+          if (data != &listener) [[likely]] {
+            increment(load.events);
+            callback(poller, fd, events, data);
+            return;
+          }
+
+          // NOTE: accept4() creates the sockets nonblocking and
+          // close-on-exec without the extra fcntl() calls
+          net::inet::tcp::socket socket(utils::uninitialized_t{});
+          while (listener.accept_many(std::span(&socket, 1)) == 1) {
+            increment(load.accepted);
+            accept_callback(poller, std::move(socket));
+          }
+        }),
+        listener(net::sockets::kNonblock | net::sockets::kCloexec),
+        cpu(cpu) {}
+
+  io::poller poller;
+  net::inet::tcp::socket listener;
+  std::thread thread;
+  int cpu;
+  std::atomic<bool> running = false;
+  std::exception_ptr failure;
+
+  struct alignas(kCacheLineSize) {
+    std::atomic<std::uint64_t> wakeups = 0;
+    std::atomic<std::uint64_t> events = 0;
+    std::atomic<std::uint64_t> accepted = 0;
+    std::atomic<std::uint64_t> errors = 0;
+  } load;
+
+  // NOTE: a failure of poll() itself e.g. of epoll_wait() ends the loop since
+  // it would most likely repeat, the exception is kept for stop() instead of
+  // escaping the thread and terminating the process
+  void run() {
+    while (running.load(std::memory_order::acquire)) {
+      try {
+        increment(load.errors, poller.poll());
+      } catch (...) {
+        increment(load.errors);
+        failure = std::current_exception();
+        running.store(false, std::memory_order::release);
+      }
+      increment(load.wakeups);
+    }
+  }
+};
+
+}  // namespace
+
+struct reactors::impl final {
+  std::vector<std::unique_ptr<reactor>> reactors;
+  bool running;
+};
+
+reactors::reactors(const net::inet::sockaddr& sockaddr,
+                   accept_callback_t accept_callback,
+                   io::poller::callback_t callback, std::size_t count,
+                   std::size_t backlog)
+    : pimpl_(impl{
+          .reactors = {},
+          .running = false,
+      }) {
+  const std::vector<int> cpus = get_cpus();
+  if (count == 0) {
+    count = cpus.size();
+  }
+
+  // NOTE: a fresh sockaddr so that the port picked by the kernel for the first
+  // listener is reused by the rest of them
+  net::inet::sockaddr bound(sockaddr.get_ip(), sockaddr.get_port());
+  auto& reactors = pimpl_->reactors;
+  reactors.reserve(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    auto& reactor = reactors.emplace_back(std::make_unique<runtime::reactor>(
+        cpus[i % cpus.size()], accept_callback, callback));
+
+    net::inet::tcp::socket& listener = reactor->listener;
+    listener.set_reuseaddr(true);
+    listener.set_reuseport(true);
+    if (listener.bind(bound) != net::inet::tcp::socket::bind_status::kSuccess)
+        [[unlikely]] {
+      throw std::runtime_error(
+          std::format("bind() failed: {} is in use", bound));
+    }
+    listener.get_bind_sockaddr(bound);
+    listener.listen(backlog);
+    reactor->poller.insert_or_assign(listener, io::poller::event::kPollIn,
+                                     &listener);
+  }
+}
+
+reactors::~reactors() noexcept {
+  try {
+    stop();
+  } catch (...) {
+  }
+}
+
+std::size_t reactors::size() const noexcept {
+  return pimpl_->reactors.size();
+}
+
+void reactors::get_bind_sockaddr(net::inet::sockaddr& sockaddr) const {
+  pimpl_->reactors.at(0)->listener.get_bind_sockaddr(sockaddr);
+}
+
+reactors::load reactors::get_load(std::size_t reactor) const {
+  const auto& load = pimpl_->reactors.at(reactor)->load;
+  return reactors::load{
+      .wakeups = load.wakeups.load(std::memory_order::relaxed),
+      .events = load.events.load(std::memory_order::relaxed),
+      .accepted = load.accepted.load(std::memory_order::relaxed),
+      .errors = load.errors.load(std::memory_order::relaxed),
+  };
+}
+
+void reactors::start() {
+  auto& [reactors, running] = *pimpl_;
+  if (running) [[unlikely]] {
+    throw std::runtime_error("start() failed: reactors are already running");
+  }
+
+  running = true;
+  try {
+    for (auto& reactor : reactors) {
+      reactor->running.store(true, std::memory_order::release);
+      // NOTE: the thread pins itself before its first poll() and start()
+      // waits for that so that no reactor ever runs on another CPU
+      std::promise<void> pinned;
+      std::future<void> future = pinned.get_future();
+      reactor->thread = std::thread(
+          [raw = reactor.get(), pinned = std::move(pinned)]() mutable {
+            try {
+              pin(raw->cpu);
+            } catch (...) {
+              pinned.set_exception(std::current_exception());
+              return;
+            }
+            pinned.set_value();
+            raw->run();
+          });
+      future.get();
+    }
+  } catch (...) {
+    try {
+      stop();
+    } catch (...) {
+    }
+    throw;
+  }
+}
+
+void reactors::stop() {
+  auto& [reactors, running] = *pimpl_;
+  if (!running) {
+    return;
+  }
+
+  // NOTE: every reactor is stopped and joined even if some of them fail, the
+  // first error is rethrown afterwards
+  std::exception_ptr error;
+  for (auto& reactor : reactors) {
+    reactor->running.store(false, std::memory_order::release);
+    try {
+      reactor->poller.wakeup();
+    } catch (...) {
+      if (!error) {
+        error = std::current_exception();
+      }
+    }
+  }
+  for (auto& reactor : reactors) {
+    try {
+      if (reactor->thread.joinable()) {
+        reactor->thread.join();
+      }
+    } catch (...) {
+      if (!error) {
+        error = std::current_exception();
+      }
+    }
+    if (auto failure = std::exchange(reactor->failure, nullptr); !error) {
+      error = std::move(failure);
+    }
+  }
+  running = false;
+  if (error) [[unlikely]] {
+    std::rethrow_exception(error);
+  }
+}
+
+bool reactors::is_running() const noexcept { return pimpl_->running; }
+
+void reactors::post(std::size_t reactor, io::poller::task_t task) {
+  pimpl_->reactors.at(reactor)->poller.post(std::move(task));
+}
+
+}  // namespace core::runtime
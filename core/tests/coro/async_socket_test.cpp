@@ -0,0 +1,186 @@
+#include "coro/async_socket.hpp"
+
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <vector>
+
+#include "coro/task.hpp"
+#include "net/inet/sockaddr.hpp"
+#include "net/inet/tcp/socket.hpp"
+
+namespace tests::coro {
+
+namespace {
+
+constexpr std::chrono::milliseconds kTimeout(10);
+constexpr std::size_t kMaxPolls = 1000;
+
+core::coro::task<> serve(core::io::poller& poller,
+                         core::net::inet::tcp::socket& listener,
+                         std::size_t& echoed, bool& served) {
+  core::coro::async_socket acceptor(poller, listener);
+  core::net::inet::tcp::socket peer(core::utils::uninitialized_t{});
+  co_await acceptor.async_accept(peer);
+  peer.set_nonblock(true);
+
+  core::coro::async_socket socket(poller, peer);
+  std::vector<std::byte> buffer(4);
+  while (const std::size_t received = co_await socket.async_receive(buffer)) {
+    echoed += co_await socket.async_send(std::span(buffer).first(received));
+  }
+  served = true;
+}
+
+core::coro::task<> request(core::io::poller& poller,
+                           const core::net::inet::sockaddr& sockaddr,
+                           const std::vector<std::byte>& bytes,
+                           std::vector<std::byte>& response, bool& done) {
+  core::net::inet::tcp::socket client;
+  client.set_nonblock(true);
+
+  core::coro::async_socket socket(poller, client);
+  EXPECT_EQ(co_await socket.async_connect(sockaddr),
+            core::net::inet::tcp::socket::connection_status::kSuccess);
+
+  std::span<const std::byte> pending(bytes);
+  while (!pending.empty()) {
+    pending = pending.subspan(co_await socket.async_send(pending));
+  }
+
+  std::vector<std::byte> buffer(bytes.size());
+  while (response.size() < bytes.size()) {
+    const std::size_t received = co_await socket.async_receive(buffer);
+    response.insert(response.end(), buffer.begin(), buffer.begin() + received);
+  }
+  done = true;
+}
+
+}  // namespace
+
+class coro_async_socket_backend
+    : public ::testing::TestWithParam<core::io::poller::backend> {};
+
+TEST_P(coro_async_socket_backend, echo) {
+  const auto& backend = GetParam();
+  try {
+    core::io::poller(core::io::poller::callback_t{}, backend);
+  } catch (...) {
+    GTEST_SKIP() << "unsupported poller backend";
+  }
+
+  const std::vector<std::byte> kBytes{std::byte(1), std::byte(2), std::byte(3),
+                                      std::byte(4), std::byte(5), std::byte(6),
+                                      std::byte(7), std::byte(8), std::byte(9)};
+
+  core::io::poller poller(&core::coro::async_socket::dispatch, backend);
+
+  core::net::inet::sockaddr sockaddr(core::net::inet::ip::kLoopback(),
+                                     core::net::inet::port(0));
+  core::net::inet::tcp::socket listener;
+  listener.set_nonblock(true);
+  listener.bind(sockaddr);
+  listener.get_bind_sockaddr(sockaddr);
+  listener.listen(1);
+
+  std::size_t echoed = 0;
+  bool served = false;
+  core::coro::spawn(serve(poller, listener, echoed, served));
+
+  bool done = false;
+  std::vector<std::byte> response;
+  core::coro::spawn(request(poller, sockaddr, kBytes, response, done));
+
+  for (std::size_t i = 0; i < kMaxPolls && !done; ++i) {
+    EXPECT_EQ(poller.try_poll(kTimeout), 0);
+  }
+  EXPECT_TRUE(done);
+  EXPECT_EQ(response, kBytes);
+
+  // NOTE: the client is closed and the server observes the end of the stream
+  for (std::size_t i = 0; i < kMaxPolls && !served; ++i) {
+    EXPECT_EQ(poller.try_poll(kTimeout), 0);
+  }
+  EXPECT_TRUE(served);
+  EXPECT_EQ(echoed, kBytes.size());
+}
+
+TEST_P(coro_async_socket_backend, refused) {
+  const auto& backend = GetParam();
+  try {
+    core::io::poller(core::io::poller::callback_t{}, backend);
+  } catch (...) {
+    GTEST_SKIP() << "unsupported poller backend";
+  }
+
+  core::io::poller poller(&core::coro::async_socket::dispatch, backend);
+
+  // NOTE: a bound but not listening socket refuses the connections
+  core::net::inet::sockaddr sockaddr(core::net::inet::ip::kLoopback(),
+                                     core::net::inet::port(0));
+  core::net::inet::tcp::socket closed;
+  closed.bind(sockaddr);
+  closed.get_bind_sockaddr(sockaddr);
+
+  std::optional<core::net::inet::tcp::socket::connection_status> status;
+  core::coro::spawn([](core::io::poller& poller,
+                       const core::net::inet::sockaddr& sockaddr,
+                       auto& status) -> core::coro::task<> {
+    core::net::inet::tcp::socket client;
+    client.set_nonblock(true);
+    core::coro::async_socket socket(poller, client);
+    status = co_await socket.async_connect(sockaddr);
+  }(poller, sockaddr, status));
+
+  for (std::size_t i = 0; i < kMaxPolls && !status; ++i) {
+    EXPECT_EQ(poller.try_poll(kTimeout), 0);
+  }
+  EXPECT_EQ(status, core::net::inet::tcp::socket::connection_status::kRefused);
+}
+
+// NOTE: a readiness without data must not be taken for the end of the stream
+TEST(coro_async_socket, spurious_wakeup) {
+  core::io::poller poller(&core::coro::async_socket::dispatch,
+                          core::io::poller::backend::kPoll);
+
+  core::net::inet::sockaddr sockaddr(core::net::inet::ip::kLoopback(),
+                                     core::net::inet::port(0));
+  core::net::inet::tcp::socket listener;
+  listener.bind(sockaddr);
+  listener.get_bind_sockaddr(sockaddr);
+  listener.listen(1);
+
+  core::net::inet::tcp::socket client;
+  EXPECT_EQ(client.connect(sockaddr),
+            core::net::inet::tcp::socket::connection_status::kSuccess);
+  client.set_nonblock(true);
+  core::net::inet::tcp::socket peer(core::utils::uninitialized_t{});
+  EXPECT_EQ(listener.accept(peer),
+            core::net::inet::tcp::socket::accept_status::kSuccess);
+
+  core::coro::async_socket socket(poller, client);
+  std::vector<std::byte> buffer(4);
+  std::optional<std::size_t> received;
+  core::coro::spawn([](core::coro::async_socket& socket,
+                       std::vector<std::byte>& buffer,
+                       auto& received) -> core::coro::task<> {
+    received = co_await socket.async_receive(buffer);
+  }(socket, buffer, received));
+
+  core::coro::async_socket::dispatch(poller, client,
+                                     core::io::poller::event::kPollIn, &socket);
+  EXPECT_EQ(received, std::nullopt);
+
+  const std::vector<std::byte> kBytes{std::byte(1), std::byte(2)};
+  EXPECT_EQ(peer.send(kBytes), kBytes.size());
+  for (std::size_t i = 0; i < kMaxPolls && !received; ++i) {
+    EXPECT_EQ(poller.try_poll(kTimeout), 0);
+  }
+  EXPECT_EQ(received, kBytes.size());
+}
+
+INSTANTIATE_TEST_SUITE_P(coro_async_socket_backend, coro_async_socket_backend,
+                         ::testing::Values(core::io::poller::backend::kPoll,
+                                           core::io::poller::backend::kEpoll));
+
+}  // namespace tests::coro
@@ -0,0 +1,88 @@
+#include "coro/task.hpp"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+namespace tests::coro {
+
+namespace {
+
+core::coro::task<int> get_value(int value) { co_return value; }
+
+core::coro::task<int> get_sum(int lhs, int rhs) {
+  co_return co_await get_value(lhs) + co_await get_value(rhs);
+}
+
+core::coro::task<int> get_error() {
+  throw std::runtime_error("error");
+  co_return 0;
+}
+
+}  // namespace
+
+TEST(coro_task, size) {
+  static_assert(sizeof(core::coro::task<int>) == 8);
+  static_assert(alignof(core::coro::task<int>) == 8);
+}
+
+TEST(coro_task, lazy) {
+  bool started = false;
+  auto task = [](bool& started) -> core::coro::task<> {
+    started = true;
+    co_return;
+  }(started);
+  EXPECT_FALSE(started);
+  EXPECT_FALSE(task.done());
+
+  core::coro::spawn(std::move(task));
+  EXPECT_TRUE(started);
+}
+
+TEST(coro_task, value) {
+  int result = 0;
+  core::coro::spawn([](int& result) -> core::coro::task<> {
+    result = co_await get_sum(1, 2);
+  }(result));
+  EXPECT_EQ(result, 3);
+}
+
+TEST(coro_task, exception) {
+  bool caught = false;
+  core::coro::spawn([](bool& caught) -> core::coro::task<> {
+    try {
+      co_await get_error();
+    } catch (const std::runtime_error&) {
+      caught = true;
+    }
+  }(caught));
+  EXPECT_TRUE(caught);
+
+  core::coro::spawn([]() -> core::coro::task<> {
+    co_await get_error();
+  }());
+}
+
+TEST(coro_task, sequential_awaits) {
+  constexpr int kIterations = 1000000;
+
+  int result = 0;
+  core::coro::spawn([](int& result) -> core::coro::task<> {
+    for (int i = 0; i < kIterations; ++i) {
+      result += co_await get_value(1);
+    }
+  }(result));
+  EXPECT_EQ(result, kIterations);
+}
+
+TEST(coro_frame_allocator, recycle) {
+  void* frame = core::coro::allocate_frame(100);
+  core::coro::deallocate_frame(frame, 100);
+  EXPECT_EQ(core::coro::allocate_frame(128), frame);
+  core::coro::deallocate_frame(frame, 128);
+
+  void* large = core::coro::allocate_frame(1 << 20);
+  core::coro::deallocate_frame(large, 1 << 20);
+}
+
+}  // namespace tests::coro
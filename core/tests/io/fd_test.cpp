@@ -2,6 +2,13 @@
 
 #include <gtest/gtest.h>
 
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <array>
+#include <cstdio>
+#include <vector>
+
 namespace tests::io {
 
 TEST(io_fd, size) {
@@ -51,4 +58,71 @@ TEST(io_fd, equality) {
   EXPECT_NE(core::io::fd::kStdout(), core::io::fd::kStderr());
 }
 
+TEST(io_fd, vectored_read_write) {
+  std::array<int, 2> pipe;
+  ASSERT_EQ(::pipe2(pipe.data(), O_NONBLOCK), 0);
+  const core::io::fd reader(pipe[0]);
+  const core::io::fd writer(pipe[1]);
+
+  const std::vector<std::byte> header{std::byte(1), std::byte(2)};
+  const std::vector<std::byte> body{std::byte(3), std::byte(4), std::byte(5)};
+  const std::array<core::io::const_iovec, 2> out{
+      core::io::const_iovec(header),
+      core::io::const_iovec(body),
+  };
+  EXPECT_EQ(writer.write(out), header.size() + body.size());
+
+  std::vector<std::byte> first(1);
+  std::vector<std::byte> second(8);
+  const std::array<core::io::iovec, 2> in{
+      core::io::iovec(first),
+      core::io::iovec(second),
+  };
+  EXPECT_EQ(reader.read(in), header.size() + body.size());
+  EXPECT_EQ(first, std::vector<std::byte>{std::byte(1)});
+  EXPECT_EQ(std::vector(second.begin(), second.begin() + 4),
+            (std::vector<std::byte>{std::byte(2), std::byte(3), std::byte(4),
+                                    std::byte(5)}));
+
+  EXPECT_EQ(reader.read(in), 0);
+}
+
+TEST(io_fd, send_file_copy_file_range) {
+  std::FILE* file = std::tmpfile();
+  ASSERT_NE(file, nullptr);
+  const core::io::fd source(::dup(::fileno(file)));
+  std::fclose(file);
+  file = std::tmpfile();
+  ASSERT_NE(file, nullptr);
+  const core::io::fd destination(::dup(::fileno(file)));
+  std::fclose(file);
+
+  const std::vector<std::byte> kBytes{std::byte(1), std::byte(2),
+                                      std::byte(3), std::byte(4)};
+  const std::array<core::io::const_iovec, 1> out{
+      core::io::const_iovec(kBytes)};
+  ASSERT_EQ(source.write(out), kBytes.size());
+
+  std::uint64_t offset = 1;
+  std::uint64_t out_offset = 0;
+  EXPECT_EQ(destination.copy_file_range(source, offset, out_offset, 8), 3);
+  EXPECT_EQ(offset, 4);
+  EXPECT_EQ(out_offset, 3);
+  EXPECT_EQ(destination.copy_file_range(source, offset, out_offset, 8), 0);
+
+  std::array<int, 2> pipe;
+  ASSERT_EQ(::pipe2(pipe.data(), O_NONBLOCK), 0);
+  const core::io::fd reader(pipe[0]);
+  const core::io::fd writer(pipe[1]);
+
+  offset = 0;
+  EXPECT_EQ(writer.send_file(destination, offset, 8), 3);
+  EXPECT_EQ(offset, 3);
+
+  std::vector<std::byte> bytes(3);
+  const std::array<core::io::iovec, 1> in{core::io::iovec(bytes)};
+  EXPECT_EQ(reader.read(in), 3);
+  EXPECT_EQ(bytes, std::vector(kBytes.begin() + 1, kBytes.end()));
+}
+
 }  // namespace tests::io
@@ -0,0 +1,93 @@
+#include "io/iovec.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace tests::io {
+
+TEST(io_iovec, size) {
+  static_assert(sizeof(core::io::iovec) == 2 * sizeof(void*));
+  static_assert(alignof(core::io::iovec) == alignof(void*));
+  static_assert(sizeof(core::io::const_iovec) == 2 * sizeof(void*));
+  static_assert(alignof(core::io::const_iovec) == alignof(void*));
+}
+
+TEST(io_iovec, constness) {
+  static_assert(
+      !std::is_constructible_v<core::io::iovec, std::span<const std::byte>>);
+  static_assert(
+      std::is_constructible_v<core::io::const_iovec, std::span<std::byte>>);
+}
+
+TEST(io_iovec_cursor, empty) {
+  core::io::iovec_cursor cursor({});
+  EXPECT_TRUE(cursor.is_done());
+  EXPECT_EQ(cursor.get_pending_bytes(), 0);
+  cursor.advance(1);
+  EXPECT_TRUE(cursor.is_done());
+
+  std::array<core::io::iovec, 2> iovecs{};
+  EXPECT_TRUE(core::io::iovec_cursor(iovecs).is_done());
+}
+
+TEST(io_iovec_cursor, advance) {
+  const std::vector<std::byte> header(3);
+  const std::vector<std::byte> empty;
+  const std::vector<std::byte> body(5);
+  std::array<core::io::const_iovec, 3> iovecs{
+      core::io::const_iovec(header),
+      core::io::const_iovec(empty),
+      core::io::const_iovec(body),
+  };
+
+  core::io::const_iovec_cursor cursor(iovecs);
+  EXPECT_FALSE(cursor.is_done());
+  EXPECT_EQ(cursor.get_pending().size(), 3);
+  EXPECT_EQ(cursor.get_pending_bytes(), 8);
+
+  cursor.advance(0);
+  EXPECT_EQ(cursor.get_pending().size(), 3);
+  EXPECT_EQ(cursor.get_pending_bytes(), 8);
+
+  cursor.advance(2);
+  EXPECT_EQ(cursor.get_pending().size(), 3);
+  EXPECT_EQ(cursor.get_pending().front().base, header.data() + 2);
+  EXPECT_EQ(cursor.get_pending().front().length, 1);
+  EXPECT_EQ(cursor.get_pending_bytes(), 6);
+
+  cursor.advance(1);
+  EXPECT_EQ(cursor.get_pending().size(), 1);
+  EXPECT_EQ(cursor.get_pending().front().base, body.data());
+  EXPECT_EQ(cursor.get_pending_bytes(), 5);
+
+  cursor.advance(4);
+  EXPECT_EQ(cursor.get_pending().front().base, body.data() + 4);
+  EXPECT_EQ(cursor.get_pending_bytes(), 1);
+
+  cursor.advance(1);
+  EXPECT_TRUE(cursor.is_done());
+  EXPECT_EQ(cursor.get_pending_bytes(), 0);
+}
+
+TEST(io_iovec_cursor, advance_across) {
+  const std::vector<std::byte> first(2);
+  const std::vector<std::byte> second(2);
+  const std::vector<std::byte> third(2);
+  std::array<core::io::const_iovec, 3> iovecs{
+      core::io::const_iovec(first),
+      core::io::const_iovec(second),
+      core::io::const_iovec(third),
+  };
+
+  core::io::const_iovec_cursor cursor(iovecs);
+  cursor.advance(5);
+  EXPECT_EQ(cursor.get_pending().size(), 1);
+  EXPECT_EQ(cursor.get_pending().front().base, third.data() + 1);
+  EXPECT_EQ(cursor.get_pending_bytes(), 1);
+}
+
+}  // namespace tests::io
@@ -2,10 +2,15 @@
 
 #include <gtest/gtest.h>
 
+#include <thread>
+
+#include "net/inet/sockaddr.hpp"
+#include "net/inet/udp/socket.hpp"
+
 namespace tests::io {
 
 TEST(io_poller, size) {
-  static_assert(sizeof(core::io::poller) == 120);
+  static_assert(sizeof(core::io::poller) == 1288);
   static_assert(alignof(core::io::poller) == 8);
 }
 
@@ -34,4 +39,406 @@ TEST(io_poller, insert_or_assign_erase) {
   EXPECT_FALSE(poller.erase(fd_stdout));
 }
 
-}  // namespace tests::io
\ No newline at end of file
+namespace {
+
+class bound_socket final {
+ public:
+  bound_socket() {
+    socket.set_nonblock(true);
+    socket.bind(sockaddr);
+    socket.get_bind_sockaddr(sockaddr);
+  }
+
+ public:
+  core::net::inet::udp::socket socket;
+  core::net::inet::sockaddr sockaddr{core::net::inet::ip::kLoopback(),
+                                     core::net::inet::port(0)};
+};
+
+}  // namespace
+
+class io_poller_backend
+    : public ::testing::TestWithParam<core::io::poller::backend> {};
+
+TEST_P(io_poller_backend, construction) {
+  const auto& backend = GetParam();
+  try {
+    core::io::poller(core::io::poller::callback_t{}, backend);
+  } catch (...) {
+    GTEST_SKIP() << "unsupported poller backend";
+  }
+
+  core::io::poller poller(core::io::poller::callback_t{}, backend);
+  EXPECT_EQ(poller.get_backend(), backend);
+  core::io::poller moved_to(std::move(poller));
+  EXPECT_EQ(moved_to.get_backend(), backend);
+}
+
+TEST_P(io_poller_backend, dispatch) {
+  const auto& backend = GetParam();
+  try {
+    core::io::poller(core::io::poller::callback_t{}, backend);
+  } catch (...) {
+    GTEST_SKIP() << "unsupported poller backend";
+  }
+
+  const std::vector<std::byte> kBuffer{std::byte(1)};
+  bound_socket server;
+  bound_socket client;
+
+  std::size_t calls = 0;
+  core::io::poller poller(
+      [&server, &calls](core::io::poller&, const core::io::fd& fd,
+                        core::io::poller::events_t events, void*) {
+        EXPECT_EQ(fd, server.socket);
+        EXPECT_TRUE(events & core::io::poller::event::kPollIn);
+        calls += 1;
+      },
+      backend);
+
+  EXPECT_TRUE(
+      poller.insert_or_assign(server.socket, core::io::poller::event::kPollIn));
+  EXPECT_EQ(poller.try_poll(std::chrono::milliseconds(0)), 0);
+  EXPECT_EQ(calls, 0);
+
+  EXPECT_EQ(client.socket.send_to(kBuffer, server.sockaddr), kBuffer.size());
+  EXPECT_EQ(poller.try_poll(std::chrono::milliseconds(1000)), 0);
+  EXPECT_EQ(calls, 1);
+
+  EXPECT_EQ(poller.try_poll(std::chrono::milliseconds(0)), 0);
+  EXPECT_EQ(calls, 2);
+
+  EXPECT_TRUE(poller.erase(server.socket));
+  EXPECT_EQ(poller.try_poll(std::chrono::milliseconds(0)), 0);
+  EXPECT_EQ(calls, 2);
+}
+
+TEST_P(io_poller_backend, data) {
+  const auto& backend = GetParam();
+  try {
+    core::io::poller(core::io::poller::callback_t{}, backend);
+  } catch (...) {
+    GTEST_SKIP() << "unsupported poller backend";
+  }
+
+  bound_socket first;
+  bound_socket second;
+  bound_socket inserted;
+  int first_data = 0;
+  int second_data = 0;
+  int inserted_data = 0;
+
+  core::io::poller poller(
+      [&inserted, &inserted_data](core::io::poller& poller,
+                                  const core::io::fd&,
+                                  core::io::poller::events_t, void* data) {
+        *static_cast<int*>(data) += 1;
+        poller.insert_or_assign(inserted.socket,
+                                core::io::poller::event::kPollOut,
+                                &inserted_data);
+      },
+      backend);
+
+  EXPECT_TRUE(poller.insert_or_assign(
+      first.socket, core::io::poller::event::kPollOut, &first_data));
+  EXPECT_TRUE(poller.insert_or_assign(
+      second.socket, core::io::poller::event::kPollOut, &second_data));
+  EXPECT_EQ(poller.try_poll(std::chrono::milliseconds(1000)), 0);
+  EXPECT_EQ(first_data, 1);
+  EXPECT_EQ(second_data, 1);
+  EXPECT_EQ(inserted_data, 0);
+
+  EXPECT_FALSE(poller.insert_or_assign(
+      first.socket, core::io::poller::event::kPollOut, &second_data));
+  EXPECT_TRUE(poller.erase(second.socket));
+  EXPECT_EQ(poller.try_poll(std::chrono::milliseconds(1000)), 0);
+  EXPECT_EQ(first_data, 1);
+  EXPECT_EQ(second_data, 2);
+  EXPECT_EQ(inserted_data, 1);
+}
+
+TEST_P(io_poller_backend, unhandled) {
+  const auto& backend = GetParam();
+  try {
+    core::io::poller(core::io::poller::callback_t{}, backend);
+  } catch (...) {
+    GTEST_SKIP() << "unsupported poller backend";
+  }
+
+  const std::vector<std::byte> kBuffer{std::byte(1)};
+  bound_socket server;
+  bound_socket client;
+
+  core::io::poller poller(
+      [](core::io::poller&, const core::io::fd&, core::io::poller::events_t,
+         void*) { throw std::runtime_error("unhandled"); },
+      backend);
+  poller.insert_or_assign(server.socket, core::io::poller::event::kPollIn);
+  poller.insert_or_assign(client.socket, core::io::poller::event::kPollOut);
+
+  EXPECT_EQ(client.socket.send_to(kBuffer, server.sockaddr), kBuffer.size());
+  EXPECT_EQ(poller.try_poll(std::chrono::milliseconds(1000)), 2);
+}
+
+TEST_P(io_poller_backend, erase_from_callback) {
+  const auto& backend = GetParam();
+  try {
+    core::io::poller(core::io::poller::callback_t{}, backend);
+  } catch (...) {
+    GTEST_SKIP() << "unsupported poller backend";
+  }
+
+  bound_socket first;
+  bound_socket second;
+
+  std::size_t calls = 0;
+  core::io::poller poller(
+      [&first, &second, &calls](core::io::poller& poller,
+                                const core::io::fd& fd,
+                                core::io::poller::events_t, void*) {
+        EXPECT_TRUE(poller.erase(fd == first.socket ? second.socket
+                                                    : first.socket));
+        calls += 1;
+      },
+      backend);
+  poller.insert_or_assign(first.socket, core::io::poller::event::kPollOut);
+  poller.insert_or_assign(second.socket, core::io::poller::event::kPollOut);
+
+  EXPECT_EQ(poller.try_poll(std::chrono::milliseconds(1000)), 0);
+  EXPECT_EQ(calls, 1);
+}
+
+TEST_P(io_poller_backend, edge_triggered) {
+  const auto& backend = GetParam();
+  try {
+    core::io::poller(core::io::poller::callback_t{}, backend);
+  } catch (...) {
+    GTEST_SKIP() << "unsupported poller backend";
+  }
+
+  const std::vector<std::byte> kBuffer{std::byte(1)};
+  bound_socket server;
+  bound_socket client;
+
+  std::size_t calls = 0;
+  core::io::poller poller(
+      [&calls](core::io::poller&, const core::io::fd&,
+               core::io::poller::events_t events, void*) {
+        EXPECT_FALSE(events & core::io::poller::event::kPollEt);
+        calls += 1;
+      },
+      backend);
+
+  if (backend == core::io::poller::backend::kPoll) {
+    EXPECT_ANY_THROW(poller.insert_or_assign(
+        server.socket, core::io::poller::event::kPollIn |
+                           core::io::poller::event::kPollEt));
+    return;
+  }
+
+  EXPECT_TRUE(poller.insert_or_assign(
+      server.socket,
+      core::io::poller::event::kPollIn | core::io::poller::event::kPollEt));
+  EXPECT_EQ(client.socket.send_to(kBuffer, server.sockaddr), kBuffer.size());
+  EXPECT_EQ(poller.try_poll(std::chrono::milliseconds(1000)), 0);
+  EXPECT_EQ(calls, 1);
+  EXPECT_EQ(poller.try_poll(std::chrono::milliseconds(0)), 0);
+  EXPECT_EQ(calls, 1);
+
+  EXPECT_EQ(client.socket.send_to(kBuffer, server.sockaddr), kBuffer.size());
+  EXPECT_EQ(poller.try_poll(std::chrono::milliseconds(1000)), 0);
+  EXPECT_EQ(calls, 2);
+}
+
+TEST_P(io_poller_backend, timers) {
+  const auto& backend = GetParam();
+  try {
+    core::io::poller(core::io::poller::callback_t{}, backend);
+  } catch (...) {
+    GTEST_SKIP() << "unsupported poller backend";
+  }
+
+  bound_socket server;
+
+  std::size_t calls = 0;
+  core::io::poller poller(core::io::poller::callback_t{}, backend);
+  poller.insert_or_assign(server.socket, core::io::poller::event::kPollIn);
+
+  const auto cancelled = poller.schedule(std::chrono::milliseconds(1),
+                                         [&calls] { calls += 1; });
+  poller.schedule(std::chrono::milliseconds(10), [&poller, &calls] {
+    poller.schedule(std::chrono::milliseconds(0), [&calls] { calls += 1; });
+    calls += 1;
+  });
+  EXPECT_TRUE(poller.cancel(cancelled));
+  EXPECT_FALSE(poller.cancel(cancelled));
+
+  const auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(poller.poll(), 0);
+  EXPECT_GE(std::chrono::steady_clock::now() - start,
+            std::chrono::milliseconds(10));
+  EXPECT_EQ(calls, 1);
+
+  EXPECT_EQ(poller.poll(), 0);
+  EXPECT_EQ(calls, 2);
+}
+
+TEST_P(io_poller_backend, post) {
+  const auto& backend = GetParam();
+  try {
+    core::io::poller(core::io::poller::callback_t{}, backend);
+  } catch (...) {
+    GTEST_SKIP() << "unsupported poller backend";
+  }
+
+  core::io::poller poller(core::io::poller::callback_t{}, backend);
+  EXPECT_EQ(poller.try_poll(std::chrono::milliseconds(0)), 0);
+
+  std::vector<int> executed;
+  std::thread thread([&poller, &executed] {
+    for (int i = 0; i < 3; ++i) {
+      poller.post([&executed, i] { executed.push_back(i); });
+    }
+    EXPECT_TRUE(poller.try_post([] { throw std::runtime_error("unhandled"); }));
+  });
+  thread.join();
+
+  EXPECT_EQ(poller.poll(), 1);
+  EXPECT_EQ(executed, std::vector<int>({0, 1, 2}));
+  EXPECT_EQ(poller.try_poll(std::chrono::milliseconds(0)), 0);
+  EXPECT_EQ(executed.size(), 3);
+}
+
+TEST_P(io_poller_backend, wakeup) {
+  const auto& backend = GetParam();
+  try {
+    core::io::poller(core::io::poller::callback_t{}, backend);
+  } catch (...) {
+    GTEST_SKIP() << "unsupported poller backend";
+  }
+
+  core::io::poller poller(core::io::poller::callback_t{}, backend);
+  std::thread thread([&poller] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    poller.wakeup();
+  });
+  EXPECT_EQ(poller.poll(), 0);
+  thread.join();
+
+  poller.wakeup();
+  poller.wakeup();
+  EXPECT_EQ(poller.try_poll(std::chrono::milliseconds(0)), 0);
+  EXPECT_EQ(poller.try_poll(std::chrono::milliseconds(0)), 0);
+}
+
+TEST_P(io_poller_backend, busy_poll) {
+  const auto& backend = GetParam();
+  try {
+    core::io::poller(core::io::poller::callback_t{}, backend);
+  } catch (...) {
+    GTEST_SKIP() << "unsupported poller backend";
+  }
+
+  const std::vector<std::byte> kBuffer{std::byte(1)};
+  bound_socket server;
+  core::net::inet::udp::socket client;
+  client.connect(server.sockaddr);
+
+  std::size_t calls = 0;
+  core::io::poller poller(
+      [&calls, &server](core::io::poller&, const core::io::fd&,
+                        core::io::poller::events_t, void*) {
+        std::vector<std::byte> buffer(1);
+        server.socket.receive(buffer);
+        calls += 1;
+      },
+      backend);
+  poller.insert_or_assign(server.socket, core::io::poller::event::kPollIn);
+  EXPECT_ANY_THROW(poller.set_busy_poll({
+      .budget = std::chrono::microseconds(-1),
+      .socket_budget = std::chrono::microseconds(0),
+  }));
+  poller.set_busy_poll({
+      .budget = std::chrono::microseconds(1000),
+      .socket_budget = std::chrono::microseconds(0),
+  });
+
+  std::thread thread([&client, &kBuffer] {
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+    client.send(kBuffer);
+  });
+  EXPECT_EQ(poller.try_poll(std::chrono::milliseconds(100)), 0);
+  thread.join();
+  EXPECT_EQ(calls, 1);
+
+  // NOTE: the budget is exhausted before the timeout so poll() blocks
+  const auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(poller.try_poll(std::chrono::milliseconds(5)), 0);
+  EXPECT_GE(std::chrono::steady_clock::now() - start,
+            std::chrono::milliseconds(5));
+  EXPECT_EQ(calls, 1);
+
+  const auto counters = poller.get_busy_poll_counters();
+  EXPECT_EQ(counters.spin_hits + counters.sleeps, 2);
+  EXPECT_GE(counters.sleeps, 1);
+
+  // NOTE: zero timeout never spins
+  EXPECT_EQ(poller.try_poll(std::chrono::milliseconds(0)), 0);
+  EXPECT_EQ(poller.get_busy_poll_counters().sleeps, counters.sleeps);
+}
+
+TEST_P(io_poller_backend, statistics) {
+  const auto& backend = GetParam();
+  try {
+    core::io::poller(core::io::poller::callback_t{}, backend);
+  } catch (...) {
+    GTEST_SKIP() << "unsupported poller backend";
+  }
+
+  const std::vector<std::byte> kBuffer{std::byte(1)};
+  bound_socket server;
+  core::net::inet::udp::socket client;
+  client.connect(server.sockaddr);
+
+  core::io::poller poller(
+      [&server](core::io::poller&, const core::io::fd&,
+                core::io::poller::events_t, void*) {
+        std::vector<std::byte> buffer(1);
+        server.socket.receive(buffer);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      },
+      backend);
+  poller.insert_or_assign(server.socket, core::io::poller::event::kPollIn,
+                          &server);
+
+  client.send(kBuffer);
+  EXPECT_EQ(poller.poll(), 0);
+  EXPECT_EQ(poller.try_poll(std::chrono::milliseconds(0)), 0);
+
+  const core::io::poller::statistics statistics = poller.get_statistics();
+  if constexpr (!core::io::poller::kInstrumented) {
+    EXPECT_EQ(statistics.wait.count(), 0);
+    EXPECT_EQ(statistics.callback.count(), 0);
+    EXPECT_EQ(statistics.slowest_data, nullptr);
+    return;
+  }
+
+  EXPECT_EQ(statistics.wait.count(), 2);
+  EXPECT_EQ(statistics.iteration.count(), 2);
+  EXPECT_EQ(statistics.events.count(), 2);
+  EXPECT_EQ(statistics.events.max(), 1);
+  EXPECT_EQ(statistics.callback.count(), 1);
+  EXPECT_GE(statistics.callback.min(), 1000000);
+  EXPECT_GE(statistics.iteration.max(), 1000000);
+  EXPECT_GE(statistics.slowest_callback, std::chrono::milliseconds(1));
+  EXPECT_EQ(statistics.slowest_data, &server);
+
+  poller.reset_statistics();
+  EXPECT_EQ(poller.get_statistics().wait.count(), 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(io_poller_backend, io_poller_backend,
+                         ::testing::Values(core::io::poller::backend::kPoll,
+                                           core::io::poller::backend::kEpoll));
+
+}  // namespace tests::io
@@ -0,0 +1,90 @@
+#include "io/shared_fd.hpp"
+
+#include <gtest/gtest.h>
+
+#include <utility>
+
+#include "net/inet/sockaddr.hpp"
+#include "net/inet/udp/socket.hpp"
+
+namespace tests::io {
+
+TEST(io_shared_fd, size) {
+  static_assert(sizeof(core::io::shared_fd<>) == sizeof(void*));
+  static_assert(sizeof(core::io::shared_fd<core::net::inet::udp::socket>) ==
+                sizeof(void*));
+}
+
+TEST(io_shared_fd, copy_shares_descriptor) {
+  core::io::shared_fd<> original{core::io::fd(core::io::fd::kStdin())};
+  EXPECT_EQ(original.use_count(), 1);
+
+  {
+    core::io::shared_fd<> copy(original);
+    EXPECT_EQ(original, copy);
+    EXPECT_EQ(*original, *copy);
+    EXPECT_EQ(original.use_count(), 2);
+
+    core::io::shared_fd<> assigned{core::io::fd(core::io::fd::kStdin())};
+    assigned = copy;
+    EXPECT_EQ(*assigned, *original);
+    EXPECT_EQ(original.use_count(), 3);
+
+    assigned = copy;
+    EXPECT_EQ(original.use_count(), 3);
+  }
+  EXPECT_EQ(original.use_count(), 1);
+  EXPECT_NO_THROW(original->close());
+}
+
+TEST(io_shared_fd, transfer_ownership) {
+  core::io::shared_fd<> moved_from{core::io::fd(core::io::fd::kStdin())};
+  core::io::shared_fd<> moved_to = std::move(moved_from);
+  EXPECT_FALSE(moved_from);
+  EXPECT_TRUE(moved_to);
+  EXPECT_EQ(moved_from.use_count(), 0);
+  EXPECT_EQ(moved_to.use_count(), 1);
+
+  moved_from = std::move(moved_to);
+  EXPECT_TRUE(moved_from);
+  EXPECT_FALSE(moved_to);
+  EXPECT_NO_THROW(moved_from->close());
+}
+
+TEST(io_shared_fd, close_on_last_release) {
+  core::net::inet::sockaddr sockaddr(core::net::inet::ip::kLoopback(),
+                                     core::net::inet::port(0));
+  {
+    core::io::shared_fd<core::net::inet::udp::socket> first{
+        core::net::inet::udp::socket()};
+    first->bind(sockaddr);
+    first->get_bind_sockaddr(sockaddr);
+
+    core::io::shared_fd<core::net::inet::udp::socket> second(first);
+    first = core::io::shared_fd<core::net::inet::udp::socket>{
+        core::net::inet::udp::socket()};
+    EXPECT_NE(*first, *second);
+    EXPECT_EQ(first.use_count(), 1);
+    EXPECT_EQ(second.use_count(), 1);
+
+    core::net::inet::udp::socket socket;
+    EXPECT_EQ(socket.bind(sockaddr),
+              core::net::inet::udp::socket::bind_status::kInUse);
+  }
+  core::net::inet::udp::socket socket;
+  EXPECT_EQ(socket.bind(sockaddr),
+            core::net::inet::udp::socket::bind_status::kSuccess);
+}
+
+TEST(io_shared_fd, duplicate) {
+  core::io::shared_fd<core::net::inet::udp::socket> shared{
+      core::net::inet::udp::socket()};
+  core::net::inet::udp::socket duplicate = shared.duplicate();
+  EXPECT_NE(*shared, duplicate);
+  EXPECT_EQ(shared.use_count(), 1);
+  EXPECT_NO_THROW(shared->set_nonblock(true));
+  EXPECT_NO_THROW(duplicate.close());
+  EXPECT_NO_THROW(shared->close());
+}
+
+}  // namespace tests::io
@@ -0,0 +1,104 @@
+#include "io/splice_pipe.hpp"
+
+#include <gtest/gtest.h>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <array>
+#include <optional>
+#include <vector>
+
+namespace tests::io {
+
+namespace {
+
+std::array<core::io::fd, 2> make_pipe() {
+  std::array<int, 2> pipe;
+  if (::pipe2(pipe.data(), O_NONBLOCK) != 0) {
+    throw std::runtime_error("pipe2() failed");
+  }
+  return {core::io::fd(pipe[0]), core::io::fd(pipe[1])};
+}
+
+}  // namespace
+
+TEST(io_splice_pipe, size) {
+  static_assert(sizeof(core::io::splice_pipe) == 16);
+  static_assert(alignof(core::io::splice_pipe) == 8);
+}
+
+TEST(io_splice_pipe, transfer) {
+  const auto [in_reader, in_writer] = make_pipe();
+  const auto [out_reader, out_writer] = make_pipe();
+
+  core::io::splice_pipe pipe;
+  EXPECT_GT(pipe.get_capacity(), 0);
+  EXPECT_EQ(pipe.transfer(in_reader, out_writer), std::nullopt);
+  EXPECT_EQ(pipe.get_pending(), 0);
+
+  const std::vector<std::byte> kBytes{std::byte(1), std::byte(2),
+                                      std::byte(3)};
+  const std::array<core::io::const_iovec, 1> out{
+      core::io::const_iovec(kBytes)};
+  EXPECT_EQ(in_writer.write(out), kBytes.size());
+
+  EXPECT_EQ(pipe.fill(in_reader, 2), 2);
+  EXPECT_EQ(pipe.get_pending(), 2);
+  EXPECT_EQ(pipe.transfer(in_reader, out_writer), kBytes.size());
+  EXPECT_EQ(pipe.get_pending(), 0);
+
+  std::vector<std::byte> bytes(8);
+  const std::array<core::io::iovec, 1> in{core::io::iovec(bytes)};
+  EXPECT_EQ(out_reader.read(in), kBytes.size());
+  bytes.resize(kBytes.size());
+  EXPECT_EQ(bytes, kBytes);
+}
+
+TEST(io_splice_pipe, end_of_source) {
+  auto [in_reader, in_writer] = make_pipe();
+  const auto [out_reader, out_writer] = make_pipe();
+
+  const std::vector<std::byte> kBytes{std::byte(1), std::byte(2),
+                                      std::byte(3)};
+  const std::array<core::io::const_iovec, 1> out{
+      core::io::const_iovec(kBytes)};
+  EXPECT_EQ(in_writer.write(out), kBytes.size());
+  in_writer.close();
+
+  core::io::splice_pipe pipe;
+  EXPECT_EQ(pipe.transfer(in_reader, out_writer), kBytes.size());
+  EXPECT_EQ(pipe.transfer(in_reader, out_writer), 0);
+  EXPECT_EQ(pipe.fill(in_reader), 0);
+  EXPECT_EQ(pipe.get_pending(), 0);
+}
+
+TEST(io_splice_pipe, tee) {
+  const auto [in_reader, in_writer] = make_pipe();
+  const auto [first_reader, first_writer] = make_pipe();
+  const auto [second_reader, second_writer] = make_pipe();
+
+  const std::vector<std::byte> kBytes{std::byte(1), std::byte(2),
+                                      std::byte(3)};
+  const std::array<core::io::const_iovec, 1> out{
+      core::io::const_iovec(kBytes)};
+  EXPECT_EQ(in_writer.write(out), kBytes.size());
+
+  core::io::splice_pipe first;
+  core::io::splice_pipe second;
+  EXPECT_EQ(first.fill(in_reader), kBytes.size());
+  EXPECT_EQ(first.tee(second), kBytes.size());
+  EXPECT_EQ(first.get_pending(), kBytes.size());
+  EXPECT_EQ(second.get_pending(), kBytes.size());
+  EXPECT_EQ(first.drain(first_writer), kBytes.size());
+  EXPECT_EQ(second.drain(second_writer), kBytes.size());
+
+  for (const core::io::fd& reader : {first_reader, second_reader}) {
+    std::vector<std::byte> bytes(kBytes.size());
+    const std::array<core::io::iovec, 1> in{core::io::iovec(bytes)};
+    EXPECT_EQ(reader.read(in), kBytes.size());
+    EXPECT_EQ(bytes, kBytes);
+  }
+}
+
+}  // namespace tests::io
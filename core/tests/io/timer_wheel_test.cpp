@@ -0,0 +1,144 @@
+#include "io/timer_wheel.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace tests::io {
+
+namespace {
+
+using clock_t = core::io::timer_wheel::clock_t;
+using std::chrono::milliseconds;
+
+}  // namespace
+
+TEST(io_timer_wheel, size) {
+  static_assert(sizeof(core::io::timer_wheel) == 1112);
+  static_assert(alignof(core::io::timer_wheel) == 8);
+}
+
+TEST(io_timer_wheel, move) {
+  core::io::timer_wheel timer_wheel;
+  timer_wheel.schedule(milliseconds(1), core::io::timer_wheel::callback_t{});
+  core::io::timer_wheel moved_to(std::move(timer_wheel));
+  EXPECT_EQ(moved_to.size(), 1);
+}
+
+TEST(io_timer_wheel, schedule_advance) {
+  const clock_t::time_point start = clock_t::now();
+  core::io::timer_wheel timer_wheel(start);
+  EXPECT_TRUE(timer_wheel.empty());
+  EXPECT_EQ(timer_wheel.get_timeout(start), milliseconds(-1));
+
+  std::vector<int> fired;
+  timer_wheel.schedule(start + milliseconds(20),
+                       [&fired] { fired.push_back(20); });
+  timer_wheel.schedule(start + milliseconds(10),
+                       [&fired] { fired.push_back(10); });
+  EXPECT_EQ(timer_wheel.size(), 2);
+  EXPECT_EQ(timer_wheel.get_timeout(start), milliseconds(10));
+
+  EXPECT_EQ(timer_wheel.advance(start + milliseconds(9)), 0);
+  EXPECT_TRUE(fired.empty());
+  EXPECT_EQ(timer_wheel.get_timeout(start + milliseconds(9)), milliseconds(1));
+
+  EXPECT_EQ(timer_wheel.advance(start + milliseconds(10)), 0);
+  EXPECT_EQ(fired, std::vector<int>({10}));
+
+  EXPECT_EQ(timer_wheel.advance(start + milliseconds(100)), 0);
+  EXPECT_EQ(fired, std::vector<int>({10, 20}));
+  EXPECT_TRUE(timer_wheel.empty());
+}
+
+TEST(io_timer_wheel, cascade) {
+  const clock_t::time_point start = clock_t::now();
+  core::io::timer_wheel timer_wheel(start);
+
+  const std::vector<milliseconds> kTimeouts{
+      milliseconds(63),       milliseconds(64),       milliseconds(65),
+      milliseconds(4095),     milliseconds(4096),     milliseconds(262145),
+      milliseconds(16777215), milliseconds(16777216), milliseconds(100000000),
+  };
+
+  std::vector<milliseconds> fired;
+  for (const milliseconds timeout : kTimeouts) {
+    timer_wheel.schedule(start + timeout,
+                         [&fired, timeout] { fired.push_back(timeout); });
+  }
+
+  for (std::size_t i = 0; i < kTimeouts.size(); ++i) {
+    const clock_t::time_point before =
+        start + kTimeouts.at(i) - milliseconds(1);
+    EXPECT_EQ(timer_wheel.advance(before), 0);
+    EXPECT_EQ(fired.size(), i);
+    EXPECT_LE(before + timer_wheel.get_timeout(before),
+              start + kTimeouts.at(i));
+
+    EXPECT_EQ(timer_wheel.advance(start + kTimeouts.at(i)), 0);
+    EXPECT_EQ(fired.size(), i + 1);
+    EXPECT_EQ(fired.back(), kTimeouts.at(i));
+  }
+  EXPECT_TRUE(timer_wheel.empty());
+}
+
+TEST(io_timer_wheel, cancel) {
+  const clock_t::time_point start = clock_t::now();
+  core::io::timer_wheel timer_wheel(start);
+
+  std::size_t calls = 0;
+  const auto first = timer_wheel.schedule(start + milliseconds(10),
+                                          [&calls] { calls += 1; });
+  const auto second = timer_wheel.schedule(start + milliseconds(10000),
+                                           [&calls] { calls += 1; });
+  EXPECT_TRUE(timer_wheel.cancel(first));
+  EXPECT_FALSE(timer_wheel.cancel(first));
+  EXPECT_EQ(timer_wheel.size(), 1);
+
+  EXPECT_EQ(timer_wheel.advance(start + milliseconds(100)), 0);
+  EXPECT_EQ(calls, 0);
+
+  const auto third = timer_wheel.schedule(start + milliseconds(200),
+                                          [&calls] { calls += 1; });
+  EXPECT_NE(first, third);
+  EXPECT_FALSE(timer_wheel.cancel(first));
+  EXPECT_TRUE(timer_wheel.cancel(second));
+  EXPECT_EQ(timer_wheel.advance(start + milliseconds(200)), 0);
+  EXPECT_EQ(calls, 1);
+  EXPECT_FALSE(timer_wheel.cancel(third));
+  EXPECT_TRUE(timer_wheel.empty());
+}
+
+TEST(io_timer_wheel, schedule_cancel_from_callback) {
+  const clock_t::time_point start = clock_t::now();
+  core::io::timer_wheel timer_wheel(start);
+
+  std::size_t calls = 0;
+  core::io::timer_wheel::timer_id_t cancelled = 0;
+  timer_wheel.schedule(start + milliseconds(5), [&] {
+    EXPECT_TRUE(timer_wheel.cancel(cancelled));
+    timer_wheel.schedule(start, [&calls] { calls += 1; });
+    calls += 1;
+  });
+  cancelled = timer_wheel.schedule(start + milliseconds(6),
+                                   [&calls] { calls += 1; });
+
+  EXPECT_EQ(timer_wheel.advance(start + milliseconds(5)), 0);
+  EXPECT_EQ(calls, 1);
+  EXPECT_EQ(timer_wheel.size(), 1);
+  EXPECT_EQ(timer_wheel.advance(start + milliseconds(6)), 0);
+  EXPECT_EQ(calls, 2);
+}
+
+TEST(io_timer_wheel, unhandled) {
+  const clock_t::time_point start = clock_t::now();
+  core::io::timer_wheel timer_wheel(start);
+
+  timer_wheel.schedule(start + milliseconds(1),
+                       [] { throw std::runtime_error("unhandled"); });
+  timer_wheel.schedule(start + milliseconds(2),
+                       [] { throw std::runtime_error("unhandled"); });
+  EXPECT_EQ(timer_wheel.advance(start + milliseconds(2)), 2);
+}
+
+}  // namespace tests::io
@@ -0,0 +1,141 @@
+#include "io/uring.hpp"
+
+#include <gtest/gtest.h>
+
+#include "net/inet/sockaddr.hpp"
+#include "net/inet/tcp/socket.hpp"
+#include "net/inet/udp/socket.hpp"
+
+namespace tests::io {
+
+TEST(io_uring, size) {
+  static_assert(sizeof(core::io::uring) == 144);
+  static_assert(alignof(core::io::uring) == 8);
+}
+
+TEST(io_uring, move) {
+  try {
+    core::io::uring uring(8);
+    core::io::uring moved_to(std::move(uring));
+    EXPECT_EQ(moved_to.get_pending(), 0);
+  } catch (...) {
+    GTEST_SKIP() << "unsupported io_uring";
+  }
+}
+
+TEST(io_uring, accept_connect_send_receive_close) {
+  try {
+    core::io::uring(8);
+  } catch (...) {
+    GTEST_SKIP() << "unsupported io_uring";
+  }
+
+  const std::vector<std::byte> kBuffer{std::byte(1), std::byte(2)};
+  core::net::inet::sockaddr sockaddr(core::net::inet::ip::kLoopback(),
+                                     core::net::inet::port(0));
+
+  core::net::inet::tcp::socket server;
+  server.bind(sockaddr);
+  server.listen(1);
+  server.get_bind_sockaddr(sockaddr);
+
+  core::net::inet::tcp::socket client;
+  core::net::inet::tcp::socket accepted(core::utils::uninitialized_t{});
+
+  core::io::uring uring(8);
+  std::size_t calls = 0;
+  uring.accept(server, accepted,
+               [&calls](core::io::uring&, std::int32_t result) {
+                 EXPECT_GE(result, 0);
+                 calls += 1;
+               });
+  uring.connect(client, sockaddr,
+                [&calls](core::io::uring&, std::int32_t result) {
+                  EXPECT_EQ(result, 0);
+                  calls += 1;
+                });
+  EXPECT_EQ(uring.get_pending(), 2);
+  while (uring.get_pending() > 0) {
+    EXPECT_EQ(uring.try_run(std::chrono::milliseconds(1000)), 0);
+  }
+  EXPECT_EQ(calls, 2);
+
+  std::vector<std::byte> received(kBuffer.size());
+  uring.send(client, kBuffer,
+             [&kBuffer, &calls](core::io::uring&, std::int32_t result) {
+               EXPECT_EQ(result, kBuffer.size());
+               calls += 1;
+             });
+  uring.receive(accepted, received,
+                [&kBuffer, &calls](core::io::uring&, std::int32_t result) {
+                  EXPECT_EQ(result, kBuffer.size());
+                  calls += 1;
+                });
+  while (uring.get_pending() > 0) {
+    EXPECT_EQ(uring.try_run(std::chrono::milliseconds(1000)), 0);
+  }
+  EXPECT_EQ(calls, 4);
+  EXPECT_EQ(received, kBuffer);
+
+  uring.close(std::move(accepted),
+              [&calls](core::io::uring&, std::int32_t result) {
+                EXPECT_EQ(result, 0);
+                calls += 1;
+              });
+  EXPECT_EQ(uring.run(), 0);
+  EXPECT_EQ(calls, 5);
+}
+
+TEST(io_uring, error) {
+  try {
+    core::io::uring(8);
+  } catch (...) {
+    GTEST_SKIP() << "unsupported io_uring";
+  }
+
+  const std::vector<std::byte> kBuffer{std::byte(1)};
+  core::net::inet::tcp::socket socket;
+
+  core::io::uring uring(8);
+  uring.send(socket, kBuffer, [](core::io::uring&, std::int32_t result) {
+    EXPECT_EQ(result, -EPIPE);
+  });
+  EXPECT_EQ(uring.run(), 0);
+  EXPECT_EQ(uring.get_pending(), 0);
+}
+
+TEST(io_uring, unhandled) {
+  try {
+    core::io::uring(8);
+  } catch (...) {
+    GTEST_SKIP() << "unsupported io_uring";
+  }
+
+  const std::vector<std::byte> kBuffer{std::byte(1)};
+  core::net::inet::tcp::socket socket;
+
+  core::io::uring uring(8);
+  uring.send(socket, kBuffer, [](core::io::uring&, std::int32_t) {
+    throw std::runtime_error("unhandled");
+  });
+  EXPECT_EQ(uring.run(), 1);
+}
+
+TEST(io_uring, overflow) {
+  try {
+    core::io::uring(1);
+  } catch (...) {
+    GTEST_SKIP() << "unsupported io_uring";
+  }
+
+  core::net::inet::udp::socket socket;
+  std::vector<std::byte> buffer(1);
+  core::io::uring uring(1);
+  uring.receive(socket, buffer, core::io::uring::callback_t{});
+  uring.receive(socket, buffer, core::io::uring::callback_t{});
+  EXPECT_ANY_THROW(
+      uring.receive(socket, buffer, core::io::uring::callback_t{}));
+  EXPECT_EQ(uring.get_pending(), 2);
+}
+
+}  // namespace tests::io
@@ -0,0 +1,65 @@
+#include "net/inet/cidr.hpp"
+
+#include <gtest/gtest.h>
+
+#include <format>
+
+namespace tests::net::inet {
+
+TEST(net_inet_cidr, size) {
+  static_assert(sizeof(core::net::inet::cidr) == 8);
+  static_assert(alignof(core::net::inet::cidr) == 4);
+}
+
+TEST(net_inet_cidr, construction) {
+  const core::net::inet::cidr cidr(core::net::inet::ip("10.1.2.3"), 8);
+  EXPECT_EQ(cidr.get_ip(), core::net::inet::ip("10.0.0.0"));
+  EXPECT_EQ(cidr.get_prefix_length(), 8);
+  EXPECT_EQ(cidr, core::net::inet::cidr("10.0.0.0/8"));
+  EXPECT_ANY_THROW(core::net::inet::cidr(core::net::inet::ip::kAny(), 33));
+}
+
+TEST(net_inet_cidr, parse) {
+  static_assert(core::net::inet::cidr::parse("192.168.0.0/16"));
+  static_assert(core::net::inet::cidr::parse("0.0.0.0/0"));
+  static_assert(core::net::inet::cidr::parse("1.2.3.4/32"));
+  static_assert(!core::net::inet::cidr::parse("1.2.3.4"));
+  static_assert(!core::net::inet::cidr::parse("1.2.3.4/"));
+  static_assert(!core::net::inet::cidr::parse("1.2.3.4/33"));
+  static_assert(!core::net::inet::cidr::parse("1.2.3.4/08"));
+  static_assert(!core::net::inet::cidr::parse("1.2.3.4/8a"));
+  static_assert(!core::net::inet::cidr::parse("1.2.3/8"));
+  EXPECT_ANY_THROW(core::net::inet::cidr("1.2.3.4/-1"));
+}
+
+TEST(net_inet_cidr, contains) {
+  const core::net::inet::cidr cidr("172.16.0.0/12");
+  EXPECT_TRUE(cidr.contains(core::net::inet::ip("172.16.0.1")));
+  EXPECT_TRUE(cidr.contains(core::net::inet::ip("172.31.255.255")));
+  EXPECT_FALSE(cidr.contains(core::net::inet::ip("172.32.0.0")));
+  EXPECT_TRUE(core::net::inet::cidr("0.0.0.0/0")
+                  .contains(core::net::inet::ip::kBroadcast()));
+}
+
+TEST(net_inet_cidr, to_string) {
+  EXPECT_EQ(core::net::inet::cidr("10.20.30.40/29").to_string(),
+            "10.20.30.40/29");
+  EXPECT_EQ(core::net::inet::cidr("10.20.30.47/29").to_string(),
+            "10.20.30.40/29");
+  EXPECT_EQ(core::net::inet::cidr("0.0.0.0/0").to_string(), "0.0.0.0/0");
+}
+
+TEST(net_inet_cidr, format) {
+  const core::net::inet::cidr cidr("192.168.0.0/16");
+  EXPECT_EQ(std::format("{}", cidr), cidr.to_string());
+}
+
+TEST(net_inet_cidr, hash) {
+  const std::hash<core::net::inet::cidr> hash;
+  EXPECT_EQ(hash(core::net::inet::cidr("10.0.0.0/8")),
+            hash(core::net::inet::cidr("10.1.0.0/8")));
+  EXPECT_NE(hash(core::net::inet::cidr("10.0.0.0/8")),
+            hash(core::net::inet::cidr("10.0.0.0/9")));
+}
+
+}  // namespace tests::net::inet
@@ -2,6 +2,14 @@
 
 #include <gtest/gtest.h>
 
+#include <arpa/inet.h>
+
+#include <array>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
 namespace tests::net::inet {
 
 TEST(net_inet_ip, size) {
@@ -59,6 +67,89 @@ TEST(net_inet_ip, invalid) {
   EXPECT_ANY_THROW(core::net::inet::ip("11132123123abc"));
 }
 
+TEST(net_inet_ip, parse) {
+  static_assert(core::net::inet::ip::parse("1.2.3.4") ==
+                core::net::inet::ip(0x01020304));
+  static_assert(core::net::inet::ip::parse("255.255.255.255") ==
+                core::net::inet::ip(0xFFFFFFFF));
+  static_assert(!core::net::inet::ip::parse("1.2.3"));
+  static_assert(!core::net::inet::ip::parse("1.2.3.4."));
+  static_assert(!core::net::inet::ip::parse("1.2.3.04"));
+  static_assert(!core::net::inet::ip::parse("1.2.3.1000"));
+  static_assert(!core::net::inet::ip::parse("1..2.3"));
+  static_assert(!core::net::inet::ip::parse(" 1.2.3.4"));
+
+  // NOTE: the string view does not have to be null terminated
+  const std::string_view string("10.0.0.1234");
+  EXPECT_EQ(core::net::inet::ip::parse(string.substr(0, 8)),
+            core::net::inet::ip(0x0A000001));
+  EXPECT_EQ(core::net::inet::ip(string.substr(0, 9)),
+            core::net::inet::ip(0x0A00000C));
+}
+
+TEST(net_inet_ip, parse_matches_inet_pton) {
+  std::mt19937 random(0);
+  std::uniform_int_distribution<int> distribution(0, 12);
+  constexpr std::string_view kAlphabet("0123456789.");
+
+  for (std::size_t i = 0; i < 100000; ++i) {
+    std::string string;
+    const std::size_t size = distribution(random) + 3;
+    for (std::size_t j = 0; j < size; ++j) {
+      string.push_back(kAlphabet[distribution(random) % kAlphabet.size()]);
+    }
+
+    std::uint32_t bytes = 0;
+    const bool valid = ::inet_pton(AF_INET, string.c_str(), &bytes) == 1;
+    const std::optional<core::net::inet::ip> ip =
+        core::net::inet::ip::parse(string);
+    ASSERT_EQ(ip.has_value(), valid) << string;
+    if (valid) {
+      EXPECT_EQ(ip->get_bytes(core::net::inet::ip::network_byte_order_t{}),
+                bytes);
+    }
+  }
+}
+
+TEST(net_inet_ip, parse_lines) {
+  std::mt19937 random(0);
+  std::string lines;
+  std::vector<core::net::inet::ip> expected;
+  for (std::size_t i = 0; i < 1000; ++i) {
+    const core::net::inet::ip ip(static_cast<std::uint32_t>(
+        random() >> (random() % 32)));
+    expected.push_back(ip);
+    lines.append(ip.to_string());
+    lines.push_back('\n');
+  }
+  // NOTE: the last address is not followed by a newline and is read from
+  // the tail shorter than a vector register
+  lines.append("1.2.3.4");
+  expected.push_back(core::net::inet::ip(0x01020304));
+
+  std::vector<core::net::inet::ip> ips;
+  core::net::inet::ip::parse_lines(lines, ips);
+  EXPECT_EQ(ips, expected);
+}
+
+TEST(net_inet_ip, parse_lines_invalid) {
+  std::vector<core::net::inet::ip> ips;
+  EXPECT_NO_THROW(core::net::inet::ip::parse_lines("\n1.1.1.1\n\n", ips));
+  EXPECT_EQ(ips.size(), 1);
+
+  constexpr std::array<std::string_view, 9> kInvalid{
+      "1.2.3.4.5\n",         "1.2.3\n",     "01.2.3.4\n",
+      "256.255.255.255\n",   "1.2.3.4 \n",  "1234.2.3.4\n",
+      "1.2.3.4.\n1.1.1.1\n", "1..3.4\n",    "255.255.255.2555\n"};
+  for (const std::string_view invalid : kInvalid) {
+    EXPECT_ANY_THROW(core::net::inet::ip::parse_lines(invalid, ips))
+        << invalid;
+    EXPECT_ANY_THROW(core::net::inet::ip::parse_lines(
+        std::string(invalid) + std::string(32, '\n'), ips))
+        << invalid;
+  }
+}
+
 TEST(net_inet_ip, to_string) {
   EXPECT_EQ(core::net::inet::ip("255.255.255.0").to_string(), "255.255.255.0");
   EXPECT_EQ(core::net::inet::ip("255.255.255.0").to_string(), "255.255.255.0");
@@ -69,4 +160,49 @@ TEST(net_inet_ip, format) {
   EXPECT_EQ(std::format("{}", ip), ip.to_string());
 }
 
+TEST(net_inet_ip, format_to) {
+  constexpr auto kFormatted = [] {
+    std::array<char, core::net::inet::ip::kMaxStringSize> buffer{};
+    core::net::inet::ip(0xC0A8000A).format_to(buffer.data());
+    return buffer;
+  }();
+  EXPECT_EQ(std::string_view(kFormatted.data()), "192.168.0.10");
+
+  std::array<char, core::net::inet::ip::kMaxStringSize> buffer{};
+  const char* end = core::net::inet::ip::kBroadcast().format_to(buffer.data());
+  EXPECT_EQ(std::string_view(buffer.data(), end), "255.255.255.255");
+}
+
+TEST(net_inet_ip, hash) {
+  const std::hash<core::net::inet::ip> hash;
+  EXPECT_EQ(hash(core::net::inet::ip("10.0.0.1")),
+            hash(core::net::inet::ip(0x0A000001)));
+  EXPECT_NE(hash(core::net::inet::ip("10.0.0.1")),
+            hash(core::net::inet::ip("10.0.0.2")));
+}
+
+TEST(net_inet_ip, classification) {
+  static_assert(core::net::inet::ip(0).is_any());
+  static_assert(core::net::inet::ip(0xFFFFFFFF).is_broadcast());
+  static_assert(core::net::inet::ip::parse("127.0.0.1")->is_loopback());
+  static_assert(core::net::inet::ip::parse("127.255.0.1")->is_loopback());
+  static_assert(!core::net::inet::ip::parse("128.0.0.1")->is_loopback());
+  static_assert(core::net::inet::ip::parse("10.20.30.40")->is_private());
+  static_assert(core::net::inet::ip::parse("172.16.0.1")->is_private());
+  static_assert(core::net::inet::ip::parse("172.31.255.255")->is_private());
+  static_assert(!core::net::inet::ip::parse("172.32.0.1")->is_private());
+  static_assert(core::net::inet::ip::parse("192.168.1.1")->is_private());
+  static_assert(!core::net::inet::ip::parse("192.169.1.1")->is_private());
+  static_assert(core::net::inet::ip::parse("169.254.1.1")->is_link_local());
+  static_assert(!core::net::inet::ip::parse("169.253.1.1")->is_link_local());
+  static_assert(core::net::inet::ip::parse("224.0.0.1")->is_multicast());
+  static_assert(core::net::inet::ip::parse("239.1.2.3")->is_multicast());
+  static_assert(!core::net::inet::ip::parse("240.0.0.1")->is_multicast());
+
+  EXPECT_TRUE(core::net::inet::ip::kAny().is_any());
+  EXPECT_TRUE(core::net::inet::ip::kLoopback().is_loopback());
+  EXPECT_TRUE(core::net::inet::ip::kBroadcast().is_broadcast());
+  EXPECT_FALSE(core::net::inet::ip::kNonRoutable().is_private());
+}
+
 }  // namespace tests::net::inet
@@ -0,0 +1,123 @@
+#include "net/inet/lpm_table.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace tests::net::inet {
+
+namespace {
+
+// NOTE: the reference longest prefix match
+std::optional<std::uint32_t> scan(
+    const std::vector<std::pair<core::net::inet::cidr, std::uint32_t>>& rules,
+    const core::net::inet::ip& ip) {
+  std::optional<std::pair<std::size_t, std::uint32_t>> best;
+  for (const auto& [cidr, value] : rules) {
+    if (cidr.contains(ip) &&
+        (!best || cidr.get_prefix_length() >= best->first)) {
+      best.emplace(cidr.get_prefix_length(), value);
+    }
+  }
+  return best ? std::optional(best->second) : std::nullopt;
+}
+
+}  // namespace
+
+TEST(net_inet_lpm_table, smoke) {
+  core::net::inet::lpm_table table;
+  EXPECT_TRUE(table.empty());
+  EXPECT_EQ(table.lookup(core::net::inet::ip("10.0.0.1")), std::nullopt);
+
+  table.insert(core::net::inet::cidr("10.0.0.0/8"), 1);
+  table.insert(core::net::inet::cidr("10.1.0.0/16"), 2);
+  table.insert(core::net::inet::cidr("10.1.2.0/24"), 3);
+  table.insert(core::net::inet::cidr("10.1.2.3/32"), 4);
+  table.insert(core::net::inet::cidr("0.0.0.0/0"), 0);
+  EXPECT_EQ(table.size(), 5);
+
+  EXPECT_EQ(table.lookup(core::net::inet::ip("11.0.0.1")), 0);
+  EXPECT_EQ(table.lookup(core::net::inet::ip("10.0.0.1")), 1);
+  EXPECT_EQ(table.lookup(core::net::inet::ip("10.1.0.1")), 2);
+  EXPECT_EQ(table.lookup(core::net::inet::ip("10.1.2.1")), 3);
+  EXPECT_EQ(table.lookup(core::net::inet::ip("10.1.2.3")), 4);
+
+  EXPECT_TRUE(table.erase(core::net::inet::cidr("10.1.0.0/16")));
+  EXPECT_FALSE(table.erase(core::net::inet::cidr("10.1.0.0/16")));
+  EXPECT_EQ(table.lookup(core::net::inet::ip("10.1.0.1")), 1);
+  EXPECT_EQ(table.lookup(core::net::inet::ip("10.1.2.1")), 3);
+
+  table.insert(core::net::inet::cidr("10.1.2.0/24"), 5);
+  EXPECT_EQ(table.lookup(core::net::inet::ip("10.1.2.1")), 5);
+  EXPECT_EQ(table.lookup(core::net::inet::ip("10.1.2.3")), 4);
+
+  table.clear();
+  EXPECT_TRUE(table.empty());
+  EXPECT_EQ(table.lookup(core::net::inet::ip("10.1.2.3")), std::nullopt);
+}
+
+TEST(net_inet_lpm_table, matches_scan) {
+  std::mt19937 random(0);
+  // NOTE: the rules are clustered under a few prefixes to get them nested
+  constexpr std::array<std::uint32_t, 3> kBases{0x0A000000, 0x0A010000,
+                                                0xC0A80000};
+  std::vector<std::pair<core::net::inet::cidr, std::uint32_t>> rules;
+  for (std::uint32_t i = 0; i < 2000; ++i) {
+    const std::uint32_t bytes =
+        kBases[random() % kBases.size()] | (random() & 0x0003FFFF);
+    rules.emplace_back(
+        core::net::inet::cidr(core::net::inet::ip(bytes), random() % 33), i);
+  }
+  // NOTE: the duplicates keep the last value in both the table and the scan
+  std::vector<std::pair<core::net::inet::cidr, std::uint32_t>> unique;
+  for (const auto& rule : rules) {
+    std::erase_if(unique, [&rule](const auto& that) {
+      return that.first == rule.first;
+    });
+    unique.push_back(rule);
+  }
+
+  core::net::inet::lpm_table table;
+  table.insert(rules);
+  EXPECT_EQ(table.size(), unique.size());
+
+  const auto check = [&] {
+    std::vector<core::net::inet::ip> ips;
+    for (std::size_t i = 0; i < 2000; ++i) {
+      ips.emplace_back(kBases[random() % kBases.size()] |
+                       (random() & 0x0003FFFF));
+      ips.emplace_back(static_cast<std::uint32_t>(random()));
+    }
+    std::vector<std::uint32_t> values(ips.size());
+    constexpr std::uint32_t kMiss = 0xFFFFFFFF;
+    table.lookup(ips, values, kMiss);
+    for (std::size_t i = 0; i < ips.size(); ++i) {
+      const std::optional<std::uint32_t> expected = scan(unique, ips[i]);
+      ASSERT_EQ(table.lookup(ips[i]), expected) << ips[i].to_string();
+      ASSERT_EQ(values[i], expected.value_or(kMiss)) << ips[i].to_string();
+    }
+  };
+  check();
+
+  std::shuffle(unique.begin(), unique.end(), random);
+  for (std::size_t i = unique.size() / 2; i > 0; --i) {
+    EXPECT_TRUE(table.erase(unique.back().first));
+    unique.pop_back();
+  }
+  EXPECT_EQ(table.size(), unique.size());
+  check();
+}
+
+TEST(net_inet_lpm_table, lookup_size_mismatch) {
+  core::net::inet::lpm_table table;
+  const std::array<core::net::inet::ip, 2> ips{
+      core::net::inet::ip::kAny(), core::net::inet::ip::kBroadcast()};
+  std::array<std::uint32_t, 1> values{};
+  EXPECT_ANY_THROW(table.lookup(ips, values, 0));
+}
+
+}  // namespace tests::net::inet
@@ -21,4 +21,10 @@ TEST(net_inet_port, construction) {
       core::net::inet::port(0, core::net::inet::port::network_byte_order_t{}));
 }
 
+TEST(net_inet_port, hash) {
+  const std::hash<core::net::inet::port> hash;
+  EXPECT_EQ(hash(core::net::inet::port(80)), hash(core::net::inet::port(80)));
+  EXPECT_NE(hash(core::net::inet::port(80)), hash(core::net::inet::port(81)));
+}
+
 }  // namespace tests::net::inet
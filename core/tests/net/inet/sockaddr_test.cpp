@@ -5,8 +5,8 @@
 namespace tests::net::inet {
 
 TEST(net_inet_sockaddr, size) {
-  static_assert(sizeof(core::net::inet::sockaddr) == 16);
-  static_assert(alignof(core::net::inet::sockaddr) == 8);
+  static_assert(sizeof(core::net::inet::sockaddr) == 20);
+  static_assert(alignof(core::net::inet::sockaddr) == 4);
 }
 
 TEST(net_inet_sockaddr, equality) {
@@ -2,17 +2,55 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
+#include <chrono>
 #include <thread>
 
+#include "io/poller.hpp"
 #include "net/inet/sockaddr.hpp"
 
 namespace tests::net::inet::tcp {
 
 TEST(net_inet_tcp_socket, size) {
-  static_assert(sizeof(core::net::inet::tcp::socket) == 4);
+  static_assert(sizeof(core::net::inet::tcp::socket) == 8);
   static_assert(alignof(core::net::inet::tcp::socket) == 4);
 }
 
+TEST(net_inet_tcp_socket, creation_flags) {
+  core::net::inet::tcp::socket blocking;
+  EXPECT_FALSE(blocking.get_nonblock());
+  EXPECT_FALSE(blocking.get_cloexec());
+
+  core::net::inet::tcp::socket server(core::net::sockets::kNonblock |
+                                      core::net::sockets::kCloexec);
+  EXPECT_TRUE(server.get_nonblock());
+  EXPECT_TRUE(server.get_cloexec());
+
+  core::net::inet::sockaddr sockaddr(core::net::inet::ip::kLoopback(),
+                                     core::net::inet::port(0));
+  server.bind(sockaddr);
+  server.listen(1);
+  core::net::inet::tcp::socket accepted(core::utils::uninitialized_t{});
+  EXPECT_EQ(server.accept(accepted),
+            core::net::inet::tcp::socket::accept_status::kEmptyQueue);
+
+  // NOTE: dup() shares O_NONBLOCK but not FD_CLOEXEC
+  core::net::inet::tcp::socket copy(server);
+  EXPECT_TRUE(copy.get_nonblock());
+  EXPECT_FALSE(copy.get_cloexec());
+  copy.set_cloexec(true);
+  EXPECT_TRUE(copy.get_cloexec());
+
+  server.set_nonblock(false);
+  EXPECT_FALSE(server.get_nonblock());
+  server.set_cloexec(false);
+  EXPECT_FALSE(server.get_cloexec());
+
+  core::net::inet::tcp::socket moved(std::move(server));
+  EXPECT_FALSE(moved.get_nonblock());
+  EXPECT_FALSE(moved.get_cloexec());
+}
+
 TEST(net_inet_tcp_socket, blocking_send_receive_error) {
   core::net::inet::tcp::socket socket;
   socket.set_nonblock(true);
@@ -168,4 +206,110 @@ TEST(net_inet_tcp_socket, nonblocking_echo_handshake) {
   EXPECT_EQ(buffer, kBuffer);
 }
 
+TEST(net_inet_tcp_socket, accept_many) {
+  constexpr std::size_t kClients = 5;
+
+  core::net::inet::sockaddr sockaddr(core::net::inet::ip::kLoopback(),
+                                     core::net::inet::port(0));
+
+  core::net::inet::tcp::socket server;
+  server.set_nonblock(true);
+  server.bind(sockaddr);
+  server.get_bind_sockaddr(sockaddr);
+  server.listen(kClients);
+
+  std::vector<core::net::inet::tcp::socket> sockets(
+      kClients - 1,
+      core::net::inet::tcp::socket(core::utils::uninitialized_t{}));
+  std::vector<core::net::inet::sockaddr> peers(
+      kClients, core::net::inet::sockaddr(core::net::inet::ip::kNonRoutable(),
+                                          core::net::inet::port(0)));
+  EXPECT_EQ(server.accept_many(std::span(sockets)), 0);
+  EXPECT_ANY_THROW(
+      server.accept_many(std::span(sockets), std::span(peers).first(1)));
+
+  std::vector<core::net::inet::tcp::socket> clients(kClients);
+  for (auto& client : clients) {
+    EXPECT_EQ(client.connect(sockaddr),
+              core::net::inet::tcp::socket::connection_status::kSuccess);
+  }
+
+  std::size_t accepted =
+      server.accept_many(std::span(sockets), std::span(peers));
+  EXPECT_EQ(accepted, kClients - 1);
+  for (std::size_t i = 0; i < accepted; ++i) {
+    EXPECT_TRUE(sockets[i].get_nonblock());
+    core::net::inet::sockaddr connected(core::net::inet::ip::kNonRoutable(),
+                                        core::net::inet::port(0));
+    sockets[i].get_connect_sockaddr(connected);
+    EXPECT_EQ(peers[i], connected);
+  }
+
+  accepted = server.accept_many(std::span(sockets).first(1));
+  EXPECT_EQ(accepted, 1);
+  EXPECT_EQ(server.accept_many(std::span(sockets)), 0);
+}
+
+TEST(net_inet_tcp_socket, zerocopy_send) {
+  constexpr std::size_t kSends = 4;
+
+  core::net::inet::sockaddr sockaddr(core::net::inet::ip::kLoopback(),
+                                     core::net::inet::port(0));
+
+  core::net::inet::tcp::socket server;
+  server.bind(sockaddr);
+  server.get_bind_sockaddr(sockaddr);
+  server.listen(1);
+
+  core::net::inet::tcp::socket client;
+  try {
+    client.set_zerocopy(true);
+  } catch (...) {
+    GTEST_SKIP() << "SO_ZEROCOPY is not supported";
+  }
+  EXPECT_TRUE(client.get_zerocopy());
+  EXPECT_EQ(client.connect(sockaddr),
+            core::net::inet::tcp::socket::connection_status::kSuccess);
+
+  core::net::inet::tcp::socket peer(core::utils::uninitialized_t{});
+  EXPECT_EQ(server.accept(peer),
+            core::net::inet::tcp::socket::accept_status::kSuccess);
+  peer.set_nonblock(true);
+
+  std::size_t completed = 0;
+  core::io::poller poller(
+      [&client, &completed](core::io::poller&, const core::io::fd&,
+                            core::io::poller::events_t events, void*) {
+        if (!(events & core::io::poller::event::kPollErr)) {
+          return;
+        }
+        std::array<core::net::inet::tcp::socket::zerocopy_completion, 8>
+            completions;
+        const std::size_t received =
+            client.receive_zerocopy_completions(completions);
+        for (std::size_t i = 0; i < received; ++i) {
+          EXPECT_EQ(completions[i].first, completed);
+          completed = completions[i].last + 1;
+        }
+      });
+  poller.insert_or_assign(client, core::io::poller::event::kPollErr);
+
+  const std::vector<std::byte> buffer(65536, std::byte(1));
+  std::size_t sent = 0;
+  for (std::size_t i = 0; i < kSends; ++i) {
+    const std::size_t bytes = client.send_zerocopy(buffer);
+    EXPECT_GT(bytes, 0);
+    sent += bytes;
+  }
+
+  std::size_t received = 0;
+  std::vector<std::byte> bytes(65536);
+  while (received < sent || completed < kSends) {
+    received += peer.receive(bytes);
+    poller.try_poll(std::chrono::milliseconds(1));
+  }
+  EXPECT_EQ(received, sent);
+  EXPECT_EQ(completed, kSends);
+}
+
 }  // namespace tests::net::inet::tcp
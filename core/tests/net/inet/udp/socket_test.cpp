@@ -5,11 +5,13 @@
 #include <thread>
 
 #include "net/inet/sockaddr.hpp"
+#include "net/sockets/message_batch.hpp"
+#include "net/udp/segments.hpp"
 
 namespace tests::net::inet::udp {
 
 TEST(net_inet_udp_socket, size) {
-  static_assert(sizeof(core::net::inet::udp::socket) == 4);
+  static_assert(sizeof(core::net::inet::udp::socket) == 8);
   static_assert(alignof(core::net::inet::udp::socket) == 4);
 }
 
@@ -161,4 +163,114 @@ TEST(net_inet_udp_socket, nonblocking_echo_handshake) {
   EXPECT_EQ(buffer, kBuffer);
 }
 
+TEST(net_inet_udp_socket, batched_send_receive) {
+#ifndef __linux__
+  GTEST_SKIP() << "sendmmsg() is not supported";
+#endif
+  constexpr std::size_t kMessages = 8;
+
+  core::net::inet::sockaddr server_sockaddr(core::net::inet::ip::kLoopback(),
+                                            core::net::inet::port(0));
+  core::net::inet::sockaddr client_sockaddr(core::net::inet::ip::kLoopback(),
+                                            core::net::inet::port(0));
+
+  core::net::inet::udp::socket server;
+  server.set_nonblock(true);
+  server.bind(server_sockaddr);
+  server.get_bind_sockaddr(server_sockaddr);
+
+  core::net::inet::udp::socket client;
+  client.set_nonblock(true);
+  client.bind(client_sockaddr);
+  client.get_bind_sockaddr(client_sockaddr);
+
+  std::vector<std::vector<std::byte>> payloads;
+  core::net::sockets::message_batch out(kMessages);
+  for (std::size_t i = 0; i < kMessages; ++i) {
+    payloads.emplace_back(i + 1, std::byte(i));
+  }
+  for (const auto& payload : payloads) {
+    out.push(payload, server_sockaddr);
+  }
+  EXPECT_EQ(client.send_many(out), kMessages);
+  for (std::size_t i = 0; i < kMessages; ++i) {
+    EXPECT_EQ(out.get_length(i), i + 1);
+  }
+  EXPECT_EQ(client.send_many(out, kMessages), 0);
+
+  std::vector<std::byte> buffer(kMessages * 16);
+  core::net::sockets::message_batch in(kMessages);
+  for (std::size_t i = 0; i < kMessages; ++i) {
+    in.push(std::span(buffer).subspan(i * 16, 16));
+  }
+
+  std::size_t received = 0;
+  core::net::inet::sockaddr peer(core::net::inet::ip::kNonRoutable(),
+                                 core::net::inet::port(0));
+  while (received < kMessages) {
+    const std::size_t batch = server.receive_many(in);
+    for (std::size_t i = 0; i < batch; ++i, ++received) {
+      EXPECT_EQ(std::vector(in.get_bytes(i).begin(), in.get_bytes(i).end()),
+                payloads[received]);
+      in.get_sockaddr(i, peer);
+      EXPECT_EQ(peer, client_sockaddr);
+    }
+  }
+  EXPECT_EQ(server.receive_many(in), 0);
+}
+
+TEST(net_inet_udp_socket, segmentation_offload) {
+  constexpr std::size_t kSegmentSize = 100;
+  constexpr std::size_t kSegments = 10;
+
+  core::net::inet::sockaddr sockaddr(core::net::inet::ip::kLoopback(),
+                                     core::net::inet::port(0));
+
+  core::net::inet::udp::socket server;
+  server.set_nonblock(true);
+  try {
+    server.set_gro(true);
+  } catch (...) {
+    GTEST_SKIP() << "UDP_GRO is not supported";
+  }
+  EXPECT_TRUE(server.get_gro());
+  server.bind(sockaddr);
+  server.get_bind_sockaddr(sockaddr);
+
+  core::net::inet::udp::socket client;
+  client.connect(sockaddr);
+
+  std::vector<std::byte> bytes(kSegmentSize * kSegments - 1);
+  for (std::size_t i = 0; i < bytes.size(); ++i) {
+    bytes[i] = std::byte(i / kSegmentSize);
+  }
+  try {
+    ASSERT_EQ(client.send_segmented(bytes, kSegmentSize), bytes.size());
+  } catch (...) {
+    GTEST_SKIP() << "UDP_SEGMENT is not supported";
+  }
+  EXPECT_ANY_THROW(client.send_segmented(bytes, 0));
+
+  // NOTE: the datagrams may or may not be coalesced on the receiving side
+  std::size_t received = 0;
+  std::size_t datagrams = 0;
+  std::vector<std::byte> buffer(65536);
+  while (received < bytes.size()) {
+    std::size_t segment_size = 0;
+    const std::size_t length = server.receive_segmented(buffer, segment_size);
+    if (length == 0) {
+      continue;
+    }
+    for (const auto segment : core::net::udp::segments(
+             std::span(buffer).first(length), segment_size)) {
+      EXPECT_EQ(segment.front(), std::byte(datagrams));
+      EXPECT_EQ(segment.size(),
+                datagrams + 1 == kSegments ? kSegmentSize - 1 : kSegmentSize);
+      datagrams += 1;
+    }
+    received += length;
+  }
+  EXPECT_EQ(datagrams, kSegments);
+}
+
 }  // namespace tests::net::inet::udp
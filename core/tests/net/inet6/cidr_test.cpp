@@ -0,0 +1,42 @@
+#include "net/inet6/cidr.hpp"
+
+#include <gtest/gtest.h>
+
+namespace tests::net::inet6 {
+
+TEST(net_inet6_cidr, size) {
+  static_assert(sizeof(core::net::inet6::cidr) == 17);
+  static_assert(alignof(core::net::inet6::cidr) == 1);
+}
+
+TEST(net_inet6_cidr, construction) {
+  const core::net::inet6::cidr cidr(core::net::inet6::ip("2001:db8:ffff::1"),
+                                    33);
+  EXPECT_EQ(cidr.get_ip(), core::net::inet6::ip("2001:db8:8000::"));
+  EXPECT_EQ(cidr.get_prefix_length(), 33);
+  EXPECT_ANY_THROW(core::net::inet6::cidr(core::net::inet6::ip::kAny(), 129));
+}
+
+TEST(net_inet6_cidr, parse) {
+  static_assert(core::net::inet6::cidr::parse("::/0"));
+  static_assert(core::net::inet6::cidr::parse("2001:db8::/32"));
+  static_assert(core::net::inet6::cidr::parse("::1/128"));
+  static_assert(!core::net::inet6::cidr::parse("::1/129"));
+  static_assert(!core::net::inet6::cidr::parse("2001:db8::"));
+}
+
+TEST(net_inet6_cidr, contains) {
+  const core::net::inet6::cidr cidr("fe80::/10");
+  EXPECT_TRUE(cidr.contains(core::net::inet6::ip("fe80::1")));
+  EXPECT_TRUE(cidr.contains(core::net::inet6::ip("febf::1")));
+  EXPECT_FALSE(cidr.contains(core::net::inet6::ip("fec0::1")));
+}
+
+TEST(net_inet6_cidr, to_string) {
+  EXPECT_EQ(core::net::inet6::cidr("2001:db8::1/64").to_string(),
+            "2001:db8::/64");
+  EXPECT_EQ(core::net::inet6::cidr("::ffff:10.0.0.1/104").to_string(),
+            "::ffff:10.0.0.0/104");
+}
+
+}  // namespace tests::net::inet6
@@ -2,6 +2,13 @@
 
 #include <gtest/gtest.h>
 
+#include <arpa/inet.h>
+
+#include <array>
+#include <random>
+#include <string>
+#include <string_view>
+
 namespace tests::net::inet6 {
 
 TEST(net_inet6_ip, size) {
@@ -53,9 +60,121 @@ TEST(net_inet6_ip, to_string) {
   EXPECT_EQ(core::net::inet6::ip("2001:db8::1").to_string(), "2001:db8::1");
 }
 
+TEST(net_inet6_ip, parse) {
+  static_assert(core::net::inet6::ip::parse("::1"));
+  static_assert(core::net::inet6::ip::parse("1:2:3:4:5:6:7::"));
+  static_assert(core::net::inet6::ip::parse("::FFFF:192.0.2.1"));
+  static_assert(core::net::inet6::ip::parse("1:2:3:4:5:6:1.2.3.4"));
+  static_assert(!core::net::inet6::ip::parse(":1"));
+  static_assert(!core::net::inet6::ip::parse("1:"));
+  static_assert(!core::net::inet6::ip::parse(":::"));
+  static_assert(!core::net::inet6::ip::parse("1::2::3"));
+  static_assert(!core::net::inet6::ip::parse("1:2:3:4:5:6:7:8:9"));
+  static_assert(!core::net::inet6::ip::parse("1:2:3:4::5:6:7:8"));
+  static_assert(!core::net::inet6::ip::parse("12345::"));
+  static_assert(!core::net::inet6::ip::parse("1:2:3:4:5:6:7:1.2.3.4"));
+  static_assert(!core::net::inet6::ip::parse("::1.2.3.4:1"));
+
+  // NOTE: the string view does not have to be null terminated
+  const std::string_view string("2001:db8::1ffff");
+  EXPECT_EQ(core::net::inet6::ip(string.substr(0, 12)),
+            core::net::inet6::ip("2001:db8::1f"));
+}
+
+TEST(net_inet6_ip, format_to) {
+  constexpr std::array<std::string_view, 9> kCanonical{
+      "::",
+      "::1",
+      "1::",
+      "2001:db8:0:1:1:1:1:1",
+      "2001:db8::1:0:0:1",
+      "2001:0:0:1::1",
+      "::ffff:192.0.2.1",
+      "::192.0.2.1",
+      "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff"};
+  for (const std::string_view canonical : kCanonical) {
+    EXPECT_EQ(core::net::inet6::ip(canonical).to_string(), canonical);
+  }
+  EXPECT_EQ(core::net::inet6::ip("2001:0DB8:0000::0001").to_string(),
+            "2001:db8::1");
+}
+
+TEST(net_inet6_ip, matches_inet_ntop) {
+  std::mt19937 random(0);
+  for (std::size_t i = 0; i < 100000; ++i) {
+    // NOTE: most groups are zeroed to get runs of zeros of every length
+    std::array<std::byte, 16> bytes{};
+    for (std::size_t j = 0; j < bytes.size(); j += 2) {
+      if (random() % 3 == 0) {
+        bytes[j] = static_cast<std::byte>(random() % 2 ? random() : 0);
+        bytes[j + 1] = static_cast<std::byte>(random());
+      }
+    }
+    if (random() % 8 == 0) {
+      bytes[10] = bytes[11] = std::byte(0xff);
+    }
+
+    std::array<char, INET6_ADDRSTRLEN> expected{};
+    ASSERT_NE(::inet_ntop(AF_INET6, bytes.data(), expected.data(),
+                          expected.size()),
+              nullptr);
+    const core::net::inet6::ip ip(std::span<const std::byte, 16>(bytes),
+                                  core::net::inet6::ip::network_byte_order_t{});
+    EXPECT_EQ(ip.to_string(), expected.data());
+    EXPECT_EQ(core::net::inet6::ip::parse(expected.data()), ip);
+  }
+}
+
 TEST(net_inet6_ip, format) {
   const core::net::inet6::ip ip(core::net::inet6::ip::kAny());
   EXPECT_EQ(std::format("{}", ip), ip.to_string());
 }
 
+TEST(net_inet6_ip, hash) {
+  const std::hash<core::net::inet6::ip> hash;
+  EXPECT_EQ(hash(core::net::inet6::ip("2001:db8::1")),
+            hash(core::net::inet6::ip("2001:db8:0::1")));
+  EXPECT_NE(hash(core::net::inet6::ip("2001:db8::1")),
+            hash(core::net::inet6::ip("2001:db8::2")));
+  EXPECT_NE(hash(core::net::inet6::ip("::1")),
+            hash(core::net::inet6::ip("1::")));
+}
+
+TEST(net_inet6_ip, mapped) {
+  constexpr core::net::inet6::ip kMapped(core::net::inet::ip(0xC0A80001));
+  static_assert(kMapped == core::net::inet6::ip::parse("::ffff:192.168.0.1"));
+  static_assert(kMapped.is_mapped());
+  static_assert(kMapped.to_inet() == core::net::inet::ip(0xC0A80001));
+  static_assert(!core::net::inet6::ip::parse("::192.168.0.1")->is_mapped());
+  static_assert(!core::net::inet6::ip::parse("::ffff:0:1:2")->is_mapped());
+  static_assert(!core::net::inet6::ip::parse("1::ffff:1.2.3.4")->is_mapped());
+  static_assert(!core::net::inet6::ip::parse("::1")->to_inet());
+
+  EXPECT_EQ(core::net::inet6::ip(core::net::inet::ip::kLoopback()).to_string(),
+            "::ffff:127.0.0.1");
+  EXPECT_EQ(core::net::inet6::ip("::ffff:10.0.0.1").to_inet(),
+            core::net::inet::ip("10.0.0.1"));
+}
+
+TEST(net_inet6_ip, classification) {
+  static_assert(core::net::inet6::ip::parse("::")->is_any());
+  static_assert(!core::net::inet6::ip::parse("::1")->is_any());
+  static_assert(core::net::inet6::ip::parse("::1")->is_loopback());
+  static_assert(!core::net::inet6::ip::parse("1::1")->is_loopback());
+  static_assert(
+      !core::net::inet6::ip::parse("::ffff:127.0.0.1")->is_loopback());
+  static_assert(core::net::inet6::ip::parse("fe80::1")->is_link_local());
+  static_assert(core::net::inet6::ip::parse("febf::1")->is_link_local());
+  static_assert(!core::net::inet6::ip::parse("fec0::1")->is_link_local());
+  static_assert(core::net::inet6::ip::parse("fc00::1")->is_unique_local());
+  static_assert(core::net::inet6::ip::parse("fdff::1")->is_unique_local());
+  static_assert(!core::net::inet6::ip::parse("fe00::1")->is_unique_local());
+  static_assert(core::net::inet6::ip::parse("ff02::1")->is_multicast());
+  static_assert(!core::net::inet6::ip::parse("fe02::1")->is_multicast());
+
+  EXPECT_TRUE(core::net::inet6::ip::kAny().is_any());
+  EXPECT_TRUE(core::net::inet6::ip::kLoopback().is_loopback());
+  EXPECT_FALSE(core::net::inet6::ip::kNonRoutable().is_link_local());
+}
+
 }  // namespace tests::net::inet6
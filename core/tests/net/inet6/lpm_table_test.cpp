@@ -0,0 +1,102 @@
+#include "net/inet6/lpm_table.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace tests::net::inet6 {
+
+TEST(net_inet6_lpm_table, smoke) {
+  core::net::inet6::lpm_table table;
+  table.insert(core::net::inet6::cidr("2001:db8::/32"), 1);
+  table.insert(core::net::inet6::cidr("2001:db8:1::/48"), 2);
+  table.insert(core::net::inet6::cidr("2001:db8:1::1/128"), 3);
+
+  EXPECT_EQ(table.lookup(core::net::inet6::ip("2001:db8::1")), 1);
+  EXPECT_EQ(table.lookup(core::net::inet6::ip("2001:db8:1::2")), 2);
+  EXPECT_EQ(table.lookup(core::net::inet6::ip("2001:db8:1::1")), 3);
+  EXPECT_EQ(table.lookup(core::net::inet6::ip("2001:db9::1")), std::nullopt);
+
+  EXPECT_TRUE(table.erase(core::net::inet6::cidr("2001:db8:1::/48")));
+  EXPECT_EQ(table.lookup(core::net::inet6::ip("2001:db8:1::2")), 1);
+  EXPECT_EQ(table.lookup(core::net::inet6::ip("2001:db8:1::1")), 3);
+}
+
+TEST(net_inet6_lpm_table, leaves) {
+  // NOTE: a lone long prefix is kept in a leaf which falls back to the shorter
+  // rules inserted before and after it and is expanded by the rules sharing
+  // its path
+  core::net::inet6::lpm_table table;
+  table.insert(core::net::inet6::cidr("2001:db8:1::1/128"), 1);
+  EXPECT_EQ(table.lookup(core::net::inet6::ip("2001:db8:1::1")), 1);
+  EXPECT_EQ(table.lookup(core::net::inet6::ip("2001:db8:1::2")), std::nullopt);
+
+  table.insert(core::net::inet6::cidr("2001:db8::/32"), 2);
+  table.insert(core::net::inet6::cidr("2001:db8:1::2/128"), 3);
+  table.insert(core::net::inet6::cidr("2001:db8:1::/120"), 4);
+  EXPECT_EQ(table.lookup(core::net::inet6::ip("2001:db8:1::1")), 1);
+  EXPECT_EQ(table.lookup(core::net::inet6::ip("2001:db8:1::2")), 3);
+  EXPECT_EQ(table.lookup(core::net::inet6::ip("2001:db8:1::3")), 4);
+  EXPECT_EQ(table.lookup(core::net::inet6::ip("2001:db8:2::1")), 2);
+
+  table.insert(core::net::inet6::cidr("2001:db8:1::1/128"), 5);
+  EXPECT_EQ(table.lookup(core::net::inet6::ip("2001:db8:1::1")), 5);
+
+  EXPECT_TRUE(table.erase(core::net::inet6::cidr("2001:db8:1::/120")));
+  EXPECT_EQ(table.lookup(core::net::inet6::ip("2001:db8:1::3")), 2);
+  EXPECT_TRUE(table.erase(core::net::inet6::cidr("2001:db8:1::1/128")));
+  EXPECT_EQ(table.lookup(core::net::inet6::ip("2001:db8:1::1")), 2);
+  EXPECT_EQ(table.lookup(core::net::inet6::ip("2001:db8:1::2")), 3);
+  EXPECT_TRUE(table.erase(core::net::inet6::cidr("2001:db8::/32")));
+  EXPECT_EQ(table.lookup(core::net::inet6::ip("2001:db8:1::1")), std::nullopt);
+  EXPECT_EQ(table.lookup(core::net::inet6::ip("2001:db8:1::2")), 3);
+  EXPECT_FALSE(table.erase(core::net::inet6::cidr("2001:db8::/32")));
+}
+
+TEST(net_inet6_lpm_table, matches_scan) {
+  std::mt19937 random(0);
+  const auto random_ip = [&random] {
+    // NOTE: a shared /16 and mostly zero bytes to get the rules nested
+    std::array<std::byte, 16> bytes{std::byte(0x20), std::byte(0x01)};
+    for (std::size_t i = 2; i < bytes.size(); ++i) {
+      bytes[i] = random() % 4 == 0 ? std::byte(random() % 4) : std::byte(0);
+    }
+    return core::net::inet6::ip(std::span<const std::byte, 16>(bytes),
+                                core::net::inet6::ip::network_byte_order_t{});
+  };
+
+  std::vector<std::pair<core::net::inet6::cidr, std::uint32_t>> rules;
+  core::net::inet6::lpm_table table;
+  for (std::uint32_t i = 0; i < 500; ++i) {
+    const core::net::inet6::cidr cidr(random_ip(), 16 + random() % 113);
+    std::erase_if(rules,
+                  [&cidr](const auto& rule) { return rule.first == cidr; });
+    rules.emplace_back(cidr, i);
+    table.insert(cidr, i);
+  }
+  for (std::size_t i = 0; i < 100; ++i) {
+    table.erase(rules.back().first);
+    rules.pop_back();
+  }
+
+  for (std::size_t i = 0; i < 5000; ++i) {
+    const core::net::inet6::ip ip = random_ip();
+    std::optional<std::pair<std::size_t, std::uint32_t>> best;
+    for (const auto& [cidr, value] : rules) {
+      if (cidr.contains(ip) &&
+          (!best || cidr.get_prefix_length() >= best->first)) {
+        best.emplace(cidr.get_prefix_length(), value);
+      }
+    }
+    ASSERT_EQ(table.lookup(ip),
+              best ? std::optional(best->second) : std::nullopt)
+        << ip.to_string();
+  }
+}
+
+}  // namespace tests::net::inet6
@@ -5,8 +5,8 @@
 namespace tests::net::inet6 {
 
 TEST(net_inet6_sockaddr, size) {
-  static_assert(sizeof(core::net::inet6::sockaddr) == 16);
-  static_assert(alignof(core::net::inet6::sockaddr) == 8);
+  static_assert(sizeof(core::net::inet6::sockaddr) == 32);
+  static_assert(alignof(core::net::inet6::sockaddr) == 4);
 }
 
 TEST(net_inet6_sockaddr, equality) {
@@ -49,4 +49,18 @@ TEST(net_inet6_sockaddr, format) {
   EXPECT_EQ(std::format("{}", sockaddr), sockaddr.to_string());
 }
 
+TEST(net_inet6_sockaddr, mapped) {
+  const core::net::inet::sockaddr inet(core::net::inet::ip("10.0.0.1"),
+                                       core::net::inet::port(443));
+  const core::net::inet6::sockaddr sockaddr(inet);
+  EXPECT_EQ(sockaddr.get_ip(), core::net::inet6::ip("::ffff:10.0.0.1"));
+  EXPECT_EQ(sockaddr.get_port(), core::net::inet6::port(443));
+  EXPECT_EQ(sockaddr.to_string(), "[::ffff:10.0.0.1]:443");
+  EXPECT_EQ(sockaddr.to_inet(), inet);
+  EXPECT_EQ(core::net::inet6::sockaddr(core::net::inet6::ip::kLoopback(),
+                                       core::net::inet6::port(443))
+                .to_inet(),
+            std::nullopt);
+}
+
 }  // namespace tests::net::inet6
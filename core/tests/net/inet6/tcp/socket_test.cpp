@@ -4,12 +4,14 @@
 
 #include <thread>
 
+#include "net/inet/sockaddr.hpp"
+#include "net/inet/tcp/socket.hpp"
 #include "net/inet6/sockaddr.hpp"
 
 namespace tests::net::inet6::tcp {
 
 TEST(net_inet6_tcp_socket, size) {
-  static_assert(sizeof(core::net::inet6::tcp::socket) == 4);
+  static_assert(sizeof(core::net::inet6::tcp::socket) == 8);
   static_assert(alignof(core::net::inet6::tcp::socket) == 4);
 }
 
@@ -168,4 +170,41 @@ TEST(net_inet6_tcp_socket, nonblocking_echo_handshake) {
   EXPECT_EQ(buffer, kBuffer);
 }
 
+TEST(net_inet6_tcp_socket, v6only) {
+  core::net::inet6::tcp::socket socket;
+  socket.set_v6only(true);
+  EXPECT_TRUE(socket.get_v6only());
+  socket.set_v6only(false);
+  EXPECT_FALSE(socket.get_v6only());
+}
+
+// NOTE: a single listener bound to :: accepts the IPv4 clients too
+TEST(net_inet6_tcp_socket, dual_stack) {
+  core::net::inet6::tcp::socket server;
+  server.set_v6only(false);
+  server.bind(core::net::inet6::sockaddr(core::net::inet6::ip::kAny(),
+                                         core::net::inet6::port(0)));
+  server.listen(1);
+  core::net::inet6::sockaddr bind_sockaddr(core::net::inet6::ip::kAny(),
+                                           core::net::inet6::port(0));
+  server.get_bind_sockaddr(bind_sockaddr);
+
+  core::net::inet::tcp::socket client;
+  EXPECT_EQ(client.connect(core::net::inet::sockaddr(
+                core::net::inet::ip::kLoopback(), bind_sockaddr.get_port())),
+            core::net::inet::tcp::socket::connection_status::kSuccess);
+  core::net::inet::sockaddr client_sockaddr(core::net::inet::ip::kAny(),
+                                            core::net::inet::port(0));
+  client.get_bind_sockaddr(client_sockaddr);
+
+  core::net::inet6::tcp::socket peer;
+  EXPECT_EQ(server.accept(peer),
+            core::net::inet6::tcp::socket::accept_status::kSuccess);
+  core::net::inet6::sockaddr peer_sockaddr(core::net::inet6::ip::kAny(),
+                                           core::net::inet6::port(0));
+  peer.get_connect_sockaddr(peer_sockaddr);
+  EXPECT_TRUE(peer_sockaddr.get_ip().is_mapped());
+  EXPECT_EQ(peer_sockaddr.to_inet(), client_sockaddr);
+}
+
 }  // namespace tests::net::inet6::tcp
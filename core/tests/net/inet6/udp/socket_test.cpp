@@ -4,12 +4,14 @@
 
 #include <thread>
 
+#include "net/inet/sockaddr.hpp"
+#include "net/inet/udp/socket.hpp"
 #include "net/inet6/sockaddr.hpp"
 
 namespace tests::net::inet6::udp {
 
 TEST(net_inet6_udp_socket, size) {
-  static_assert(sizeof(core::net::inet6::udp::socket) == 4);
+  static_assert(sizeof(core::net::inet6::udp::socket) == 8);
   static_assert(alignof(core::net::inet6::udp::socket) == 4);
 }
 
@@ -161,4 +163,35 @@ TEST(net_inet6_udp_socket, nonblocking_echo_handshake) {
   EXPECT_EQ(buffer, kBuffer);
 }
 
+TEST(net_inet6_udp_socket, dual_stack) {
+  const std::vector<std::byte> kBuffer{std::byte(1), std::byte(2),
+                                       std::byte(3)};
+
+  core::net::inet6::udp::socket server;
+  server.set_v6only(false);
+  EXPECT_FALSE(server.get_v6only());
+  server.bind(core::net::inet6::sockaddr(core::net::inet6::ip::kAny(),
+                                         core::net::inet6::port(0)));
+  core::net::inet6::sockaddr bind_sockaddr(core::net::inet6::ip::kAny(),
+                                           core::net::inet6::port(0));
+  server.get_bind_sockaddr(bind_sockaddr);
+
+  core::net::inet::udp::socket client;
+  const core::net::inet::sockaddr server_sockaddr(
+      core::net::inet::ip::kLoopback(), bind_sockaddr.get_port());
+  EXPECT_EQ(client.send_to(kBuffer, server_sockaddr), kBuffer.size());
+
+  core::net::inet6::sockaddr peer(core::net::inet6::ip::kAny(),
+                                  core::net::inet6::port(0));
+  std::vector<std::byte> buffer(kBuffer.size());
+  EXPECT_EQ(server.receive_from(buffer, peer), kBuffer.size());
+  ASSERT_TRUE(peer.to_inet());
+  EXPECT_EQ(peer.to_inet()->get_ip(), core::net::inet::ip::kLoopback());
+
+  // NOTE: the reply goes to the IPv4 client through the mapped address
+  EXPECT_EQ(server.send_to(kBuffer, peer), kBuffer.size());
+  EXPECT_EQ(client.receive(buffer), kBuffer.size());
+  EXPECT_EQ(buffer, kBuffer);
+}
+
 }  // namespace tests::net::inet6::udp
@@ -2,64 +2,86 @@
 
 #include <gtest/gtest.h>
 
+#include <type_traits>
+
 namespace tests::net::sockets {
 
 namespace {
 
-class impl_sockaddr final : public core::net::sockets::base_sockaddr {
- public:
-  explicit impl_sockaddr(core::net::sockets::family family)
-      : core::net::sockets::base_sockaddr(family) {}
-
+template <core::net::sockets::family Family>
+class impl_sockaddr final : public core::net::sockets::basic_sockaddr<Family> {
  public:
-  using core::net::sockets::base_sockaddr::get_storage;
+  using core::net::sockets::basic_sockaddr<Family>::get_storage;
 };
 
 }  // namespace
 
 TEST(net_sockets_base_sockaddr, size) {
-  static_assert(sizeof(core::net::sockets::base_sockaddr) == 16);
-  static_assert(alignof(core::net::sockets::base_sockaddr) == 8);
+  static_assert(sizeof(impl_sockaddr<core::net::sockets::family::kInet>) ==
+                20);
+  static_assert(sizeof(impl_sockaddr<core::net::sockets::family::kInet6>) ==
+                32);
+  static_assert(sizeof(impl_sockaddr<core::net::sockets::family::kUnix>) ==
+                116);
+  static_assert(alignof(impl_sockaddr<core::net::sockets::family::kInet>) ==
+                4);
+  static_assert(
+      std::is_trivially_copyable_v<core::net::sockets::base_sockaddr>);
+  static_assert(std::is_trivially_copyable_v<
+                impl_sockaddr<core::net::sockets::family::kUnix>>);
 }
 
-class net_sockets_base_sockaddr
-    : public ::testing::TestWithParam<core::net::sockets::family> {};
+template <typename Family>
+class net_sockets_base_sockaddr : public ::testing::Test {
+ protected:
+  static constexpr core::net::sockets::family kFamily = Family::value;
+  using sockaddr_t = impl_sockaddr<kFamily>;
+};
 
-TEST_P(net_sockets_base_sockaddr, smoke) {
-  const auto& family = GetParam();
-  const impl_sockaddr sockaddr(family);
+using families = ::testing::Types<
+    std::integral_constant<core::net::sockets::family,
+                           core::net::sockets::family::kInet>,
+    std::integral_constant<core::net::sockets::family,
+                           core::net::sockets::family::kInet6>,
+    std::integral_constant<core::net::sockets::family,
+                           core::net::sockets::family::kUnix>>;
+TYPED_TEST_SUITE(net_sockets_base_sockaddr, families);
+
+TYPED_TEST(net_sockets_base_sockaddr, smoke) {
+  const typename TestFixture::sockaddr_t sockaddr;
 
   EXPECT_GT(sockaddr.get_length(), 0);
-  EXPECT_EQ(sockaddr.get_family(), family);
+  EXPECT_EQ(sockaddr.get_family(), TestFixture::kFamily);
   EXPECT_TRUE(sockaddr.get_storage());
   EXPECT_NO_THROW(sockaddr.to_string());
 }
 
-TEST_P(net_sockets_base_sockaddr, copy) {
-  const auto& family = GetParam();
-  const impl_sockaddr original(family);
-  const impl_sockaddr copy(original);
+TYPED_TEST(net_sockets_base_sockaddr, copy) {
+  const typename TestFixture::sockaddr_t original;
+  const typename TestFixture::sockaddr_t copy(original);
 
   EXPECT_EQ(original.get_family(), copy.get_family());
   EXPECT_EQ(original.get_length(), copy.get_length());
-  EXPECT_EQ(original.get_storage(), copy.get_storage());
+  EXPECT_NE(original.get_storage(), copy.get_storage());
   EXPECT_EQ(original, copy);
 }
 
-TEST_P(net_sockets_base_sockaddr, move) {
-  const auto& family = GetParam();
-  impl_sockaddr original(family);
-  const impl_sockaddr move(std::move(original));
+TYPED_TEST(net_sockets_base_sockaddr, move) {
+  typename TestFixture::sockaddr_t original;
+  const typename TestFixture::sockaddr_t move(std::move(original));
 
   EXPECT_GT(move.get_length(), 0);
-  EXPECT_EQ(move.get_family(), family);
+  EXPECT_EQ(move.get_family(), TestFixture::kFamily);
   EXPECT_TRUE(move.get_storage());
   EXPECT_NO_THROW(move.to_string());
 }
 
-INSTANTIATE_TEST_SUITE_P(net_sockets_base_sockaddr, net_sockets_base_sockaddr,
-                         ::testing::Values(core::net::sockets::family::kInet,
-                                           core::net::sockets::family::kInet6,
-                                           core::net::sockets::family::kUnix));
+TYPED_TEST(net_sockets_base_sockaddr, hash) {
+  const typename TestFixture::sockaddr_t original;
+  const typename TestFixture::sockaddr_t copy(original);
+
+  EXPECT_EQ(std::hash<core::net::sockets::base_sockaddr>{}(original),
+            std::hash<core::net::sockets::base_sockaddr>{}(copy));
+}
 
 }  // namespace tests::net::sockets
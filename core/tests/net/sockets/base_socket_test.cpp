@@ -16,7 +16,7 @@ class impl_socket final : public core::net::sockets::base_socket {
 }  // namespace
 
 TEST(net_sockets_base_socket, size) {
-  static_assert(sizeof(core::net::sockets::base_socket) == 4);
+  static_assert(sizeof(core::net::sockets::base_socket) == 8);
   static_assert(alignof(core::net::sockets::base_socket) == 4);
 }
 
@@ -0,0 +1,141 @@
+#include "net/sockets/connection_table.hpp"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <unordered_map>
+
+#include "net/inet/four_tuple.hpp"
+#include "net/inet/sockaddr.hpp"
+#include "net/inet6/four_tuple.hpp"
+#include "net/inet6/sockaddr.hpp"
+
+namespace tests::net::sockets {
+
+namespace {
+
+core::net::inet::four_tuple make_tuple(std::uint32_t remote_ip,
+                                       std::uint16_t remote_port) {
+  return core::net::inet::four_tuple(
+      core::net::inet::ip::kLoopback(), core::net::inet::port(8080),
+      core::net::inet::ip(remote_ip), core::net::inet::port(remote_port));
+}
+
+// NOTE: sends every key into the same few buckets to exercise the probing
+struct colliding_hash {
+  std::size_t operator()(int key) const noexcept { return key % 4; }
+};
+
+}  // namespace
+
+TEST(net_sockets_connection_table, four_tuple_size) {
+  static_assert(sizeof(core::net::inet::four_tuple) == 12);
+  static_assert(sizeof(core::net::inet6::four_tuple) == 36);
+}
+
+TEST(net_sockets_connection_table, four_tuple_from_sockaddrs) {
+  const core::net::inet6::sockaddr local(core::net::inet6::ip::kLoopback(),
+                                         core::net::inet6::port(1));
+  const core::net::inet6::sockaddr remote(core::net::inet6::ip("2001:db8::1"),
+                                          core::net::inet6::port(2));
+  const core::net::inet6::four_tuple tuple(local, remote);
+  EXPECT_EQ(tuple.local_ip, local.get_ip());
+  EXPECT_EQ(tuple.remote_port, remote.get_port());
+  EXPECT_NE(tuple, core::net::inet6::four_tuple(remote, local));
+  EXPECT_NE(std::hash<core::net::inet6::four_tuple>{}(tuple),
+            std::hash<core::net::inet6::four_tuple>{}(
+                core::net::inet6::four_tuple(remote, local)));
+}
+
+TEST(net_sockets_connection_table, smoke) {
+  core::net::sockets::connection_table<core::net::inet::four_tuple,
+                                       std::string>
+      table;
+  EXPECT_TRUE(table.empty());
+  EXPECT_EQ(table.find(make_tuple(1, 1)), table.end());
+
+  const auto [inserted, success] =
+      table.try_emplace(make_tuple(1, 1), "first");
+  EXPECT_TRUE(success);
+  EXPECT_EQ(inserted->second, "first");
+  EXPECT_FALSE(table.try_emplace(make_tuple(1, 1), "second").second);
+  EXPECT_EQ(table.find(make_tuple(1, 1))->second, "first");
+  EXPECT_FALSE(table.contains(make_tuple(1, 2)));
+  EXPECT_EQ(table.size(), 1);
+
+  EXPECT_TRUE(table.erase(make_tuple(1, 1)));
+  EXPECT_FALSE(table.erase(make_tuple(1, 1)));
+  EXPECT_TRUE(table.empty());
+}
+
+TEST(net_sockets_connection_table, collisions) {
+  core::net::sockets::connection_table<int, int, colliding_hash> table;
+  for (int i = 0; i < 64; ++i) {
+    EXPECT_TRUE(table.try_emplace(i, i).second);
+  }
+  for (int i = 0; i < 64; i += 3) {
+    EXPECT_TRUE(table.erase(i));
+  }
+  for (int i = 0; i < 64; ++i) {
+    const auto found = table.find(i);
+    if (i % 3 == 0) {
+      EXPECT_EQ(found, table.end());
+    } else {
+      ASSERT_NE(found, table.end());
+      EXPECT_EQ(found->second, i);
+    }
+  }
+}
+
+TEST(net_sockets_connection_table, matches_unordered_map) {
+  std::mt19937 random(0);
+  std::uniform_int_distribution<std::uint32_t> keys(0, 4096);
+
+  core::net::sockets::connection_table<core::net::inet::four_tuple,
+                                       std::uint32_t>
+      table;
+  std::unordered_map<core::net::inet::four_tuple, std::uint32_t> expected;
+  for (std::size_t i = 0; i < 100000; ++i) {
+    const std::uint32_t key = keys(random);
+    const core::net::inet::four_tuple tuple =
+        make_tuple(key, static_cast<std::uint16_t>(key));
+    switch (random() % 3) {
+      case 0:
+        EXPECT_EQ(table.try_emplace(tuple, key).second,
+                  expected.try_emplace(tuple, key).second);
+        break;
+      case 1:
+        EXPECT_EQ(table.erase(tuple), expected.erase(tuple) == 1);
+        break;
+      case 2:
+        EXPECT_EQ(table.contains(tuple), expected.contains(tuple));
+        break;
+    }
+  }
+
+  EXPECT_EQ(table.size(), expected.size());
+  std::size_t iterated = 0;
+  for (const auto& [tuple, value] : table) {
+    EXPECT_EQ(expected.at(tuple), value);
+    iterated += 1;
+  }
+  EXPECT_EQ(iterated, expected.size());
+
+  table.clear();
+  EXPECT_TRUE(table.empty());
+  EXPECT_FALSE(table.contains(expected.begin()->first));
+}
+
+TEST(net_sockets_connection_table, sockaddr_keys) {
+  core::net::sockets::connection_table<core::net::inet::sockaddr, int> table(
+      2);
+  const core::net::inet::sockaddr sockaddr(core::net::inet::ip::kLoopback(),
+                                           core::net::inet::port(1));
+  EXPECT_TRUE(table.try_emplace(sockaddr, 1).second);
+  EXPECT_TRUE(table.contains(core::net::inet::sockaddr(sockaddr)));
+  EXPECT_FALSE(table.contains(core::net::inet::sockaddr(
+      core::net::inet::ip::kLoopback(), core::net::inet::port(2))));
+}
+
+}  // namespace tests::net::sockets
@@ -0,0 +1,53 @@
+#include "net/sockets/message_batch.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "net/inet/sockaddr.hpp"
+#include "net/inet6/sockaddr.hpp"
+
+namespace tests::net::sockets {
+
+TEST(net_sockets_message_batch, capacity) {
+  EXPECT_ANY_THROW(core::net::sockets::message_batch(0));
+
+  const std::vector<std::byte> bytes(4);
+  core::net::sockets::message_batch batch(2);
+  EXPECT_EQ(batch.get_capacity(), 2);
+  EXPECT_EQ(batch.get_size(), 0);
+
+  batch.push(bytes);
+  batch.push(bytes);
+  EXPECT_EQ(batch.get_size(), 2);
+  EXPECT_ANY_THROW(batch.push(bytes));
+
+  batch.clear();
+  EXPECT_EQ(batch.get_size(), 0);
+  EXPECT_NO_THROW(batch.push(bytes));
+}
+
+TEST(net_sockets_message_batch, results) {
+  const std::vector<std::byte> bytes(4);
+  const core::net::inet::sockaddr sockaddr(core::net::inet::ip::kLoopback(),
+                                           core::net::inet::port(1234));
+
+  core::net::sockets::message_batch batch(2);
+  batch.push(bytes);
+  batch.push(bytes, sockaddr);
+  EXPECT_EQ(batch.get_length(0), 0);
+  EXPECT_TRUE(batch.get_bytes(0).empty());
+  EXPECT_ANY_THROW(batch.get_length(2));
+
+  core::net::inet::sockaddr peer(core::net::inet::ip::kNonRoutable(),
+                                 core::net::inet::port(0));
+  EXPECT_ANY_THROW(batch.get_sockaddr(0, peer));
+  EXPECT_NO_THROW(batch.get_sockaddr(1, peer));
+  EXPECT_EQ(peer, sockaddr);
+
+  core::net::inet6::sockaddr peer6(core::net::inet6::ip::kLoopback(),
+                                   core::net::inet6::port(0));
+  EXPECT_ANY_THROW(batch.get_sockaddr(1, peer6));
+}
+
+}  // namespace tests::net::sockets
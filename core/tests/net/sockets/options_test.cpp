@@ -0,0 +1,100 @@
+#include "net/sockets/options.hpp"
+
+#include <gtest/gtest.h>
+
+#include "net/inet/tcp/socket.hpp"
+#include "net/inet6/udp/socket.hpp"
+#include "net/unix/dgram/socket.hpp"
+
+namespace tests::net::sockets {
+
+namespace opt = core::net::sockets::opt;
+
+TEST(net_sockets_options, conversions) {
+  static_assert(opt::to_native(true) == 1);
+  static_assert(opt::to_native(false) == 0);
+  static_assert(opt::to_native(std::chrono::microseconds(50)) == 50);
+  static_assert(opt::to_native(std::optional<std::chrono::seconds>()) == -1);
+  static_assert(
+      opt::to_native(std::optional<std::chrono::seconds>(
+          std::chrono::seconds(3))) == 3);
+
+  static_assert(opt::from_native<bool>(2));
+  static_assert(opt::from_native<int>(7) == 7);
+  static_assert(opt::from_native<std::chrono::seconds>(5) ==
+                std::chrono::seconds(5));
+  static_assert(!opt::from_native<std::optional<std::chrono::seconds>>(-1));
+  static_assert(opt::from_native<std::optional<std::chrono::seconds>>(0) ==
+                std::chrono::seconds(0));
+}
+
+TEST(net_sockets_options, socket_options) {
+  core::net::inet::tcp::socket socket;
+  socket.set<opt::reuseaddr>(true);
+  EXPECT_TRUE(socket.get<opt::reuseaddr>());
+  EXPECT_TRUE(socket.get_reuseaddr());
+
+  socket.set<opt::keepalive>(true);
+  EXPECT_TRUE(socket.get<opt::keepalive>());
+
+  socket.set<opt::rcvbuf>(64 * 1024);
+  EXPECT_GE(socket.get<opt::rcvbuf>(), 64 * 1024);
+  socket.set<opt::sndbuf>(64 * 1024);
+  EXPECT_GE(socket.get<opt::sndbuf>(), 64 * 1024);
+  socket.set<opt::rcvlowat>(16);
+  EXPECT_EQ(socket.get<opt::rcvlowat>(), 16);
+
+  EXPECT_FALSE(socket.get<opt::linger>());
+  socket.set<opt::linger>(std::chrono::seconds(0));
+  EXPECT_EQ(socket.get<opt::linger>(), std::chrono::seconds(0));
+  socket.set<opt::linger>(std::nullopt);
+  EXPECT_FALSE(socket.get<opt::linger>());
+}
+
+TEST(net_sockets_options, tcp_options) {
+  core::net::inet::tcp::socket socket;
+  socket.set<opt::tcp_nodelay>(true);
+  EXPECT_TRUE(socket.get<opt::tcp_nodelay>());
+  socket.set<opt::tcp_nodelay>(false);
+  EXPECT_FALSE(socket.get<opt::tcp_nodelay>());
+
+#ifdef __linux__
+  socket.set<opt::tcp_cork>(true);
+  EXPECT_TRUE(socket.get<opt::tcp_cork>());
+  socket.set<opt::tcp_notsent_lowat>(16 * 1024);
+  EXPECT_EQ(socket.get<opt::tcp_notsent_lowat>(), 16 * 1024);
+  socket.set<opt::tcp_defer_accept>(std::chrono::seconds(1));
+  EXPECT_GE(socket.get<opt::tcp_defer_accept>(), std::chrono::seconds(1));
+  EXPECT_NO_THROW(socket.set<opt::tcp_quickack>(true));
+  EXPECT_NO_THROW(socket.set<opt::incoming_cpu>(0));
+#endif
+
+  core::net::unix::dgram::socket other;
+  EXPECT_ANY_THROW(other.set<opt::tcp_nodelay>(true));
+}
+
+TEST(net_sockets_options, ipv6_options) {
+  core::net::inet6::udp::socket socket;
+  socket.set<opt::ipv6_v6only>(true);
+  EXPECT_TRUE(socket.get<opt::ipv6_v6only>());
+  socket.set<opt::ipv6_v6only>(false);
+  EXPECT_FALSE(socket.get<opt::ipv6_v6only>());
+}
+
+TEST(net_sockets_options, profile) {
+  const opt::profile<opt::tcp_nodelay, opt::keepalive, opt::linger> kProfile(
+      true, true, std::chrono::seconds(1));
+
+  core::net::inet::tcp::socket socket;
+  socket.apply(kProfile);
+  EXPECT_TRUE(socket.get<opt::tcp_nodelay>());
+  EXPECT_TRUE(socket.get<opt::keepalive>());
+  EXPECT_EQ(socket.get<opt::linger>(), std::chrono::seconds(1));
+
+  // NOTE: the options before the failing one stay applied
+  const opt::profile<opt::reuseaddr, opt::ipv6_v6only> kInvalid(true, true);
+  EXPECT_ANY_THROW(socket.apply(kInvalid));
+  EXPECT_TRUE(socket.get<opt::reuseaddr>());
+}
+
+}  // namespace tests::net::sockets
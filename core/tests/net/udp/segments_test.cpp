@@ -0,0 +1,46 @@
+#include "net/udp/segments.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace tests::net::udp {
+
+TEST(net_udp_segments, empty) {
+  const core::net::udp::segments segments({}, 16);
+  EXPECT_TRUE(segments.empty());
+  EXPECT_EQ(segments.size(), 0);
+  EXPECT_EQ(segments.begin(), segments.end());
+}
+
+TEST(net_udp_segments, split) {
+  const std::vector<std::byte> bytes(10);
+  const core::net::udp::segments segments(bytes, 4);
+  ASSERT_EQ(segments.size(), 3);
+  EXPECT_EQ(segments[0].data(), bytes.data());
+  EXPECT_EQ(segments[0].size(), 4);
+  EXPECT_EQ(segments[1].data(), bytes.data() + 4);
+  EXPECT_EQ(segments[1].size(), 4);
+  EXPECT_EQ(segments[2].data(), bytes.data() + 8);
+  EXPECT_EQ(segments[2].size(), 2);
+
+  std::size_t count = 0;
+  std::size_t length = 0;
+  for (const auto segment : segments) {
+    count += 1;
+    length += segment.size();
+  }
+  EXPECT_EQ(count, 3);
+  EXPECT_EQ(length, bytes.size());
+}
+
+TEST(net_udp_segments, exact) {
+  const std::vector<std::byte> bytes(8);
+  EXPECT_EQ(core::net::udp::segments(bytes, 4).size(), 2);
+  EXPECT_EQ(core::net::udp::segments(bytes, 8).size(), 1);
+  EXPECT_EQ(core::net::udp::segments(bytes, 16).size(), 1);
+  EXPECT_EQ(core::net::udp::segments(bytes, 16)[0].size(), 8);
+  EXPECT_EQ(core::net::udp::segments(bytes, 0).size(), 1);
+}
+
+}  // namespace tests::net::udp
@@ -2,12 +2,13 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
 #include <thread>
 
 namespace tests::net::unix::dgram {
 
 TEST(net_unix_dgram_socket, size) {
-  static_assert(sizeof(core::net::unix::dgram::socket) == 4);
+  static_assert(sizeof(core::net::unix::dgram::socket) == 8);
   static_assert(alignof(core::net::unix::dgram::socket) == 4);
 }
 
@@ -131,6 +132,81 @@ TEST(net_unix_dgram_socket, nonblocking_echo_handshake) {
   EXPECT_EQ(buffer, kBuffer);
 }
 
+TEST(net_unix_dgram_socket, vectored_send_receive) {
+  const std::vector<std::byte> kHeader{std::byte(1), std::byte(2)};
+  const std::vector<std::byte> kBody{std::byte(3), std::byte(4), std::byte(5)};
+
+  const core::net::unix::sockaddr server_sockaddr(core::net::unix::sockaddr(
+      "net_unix_dgram_socket_vectored_send_receive_server"));
+  const core::net::unix::sockaddr client_sockaddr(core::net::unix::sockaddr(
+      "net_unix_dgram_socket_vectored_send_receive_client"));
+
+  core::net::unix::dgram::socket server;
+  server.set_nonblock(true);
+  EXPECT_EQ(server.unlink_bind(server_sockaddr),
+            core::net::unix::dgram::socket::bind_status::kSuccess);
+
+  core::net::unix::dgram::socket client;
+  client.set_nonblock(true);
+  EXPECT_EQ(client.unlink_bind(client_sockaddr),
+            core::net::unix::dgram::socket::bind_status::kSuccess);
+
+  const std::array<core::io::const_iovec, 2> out{
+      core::io::const_iovec(kHeader),
+      core::io::const_iovec(kBody),
+  };
+  std::vector<std::byte> header(kHeader.size());
+  std::vector<std::byte> body(kBody.size());
+  const std::array<core::io::iovec, 2> in{
+      core::io::iovec(header),
+      core::io::iovec(body),
+  };
+
+  core::net::unix::sockaddr peer(core::net::unix::sockaddr::kEmpty());
+  EXPECT_EQ(client.send_to(out, server_sockaddr),
+            kHeader.size() + kBody.size());
+  while (server.receive_from(in, peer) != kHeader.size() + kBody.size());
+  EXPECT_EQ(header, kHeader);
+  EXPECT_EQ(body, kBody);
+  EXPECT_EQ(peer, client_sockaddr);
+
+  EXPECT_EQ(server.connect(client_sockaddr),
+            core::net::unix::dgram::socket::connection_status::kSuccess);
+  EXPECT_EQ(client.connect(server_sockaddr),
+            core::net::unix::dgram::socket::connection_status::kSuccess);
+
+  header.assign(header.size(), std::byte(0));
+  body.assign(body.size(), std::byte(0));
+  EXPECT_EQ(server.send(out), kHeader.size() + kBody.size());
+  while (client.receive(in) != kHeader.size() + kBody.size());
+  EXPECT_EQ(header, kHeader);
+  EXPECT_EQ(body, kBody);
+  EXPECT_EQ(client.receive(in), 0);
+}
+
+TEST(net_unix_dgram_socket, unnamed_peer) {
+  const std::vector<std::byte> kBuffer{std::byte(1), std::byte(2),
+                                       std::byte(3)};
+  const core::net::unix::sockaddr sockaddr(
+      core::net::unix::sockaddr("net_unix_dgram_socket_unnamed_peer"));
+
+  core::net::unix::dgram::socket server;
+  server.unlink_bind(sockaddr);
+  core::net::unix::dgram::socket client;
+  EXPECT_EQ(client.send_to(kBuffer, sockaddr), kBuffer.size());
+
+  // NOTE: the kernel reports no address for an unbound sender
+  std::vector<std::byte> buffer(kBuffer.size());
+  core::net::unix::sockaddr peer(sockaddr);
+  EXPECT_EQ(server.receive_from(buffer, peer), kBuffer.size());
+  EXPECT_EQ(peer, core::net::unix::sockaddr::kEmpty());
+  EXPECT_EQ(peer.get_path(), "");
+  EXPECT_EQ(peer.to_string(), "");
+  EXPECT_EQ(std::hash<core::net::unix::sockaddr>{}(peer),
+            std::hash<core::net::unix::sockaddr>{}(
+                core::net::unix::sockaddr::kEmpty()));
+}
+
 TEST(net_unix_dgram_socket, get_sockaddrs) {
   core::net::unix::sockaddr out_sockaddr(core::net::unix::sockaddr::kEmpty());
   const core::net::unix::sockaddr sockaddr(
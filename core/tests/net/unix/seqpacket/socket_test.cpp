@@ -0,0 +1,146 @@
+#include "net/unix/seqpacket/socket.hpp"
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <array>
+#include <cstdio>
+#include <vector>
+
+#include "net/unix/stream/socket.hpp"
+
+namespace tests::net::unix::seqpacket {
+
+namespace {
+
+struct connection {
+  explicit connection(const core::net::unix::sockaddr& sockaddr)
+      : server(), client(), peer(core::utils::uninitialized_t{}) {
+    server.unlink_bind(sockaddr);
+    server.listen(1);
+    EXPECT_EQ(
+        client.connect(sockaddr),
+        core::net::unix::seqpacket::socket::connection_status::kSuccess);
+    EXPECT_EQ(server.accept(peer),
+              core::net::unix::seqpacket::socket::accept_status::kSuccess);
+  }
+
+  core::net::unix::seqpacket::socket server;
+  core::net::unix::seqpacket::socket client;
+  core::net::unix::seqpacket::socket peer;
+};
+
+}  // namespace
+
+TEST(net_unix_seqpacket_socket, size) {
+  static_assert(sizeof(core::net::unix::seqpacket::socket) == 8);
+  static_assert(alignof(core::net::unix::seqpacket::socket) == 4);
+}
+
+TEST(net_unix_seqpacket_socket, type) {
+  core::net::unix::seqpacket::socket socket;
+  EXPECT_EQ(socket.get_family(), core::net::sockets::family::kUnix);
+  EXPECT_EQ(socket.get_type(), core::net::sockets::type::kSeqpacket);
+}
+
+TEST(net_unix_seqpacket_socket, message_boundaries) {
+  const std::vector<std::byte> kFirst{std::byte(1), std::byte(2),
+                                      std::byte(3)};
+  const std::vector<std::byte> kSecond{std::byte(4), std::byte(5)};
+
+  connection connection(core::net::unix::sockaddr(
+      "net_unix_seqpacket_socket_message_boundaries"));
+  EXPECT_EQ(connection.client.send(kFirst), kFirst.size());
+  EXPECT_EQ(connection.client.send(kSecond), kSecond.size());
+
+  std::vector<std::byte> buffer(8);
+  EXPECT_EQ(connection.peer.receive(buffer), kFirst.size());
+  EXPECT_EQ(connection.peer.receive(buffer), kSecond.size());
+}
+
+TEST(net_unix_seqpacket_socket, send_receive_fds) {
+  const std::vector<std::byte> kBytes{std::byte(1)};
+  const std::array<std::byte, 2> kContents{std::byte(6), std::byte(7)};
+
+  std::FILE* first_file = std::tmpfile();
+  std::FILE* second_file = std::tmpfile();
+  ASSERT_NE(first_file, nullptr);
+  ASSERT_NE(second_file, nullptr);
+  const core::io::fd first(::dup(::fileno(first_file)));
+  const core::io::fd second(::dup(::fileno(second_file)));
+
+  connection connection(
+      core::net::unix::sockaddr("net_unix_seqpacket_socket_send_receive_fds"));
+  const std::array<const core::io::fd*, 2> fds{&first, &second};
+  EXPECT_EQ(connection.client.send_fds(kBytes, fds), kBytes.size());
+
+  std::vector<std::byte> buffer(kBytes.size());
+  std::vector<core::io::fd> received;
+  EXPECT_EQ(connection.peer.receive_fds(buffer, received), kBytes.size());
+  EXPECT_EQ(buffer, kBytes);
+  ASSERT_EQ(received.size(), fds.size());
+
+  // NOTE: the received descriptors share the open files with the sent ones
+  const std::array<core::io::const_iovec, 1> iovecs{
+      core::io::const_iovec(kContents)};
+  EXPECT_EQ(received[1].write(iovecs), kContents.size());
+  std::array<std::byte, 2> contents{};
+  std::rewind(second_file);
+  EXPECT_EQ(std::fread(contents.data(), 1, contents.size(), second_file),
+            contents.size());
+  EXPECT_EQ(contents, kContents);
+
+  std::fclose(first_file);
+  std::fclose(second_file);
+}
+
+TEST(net_unix_seqpacket_socket, receive_too_many_fds) {
+  const std::vector<std::byte> kBytes{std::byte(1)};
+
+  connection connection(core::net::unix::sockaddr(
+      "net_unix_seqpacket_socket_receive_too_many_fds"));
+  const std::array<const core::io::fd*, 2> fds{&core::io::fd::kStdin(),
+                                               &core::io::fd::kStdout()};
+  EXPECT_EQ(connection.client.send_fds(kBytes, fds), kBytes.size());
+
+  std::vector<std::byte> buffer(kBytes.size());
+  std::vector<core::io::fd> received;
+  EXPECT_ANY_THROW(connection.peer.receive_fds(buffer, received, 1));
+  EXPECT_TRUE(received.empty());
+}
+
+TEST(net_unix_seqpacket_socket, hand_over_connection) {
+  const std::vector<std::byte> kBytes{std::byte(1), std::byte(2)};
+
+  const core::net::unix::sockaddr sockaddr(
+      "net_unix_seqpacket_socket_hand_over_connection_stream");
+  core::net::unix::stream::socket listener;
+  listener.unlink_bind(sockaddr);
+  listener.listen(1);
+  core::net::unix::stream::socket client;
+  EXPECT_EQ(client.connect(sockaddr),
+            core::net::unix::stream::socket::connection_status::kSuccess);
+  core::net::unix::stream::socket accepted(core::utils::uninitialized_t{});
+  EXPECT_EQ(listener.accept(accepted),
+            core::net::unix::stream::socket::accept_status::kSuccess);
+
+  connection connection(core::net::unix::sockaddr(
+      "net_unix_seqpacket_socket_hand_over_connection"));
+  const std::array<const core::io::fd*, 1> fds{&accepted};
+  EXPECT_EQ(connection.client.send_fds(kBytes, fds), kBytes.size());
+  accepted.close();
+
+  std::vector<std::byte> buffer(kBytes.size());
+  std::vector<core::io::fd> received;
+  EXPECT_EQ(connection.peer.receive_fds(buffer, received), kBytes.size());
+  ASSERT_EQ(received.size(), 1);
+
+  core::net::unix::stream::socket handed(std::move(received.front()));
+  EXPECT_EQ(handed.get_type(), core::net::sockets::type::kStream);
+  EXPECT_EQ(client.send(kBytes), kBytes.size());
+  EXPECT_EQ(handed.receive(buffer), kBytes.size());
+  EXPECT_EQ(buffer, kBytes);
+}
+
+}  // namespace tests::net::unix::seqpacket
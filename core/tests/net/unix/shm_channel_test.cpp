@@ -0,0 +1,296 @@
+#include "net/unix/shm_channel.hpp"
+
+#include <gtest/gtest.h>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace tests::net::unix {
+
+namespace {
+
+struct channels {
+  explicit channels(const core::net::unix::sockaddr& sockaddr,
+                    std::size_t capacity) {
+    core::net::unix::stream::socket listener;
+    listener.unlink_bind(sockaddr);
+    listener.listen(1);
+    core::net::unix::stream::socket client;
+    EXPECT_EQ(client.connect(sockaddr),
+              core::net::unix::stream::socket::connection_status::kSuccess);
+    core::net::unix::stream::socket peer(core::utils::uninitialized_t{});
+    EXPECT_EQ(listener.accept(peer),
+              core::net::unix::stream::socket::accept_status::kSuccess);
+
+    connector = std::make_unique<core::net::unix::shm_channel>(
+        std::move(client), capacity);
+    acceptor = std::make_unique<core::net::unix::shm_channel>(std::move(peer));
+  }
+
+  std::unique_ptr<core::net::unix::shm_channel> connector;
+  std::unique_ptr<core::net::unix::shm_channel> acceptor;
+};
+
+#ifdef __linux__
+// NOTE: a connecting side written by hand which shares the rings with the
+// accepting shm_channel so that the tests may corrupt them. The layout mirrors
+// the one of shm_channel: a control block of three cache lines per ring
+// followed by its data
+struct forged_channel {
+  static constexpr std::size_t kCapacity = 4096;
+  static constexpr std::size_t kControlSize = 192;
+  static constexpr std::size_t kTailOffset = 64;
+  static constexpr std::size_t kSize = 2 * (kControlSize + kCapacity);
+
+  static constexpr int kSeals = F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL;
+
+  explicit forged_channel(const core::net::unix::sockaddr& sockaddr,
+                          int seals = kSeals) {
+    core::net::unix::stream::socket listener;
+    listener.unlink_bind(sockaddr);
+    listener.listen(1);
+    core::net::unix::stream::socket client;
+    EXPECT_EQ(client.connect(sockaddr),
+              core::net::unix::stream::socket::connection_status::kSuccess);
+    core::net::unix::stream::socket peer(core::utils::uninitialized_t{});
+    EXPECT_EQ(listener.accept(peer),
+              core::net::unix::stream::socket::accept_status::kSuccess);
+
+    const int memory_handle =
+        ::memfd_create("forged_channel", MFD_CLOEXEC | MFD_ALLOW_SEALING);
+    const core::io::fd memory(memory_handle);
+    EXPECT_EQ(::ftruncate(memory_handle, kSize), 0);
+    EXPECT_EQ(::fcntl(memory_handle, F_ADD_SEALS, seals), 0);
+    data = static_cast<std::byte*>(::mmap(nullptr, kSize,
+                                          PROT_READ | PROT_WRITE, MAP_SHARED,
+                                          memory_handle, 0));
+    EXPECT_NE(data, MAP_FAILED);
+
+    const core::io::fd own_event(::eventfd(0, EFD_CLOEXEC));
+    const core::io::fd peer_event(::eventfd(0, EFD_CLOEXEC));
+    const std::uint64_t header = kCapacity;
+    const std::array<const core::io::fd*, 3> fds{&memory, &own_event,
+                                                 &peer_event};
+    EXPECT_EQ(client.send_fds(
+                  std::as_bytes(std::span<const std::uint64_t, 1>(&header, 1)),
+                  fds),
+              sizeof(header));
+    socket = std::make_unique<core::net::unix::stream::socket>(
+        std::move(client));
+    this->peer =
+        std::make_unique<core::net::unix::stream::socket>(std::move(peer));
+  }
+  ~forged_channel() noexcept { ::munmap(data, kSize); }
+
+  // NOTE: publishes a record at the offset of the ring read by the acceptor
+  void publish(std::size_t offset, std::uint32_t length, std::uint64_t head) {
+    const std::array<std::uint32_t, 2> record{length, 0};
+    std::memcpy(data + kControlSize + offset, record.data(), sizeof(record));
+    std::memcpy(data, &head, sizeof(head));
+  }
+
+  std::byte* data;
+  std::unique_ptr<core::net::unix::stream::socket> socket;
+  std::unique_ptr<core::net::unix::stream::socket> peer;
+};
+#endif
+
+}  // namespace
+
+TEST(net_unix_shm_channel, size) {
+  static_assert(sizeof(core::net::unix::shm_channel) == 88);
+  static_assert(alignof(core::net::unix::shm_channel) == 8);
+}
+
+TEST(net_unix_shm_channel, invalid_capacity) {
+  EXPECT_ANY_THROW(
+      core::net::unix::shm_channel(core::net::unix::stream::socket(), 0));
+}
+
+TEST(net_unix_shm_channel, send_receive) {
+  const std::vector<std::byte> kPing{std::byte(1), std::byte(2), std::byte(3)};
+  const std::vector<std::byte> kPong{std::byte(4)};
+
+  channels channels(
+      core::net::unix::sockaddr("net_unix_shm_channel_send_receive"), 1);
+  auto& [connector, acceptor] = channels;
+  EXPECT_EQ(connector->get_max_message_size(), 4096 / 2 - 8);
+  EXPECT_EQ(acceptor->get_max_message_size(), 4096 / 2 - 8);
+
+  std::vector<std::byte> buffer(8);
+  EXPECT_EQ(acceptor->try_receive(buffer), 0);
+  EXPECT_TRUE(connector->try_send(kPing));
+  EXPECT_EQ(acceptor->try_receive(buffer), kPing.size());
+  EXPECT_EQ(std::vector(buffer.begin(), buffer.begin() + kPing.size()), kPing);
+
+  EXPECT_TRUE(acceptor->try_send(kPong));
+  EXPECT_EQ(connector->receive(buffer), kPong.size());
+  EXPECT_EQ(buffer.front(), kPong.front());
+  EXPECT_EQ(connector->try_receive(buffer), 0);
+}
+
+TEST(net_unix_shm_channel, invalid_messages) {
+  channels channels(
+      core::net::unix::sockaddr("net_unix_shm_channel_invalid_messages"), 1);
+  auto& [connector, acceptor] = channels;
+
+  EXPECT_ANY_THROW(connector->try_send({}));
+  EXPECT_ANY_THROW(connector->try_send(
+      std::vector<std::byte>(connector->get_max_message_size() + 1)));
+
+  // NOTE: a message larger than the buffer stays in the ring
+  const std::vector<std::byte> kMessage(16, std::byte(7));
+  EXPECT_TRUE(connector->try_send(kMessage));
+  std::vector<std::byte> buffer(kMessage.size() - 1);
+  EXPECT_ANY_THROW(acceptor->try_receive(buffer));
+  buffer.resize(kMessage.size());
+  EXPECT_EQ(acceptor->try_receive(buffer), kMessage.size());
+  EXPECT_EQ(buffer, kMessage);
+}
+
+TEST(net_unix_shm_channel, full_ring_wraparound) {
+  channels channels(
+      core::net::unix::sockaddr("net_unix_shm_channel_full_ring_wraparound"),
+      4096);
+  auto& [connector, acceptor] = channels;
+
+  // NOTE: 1000 byte messages take 1008 bytes of the ring so that every fourth
+  // one wraps around the end
+  std::vector<std::byte> message(1000);
+  std::vector<std::byte> buffer(message.size());
+  for (std::size_t round = 0; round < 16; ++round) {
+    std::size_t sent = 0;
+    for (; connector->try_send(message); ++sent) {
+      message.front() = std::byte(sent);
+    }
+    EXPECT_GT(sent, 0);
+    for (std::size_t i = 0; i < sent; ++i) {
+      EXPECT_EQ(acceptor->try_receive(buffer), message.size());
+    }
+    EXPECT_EQ(acceptor->try_receive(buffer), 0);
+  }
+}
+
+TEST(net_unix_shm_channel, blocking_ordered) {
+  constexpr std::uint32_t kMessages = 100000;
+
+  channels channels(
+      core::net::unix::sockaddr("net_unix_shm_channel_blocking_ordered"),
+      4096);
+  auto& [connector, acceptor] = channels;
+
+  std::thread sender([&connector] {
+    for (std::uint32_t i = 0; i < kMessages; ++i) {
+      connector->send(std::as_bytes(std::span(&i, 1)));
+    }
+  });
+
+  for (std::uint32_t i = 0; i < kMessages; ++i) {
+    std::uint32_t value;
+    ASSERT_EQ(acceptor->receive(std::as_writable_bytes(std::span(&value, 1))),
+              sizeof(value));
+    ASSERT_EQ(value, i);
+  }
+  sender.join();
+}
+
+TEST(net_unix_shm_channel, peer_gone) {
+  const std::vector<std::byte> kMessage{std::byte(1)};
+
+  channels channels(
+      core::net::unix::sockaddr("net_unix_shm_channel_peer_gone"), 1);
+  auto& [connector, acceptor] = channels;
+
+  EXPECT_TRUE(connector->try_send(kMessage));
+  connector.reset();
+
+  std::vector<std::byte> buffer(kMessage.size());
+  EXPECT_EQ(acceptor->receive(buffer), kMessage.size());
+  EXPECT_ANY_THROW(acceptor->receive(buffer));
+}
+
+#ifdef __linux__
+TEST(net_unix_shm_channel, unsealed_memory) {
+  forged_channel forged(
+      core::net::unix::sockaddr("net_unix_shm_channel_unsealed_memory"),
+      F_SEAL_SHRINK);
+  EXPECT_ANY_THROW(core::net::unix::shm_channel(std::move(*forged.peer)));
+}
+
+TEST(net_unix_shm_channel, corrupted_ring) {
+  std::vector<std::byte> buffer(forged_channel::kCapacity);
+  {
+    forged_channel forged(
+        core::net::unix::sockaddr("net_unix_shm_channel_corrupted_ring"));
+    core::net::unix::shm_channel acceptor(std::move(*forged.peer));
+    forged.publish(0, 3, 16);
+    EXPECT_EQ(acceptor.try_receive(buffer), 3);
+  }
+  {
+    // NOTE: the message does not fit the rest of the ring
+    forged_channel forged(
+        core::net::unix::sockaddr("net_unix_shm_channel_corrupted_ring"));
+    core::net::unix::shm_channel acceptor(std::move(*forged.peer));
+    forged.publish(0, forged_channel::kCapacity, 16);
+    EXPECT_ANY_THROW(acceptor.try_receive(buffer));
+  }
+  {
+    // NOTE: the message is not published in full
+    forged_channel forged(
+        core::net::unix::sockaddr("net_unix_shm_channel_corrupted_ring"));
+    core::net::unix::shm_channel acceptor(std::move(*forged.peer));
+    forged.publish(0, 100, 16);
+    EXPECT_ANY_THROW(acceptor.try_receive(buffer));
+  }
+  {
+    // NOTE: the wrap record pads past the head
+    forged_channel forged(
+        core::net::unix::sockaddr("net_unix_shm_channel_corrupted_ring"));
+    core::net::unix::shm_channel acceptor(std::move(*forged.peer));
+    forged.publish(0, std::numeric_limits<std::uint32_t>::max(), 16);
+    EXPECT_ANY_THROW(acceptor.try_receive(buffer));
+  }
+  {
+    // NOTE: the head is more than a ring ahead of the tail
+    forged_channel forged(
+        core::net::unix::sockaddr("net_unix_shm_channel_corrupted_ring"));
+    core::net::unix::shm_channel acceptor(std::move(*forged.peer));
+    forged.publish(0, 3, 2 * forged_channel::kCapacity);
+    EXPECT_ANY_THROW(acceptor.try_receive(buffer));
+  }
+  {
+    // NOTE: the head is not aligned to the records
+    forged_channel forged(
+        core::net::unix::sockaddr("net_unix_shm_channel_corrupted_ring"));
+    core::net::unix::shm_channel acceptor(std::move(*forged.peer));
+    forged.publish(0, 3, 13);
+    EXPECT_ANY_THROW(acceptor.try_receive(buffer));
+  }
+  {
+    // NOTE: the tail of the acceptor is its own and the forged one in the
+    // shared memory is ignored
+    forged_channel forged(
+        core::net::unix::sockaddr("net_unix_shm_channel_corrupted_ring"));
+    core::net::unix::shm_channel acceptor(std::move(*forged.peer));
+    const std::uint64_t tail = forged_channel::kCapacity - 1;
+    std::memcpy(forged.data + forged_channel::kTailOffset, &tail,
+                sizeof(tail));
+    forged.publish(0, 3, 16);
+    EXPECT_EQ(acceptor.try_receive(buffer), 3);
+  }
+}
+#endif
+
+}  // namespace tests::net::unix
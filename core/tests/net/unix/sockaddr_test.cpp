@@ -2,11 +2,13 @@
 
 #include <gtest/gtest.h>
 
+#include <string_view>
+
 namespace tests::net::unix {
 
 TEST(net_unix_sockaddr, size) {
-  static_assert(sizeof(core::net::unix::sockaddr) == 16);
-  static_assert(alignof(core::net::unix::sockaddr) == 8);
+  static_assert(sizeof(core::net::unix::sockaddr) == 116);
+  static_assert(alignof(core::net::unix::sockaddr) == 4);
 }
 
 TEST(net_unix_sockaddr, construction) {
@@ -18,6 +20,27 @@ TEST(net_unix_sockaddr, construction) {
       "oooooooooooooooooooooooooong"));
 }
 
+TEST(net_unix_sockaddr, length) {
+  const core::net::unix::sockaddr empty("");
+  const core::net::unix::sockaddr path("/tmp/a");
+  EXPECT_LT(empty.get_length(), path.get_length());
+  EXPECT_EQ(path.get_length() - empty.get_length(), 7);
+  EXPECT_EQ(path.get_path(), "/tmp/a");
+}
+
+TEST(net_unix_sockaddr, abstract) {
+  using namespace std::string_view_literals;
+
+  const core::net::unix::sockaddr sockaddr("\0net_unix_sockaddr_abstract"sv);
+  EXPECT_EQ(sockaddr.get_path(), "\0net_unix_sockaddr_abstract"sv);
+  EXPECT_EQ(sockaddr.to_string(), "@net_unix_sockaddr_abstract");
+  EXPECT_EQ(sockaddr.get_length() -
+                core::net::unix::sockaddr::kEmpty().get_length(),
+            sockaddr.get_path().size());
+  EXPECT_NE(sockaddr, core::net::unix::sockaddr("\0net_unix_sockaddr"sv));
+  EXPECT_NE(sockaddr, core::net::unix::sockaddr("net_unix_sockaddr_abstract"));
+}
+
 TEST(net_unix_sockaddr, equality) {
   EXPECT_EQ(core::net::unix::sockaddr::kEmpty(),
             core::net::unix::sockaddr::kEmpty());
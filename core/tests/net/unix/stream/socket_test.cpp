@@ -2,12 +2,13 @@
 
 #include <gtest/gtest.h>
 
+#include <string_view>
 #include <thread>
 
 namespace tests::ipc::unix::stream {
 
 TEST(net_unix_stream_socket, size) {
-  static_assert(sizeof(core::net::unix::stream::socket) == 4);
+  static_assert(sizeof(core::net::unix::stream::socket) == 8);
   static_assert(alignof(core::net::unix::stream::socket) == 4);
 }
 
@@ -172,4 +173,27 @@ TEST(net_unix_stream_socket, get_sockaddrs) {
   EXPECT_NO_THROW(client.get_bind_sockaddr(out_sockaddr));
 }
 
+TEST(net_unix_stream_socket, abstract_sockaddr) {
+  using namespace std::string_view_literals;
+
+  const core::net::unix::sockaddr sockaddr(
+      "\0net_unix_stream_socket_abstract_sockaddr"sv);
+
+  core::net::unix::stream::socket server;
+  EXPECT_EQ(server.bind(sockaddr),
+            core::net::unix::stream::socket::bind_status::kSuccess);
+  server.listen(1);
+
+  core::net::unix::stream::socket client;
+  EXPECT_EQ(client.connect(sockaddr),
+            core::net::unix::stream::socket::connection_status::kSuccess);
+
+  core::net::unix::sockaddr out_sockaddr(core::net::unix::sockaddr::kEmpty());
+  server.get_bind_sockaddr(out_sockaddr);
+  EXPECT_EQ(out_sockaddr, sockaddr);
+  EXPECT_EQ(out_sockaddr.get_length(), sockaddr.get_length());
+  EXPECT_EQ(out_sockaddr.to_string(),
+            "@net_unix_stream_socket_abstract_sockaddr");
+}
+
 }  // namespace tests::ipc::unix::stream
@@ -0,0 +1,156 @@
+#include "runtime/reactors.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace tests::runtime {
+
+namespace {
+
+constexpr std::size_t kReactors = 2;
+
+const core::net::inet::sockaddr kSockaddr(core::net::inet::ip::kLoopback(),
+                                          core::net::inet::port(0));
+
+// NOTE: echoes everything received on the accepted sockets back
+class echo_server final {
+ public:
+  echo_server()
+      : reactors(
+            kSockaddr,
+            [this](core::io::poller& poller,
+                   core::net::inet::tcp::socket&& socket) {
+              std::scoped_lock lock(mutex);
+              auto& peer = peers.emplace_back(std::move(socket));
+              poller.insert_or_assign(peer, core::io::poller::event::kPollIn,
+                                      &peer);
+            },
+            [](core::io::poller& poller, const core::io::fd& fd,
+               core::io::poller::events_t, void* data) {
+              auto& peer = *static_cast<core::net::inet::tcp::socket*>(data);
+              std::vector<std::byte> buffer(16);
+              const std::size_t received = peer.receive(buffer);
+              if (received == 0) {
+                poller.erase(fd);
+                return;
+              }
+              peer.send(std::span(buffer).first(received));
+            },
+            kReactors) {}
+
+ public:
+  std::mutex mutex;
+  std::list<core::net::inet::tcp::socket> peers;
+  core::runtime::reactors reactors;
+};
+
+}  // namespace
+
+TEST(runtime_reactors, size) {
+  static_assert(sizeof(core::runtime::reactors) == 32);
+  static_assert(alignof(core::runtime::reactors) == 8);
+}
+
+TEST(runtime_reactors, start_stop) {
+  core::runtime::reactors reactors(
+      kSockaddr, core::runtime::reactors::accept_callback_t{},
+      core::io::poller::callback_t{}, kReactors);
+  EXPECT_EQ(reactors.size(), kReactors);
+  EXPECT_FALSE(reactors.is_running());
+  reactors.stop();
+
+  reactors.start();
+  EXPECT_TRUE(reactors.is_running());
+  EXPECT_ANY_THROW(reactors.start());
+  reactors.stop();
+  EXPECT_FALSE(reactors.is_running());
+
+  reactors.start();
+  EXPECT_TRUE(reactors.is_running());
+}
+
+TEST(runtime_reactors, default_count) {
+  core::runtime::reactors reactors(
+      kSockaddr, core::runtime::reactors::accept_callback_t{},
+      core::io::poller::callback_t{});
+  EXPECT_GE(reactors.size(), 1);
+}
+
+TEST(runtime_reactors, in_use) {
+  core::runtime::reactors reactors(
+      kSockaddr, core::runtime::reactors::accept_callback_t{},
+      core::io::poller::callback_t{}, 1);
+  core::net::inet::sockaddr sockaddr(core::net::inet::ip::kLoopback(),
+                                     core::net::inet::port(0));
+  reactors.get_bind_sockaddr(sockaddr);
+
+  core::net::inet::tcp::socket socket;
+  EXPECT_EQ(socket.bind(sockaddr),
+            core::net::inet::tcp::socket::bind_status::kInUse);
+}
+
+TEST(runtime_reactors, post) {
+  core::runtime::reactors reactors(
+      kSockaddr, core::runtime::reactors::accept_callback_t{},
+      core::io::poller::callback_t{}, kReactors);
+  reactors.start();
+
+  std::atomic<std::size_t> calls = 0;
+  std::vector<std::thread::id> ids(kReactors);
+  for (std::size_t i = 0; i < kReactors; ++i) {
+    reactors.post(i, [&calls, &ids, i] {
+      ids[i] = std::this_thread::get_id();
+      calls.fetch_add(1, std::memory_order::release);
+    });
+  }
+  while (calls.load(std::memory_order::acquire) != kReactors);
+  reactors.stop();
+
+  EXPECT_NE(ids.front(), std::this_thread::get_id());
+  EXPECT_NE(ids.front(), ids.back());
+  for (std::size_t i = 0; i < kReactors; ++i) {
+    EXPECT_GE(reactors.get_load(i).wakeups, 1);
+  }
+  EXPECT_ANY_THROW(reactors.get_load(kReactors));
+}
+
+TEST(runtime_reactors, echo) {
+  constexpr std::size_t kClients = 16;
+  const std::vector<std::byte> kBuffer{std::byte(1), std::byte(2),
+                                       std::byte(3)};
+
+  echo_server server;
+  core::net::inet::sockaddr sockaddr(core::net::inet::ip::kLoopback(),
+                                     core::net::inet::port(0));
+  server.reactors.get_bind_sockaddr(sockaddr);
+  server.reactors.start();
+
+  std::vector<core::net::inet::tcp::socket> clients(kClients);
+  for (auto& client : clients) {
+    EXPECT_EQ(client.connect(sockaddr),
+              core::net::inet::tcp::socket::connection_status::kSuccess);
+    std::vector<std::byte> buffer(kBuffer.size());
+    EXPECT_EQ(client.send(kBuffer), kBuffer.size());
+    EXPECT_EQ(client.receive(buffer), kBuffer.size());
+    EXPECT_EQ(buffer, kBuffer);
+  }
+  server.reactors.stop();
+
+  core::runtime::reactors::load total{};
+  for (std::size_t i = 0; i < server.reactors.size(); ++i) {
+    const auto load = server.reactors.get_load(i);
+    total.accepted += load.accepted;
+    total.events += load.events;
+    total.errors += load.errors;
+  }
+  EXPECT_EQ(total.accepted, kClients);
+  EXPECT_GE(total.events, kClients);
+  EXPECT_EQ(total.errors, 0);
+}
+
+}  // namespace tests::runtime
@@ -0,0 +1,76 @@
+#include "utils/histogram.hpp"
+
+#include <gtest/gtest.h>
+
+namespace tests::utils {
+
+TEST(utils_histogram, buckets) {
+  static_assert(core::utils::histogram::get_bucket(0) == 0);
+  static_assert(core::utils::histogram::get_bucket(3) == 3);
+  static_assert(core::utils::histogram::get_bucket(4) == 4);
+  static_assert(core::utils::histogram::get_bucket(7) == 7);
+  static_assert(core::utils::histogram::get_bucket(8) == 8);
+  static_assert(core::utils::histogram::get_bucket(9) == 8);
+  static_assert(core::utils::histogram::get_bucket(10) == 9);
+  static_assert(core::utils::histogram::get_bucket(
+                    std::numeric_limits<std::uint64_t>::max()) ==
+                core::utils::histogram::kBuckets - 1);
+  static_assert(core::utils::histogram::get_upper_bound(
+                    core::utils::histogram::kBuckets - 1) ==
+                std::numeric_limits<std::uint64_t>::max());
+
+  for (std::uint64_t value = 0; value < 100000; ++value) {
+    const std::size_t bucket = core::utils::histogram::get_bucket(value);
+    const std::uint64_t upper = core::utils::histogram::get_upper_bound(bucket);
+    EXPECT_GE(upper, value);
+    EXPECT_LE(upper - value, value / 4);
+    if (bucket > 0) {
+      EXPECT_LT(core::utils::histogram::get_upper_bound(bucket - 1), value);
+    }
+  }
+}
+
+TEST(utils_histogram, record) {
+  core::utils::histogram histogram;
+  EXPECT_EQ(histogram.count(), 0);
+  EXPECT_EQ(histogram.min(), 0);
+  EXPECT_EQ(histogram.max(), 0);
+  EXPECT_EQ(histogram.percentile(0.5), 0);
+
+  for (std::uint64_t value = 1; value <= 1000; ++value) {
+    histogram.record(value);
+  }
+  EXPECT_EQ(histogram.count(), 1000);
+  EXPECT_EQ(histogram.sum(), 500500);
+  EXPECT_EQ(histogram.min(), 1);
+  EXPECT_EQ(histogram.max(), 1000);
+  EXPECT_EQ(histogram.percentile(0), 1);
+  EXPECT_EQ(histogram.percentile(1), 1000);
+
+  const std::uint64_t median = histogram.percentile(0.5);
+  EXPECT_GE(median, 500);
+  EXPECT_LE(median, 500 + 500 / 4);
+  const std::uint64_t p99 = histogram.percentile(0.99);
+  EXPECT_GE(p99, 990);
+  EXPECT_LE(p99, 1000);
+}
+
+TEST(utils_histogram, merge_reset) {
+  core::utils::histogram lhs;
+  core::utils::histogram rhs;
+  lhs.record(10);
+  rhs.record(1);
+  rhs.record(100);
+
+  lhs.merge(rhs);
+  EXPECT_EQ(lhs.count(), 3);
+  EXPECT_EQ(lhs.sum(), 111);
+  EXPECT_EQ(lhs.min(), 1);
+  EXPECT_EQ(lhs.max(), 100);
+
+  lhs.reset();
+  EXPECT_EQ(lhs.count(), 0);
+  EXPECT_EQ(lhs.percentile(0.5), 0);
+}
+
+}  // namespace tests::utils